@@ -0,0 +1,174 @@
+/*
+ *  ICGlue is a Tcl-Library for scripted HDL generation
+ *  Copyright (C) 2017-2019  Andreas Dixius, Felix Neumärker
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "ig_arena.h"
+
+#include <string.h>
+
+#define IG_ARENA_ALIGN          (2 * sizeof (gpointer))
+#define IG_ARENA_BLOCK_SIZE_MIN (16 * 1024)
+#define IG_ARENA_BLOCK_SIZE_MAX (1024 * 1024)
+
+struct ig_arena_block {
+    struct ig_arena_block *next;
+    gsize                  size;
+    char                   data[];
+};
+
+struct ig_arena_cleanup {
+    struct ig_arena_cleanup *next;
+    GDestroyNotify           func;
+    gpointer                 data;
+};
+
+static inline gsize ig_arena_align (gsize size)
+{
+    return (size + IG_ARENA_ALIGN - 1) & ~(IG_ARENA_ALIGN - 1);
+}
+
+static struct ig_arena_block *ig_arena_block_new (gsize size)
+{
+    struct ig_arena_block *block = (struct ig_arena_block *)g_malloc (sizeof (struct ig_arena_block) + size);
+
+    block->next = NULL;
+    block->size = size;
+
+    return block;
+}
+
+static void ig_arena_release (struct ig_arena *arena)
+{
+    for (struct ig_arena_cleanup *ci = arena->cleanup; ci != NULL; ci = ci->next) {
+        ci->func (ci->data);
+    }
+    arena->cleanup = NULL;
+
+    struct ig_arena_block *bi = arena->blocks;
+    while (bi != NULL) {
+        struct ig_arena_block *next = bi->next;
+        g_free (bi);
+        bi = next;
+    }
+    arena->blocks = NULL;
+
+    arena->block_size     = IG_ARENA_BLOCK_SIZE_MIN;
+    arena->block_fill     = 0;
+    arena->bytes_used     = 0;
+    arena->bytes_reserved = 0;
+}
+
+struct ig_arena *ig_arena_new (void)
+{
+    struct ig_arena *arena = g_slice_new (struct ig_arena);
+
+    arena->blocks         = NULL;
+    arena->block_size     = IG_ARENA_BLOCK_SIZE_MIN;
+    arena->block_fill     = 0;
+    arena->bytes_used     = 0;
+    arena->bytes_reserved = 0;
+    arena->cleanup        = NULL;
+
+    return arena;
+}
+
+void ig_arena_clear (struct ig_arena *arena)
+{
+    if (arena == NULL) return;
+
+    ig_arena_release (arena);
+}
+
+void ig_arena_reset (struct ig_arena *arena)
+{
+    if (arena == NULL) return;
+
+    struct ig_arena_block *keep = arena->blocks;
+    if (keep == NULL) return;
+
+    arena->blocks = keep->next;
+    keep->next    = NULL;
+    ig_arena_release (arena);
+
+    arena->blocks         = keep;
+    arena->bytes_reserved = keep->size;
+}
+
+void ig_arena_free (struct ig_arena *arena)
+{
+    if (arena == NULL) return;
+
+    ig_arena_release (arena);
+    g_slice_free (struct ig_arena, arena);
+}
+
+gpointer ig_arena_alloc (struct ig_arena *arena, gsize size)
+{
+    if (arena == NULL) return NULL;
+
+    size = ig_arena_align (size);
+
+    gpointer result = NULL;
+
+    if (size > IG_ARENA_BLOCK_SIZE_MIN / 4) {
+        /* large allocation: dedicated block behind the current one */
+        struct ig_arena_block *block = ig_arena_block_new (size);
+        if (arena->blocks == NULL) {
+            arena->blocks     = block;
+            arena->block_fill = size;
+        } else {
+            block->next         = arena->blocks->next;
+            arena->blocks->next = block;
+        }
+        arena->bytes_reserved += size;
+        result = block->data;
+    } else {
+        if ((arena->blocks == NULL) || (arena->block_fill + size > arena->blocks->size)) {
+            struct ig_arena_block *block = ig_arena_block_new (arena->block_size);
+            block->next            = arena->blocks;
+            arena->blocks          = block;
+            arena->block_fill      = 0;
+            arena->bytes_reserved += arena->block_size;
+
+            if (arena->block_size < IG_ARENA_BLOCK_SIZE_MAX) {
+                arena->block_size *= 2;
+            }
+        }
+        result = arena->blocks->data + arena->block_fill;
+        arena->block_fill += size;
+    }
+
+    arena->bytes_used += size;
+    memset (result, 0, size);
+
+    return result;
+}
+
+void ig_arena_add_cleanup (struct ig_arena *arena, GDestroyNotify func, gpointer data)
+{
+    if (arena == NULL) return;
+    if (func == NULL) return;
+
+    struct ig_arena_cleanup *cleanup = ig_arena_new0 (arena, struct ig_arena_cleanup);
+
+    cleanup->func  = func;
+    cleanup->data  = data;
+    cleanup->next  = arena->cleanup;
+    arena->cleanup = cleanup;
+}
+
@@ -0,0 +1,110 @@
+/*
+ *  ICGlue is a Tcl-Library for scripted HDL generation
+ *  Copyright (C) 2017-2019  Andreas Dixius, Felix Neumärker
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file
+ * @brief Bump allocator for database objects.
+ */
+#ifndef __IG_ARENA_H__
+#define __IG_ARENA_H__
+
+#include <glib.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct ig_arena_block;
+struct ig_arena_cleanup;
+
+/**
+ * @brief Arena memory container.
+ *
+ * Memory allocated from an arena is never freed individually but only
+ * all at once with @ref ig_arena_clear or @ref ig_arena_free.
+ * For memory allocation/free see @ref ig_arena_new and @ref ig_arena_free.
+ */
+struct ig_arena {
+    struct ig_arena_block   *blocks;          /**< @brief Allocated memory blocks, most recent first. */
+    gsize                    block_size;      /**< @brief Size of next regular block to allocate. */
+    gsize                    block_fill;      /**< @brief Bytes used in most recent regular block. */
+    gsize                    bytes_used;      /**< @brief Total bytes handed out by the arena. */
+    gsize                    bytes_reserved;  /**< @brief Total bytes allocated for blocks. */
+    struct ig_arena_cleanup *cleanup;         /**< @brief Destructors of non-arena memory to run on clear/free. */
+};
+
+/**
+ * @brief Create new arena.
+ * @return The newly created arena.
+ */
+struct ig_arena *ig_arena_new (void);
+
+/**
+ * @brief Release all memory allocated from arena.
+ * @param arena Arena to clear.
+ *
+ * Registered cleanup functions are called in reverse order of registration.
+ * The arena can be used for new allocations afterwards.
+ */
+void ig_arena_clear (struct ig_arena *arena);
+
+/**
+ * @brief Release all memory allocated from arena but keep the most recent block for reuse.
+ * @param arena Arena to reset.
+ *
+ * Like @ref ig_arena_clear, but intended for scratch arenas that are filled and
+ * reset repeatedly: allocations after a reset reuse the kept block instead of
+ * allocating new memory.
+ */
+void ig_arena_reset (struct ig_arena *arena);
+
+/**
+ * @brief Free arena and all memory allocated from it.
+ * @param arena Arena to free.
+ */
+void ig_arena_free (struct ig_arena *arena);
+
+/**
+ * @brief Allocate zero-initialized memory from arena.
+ * @param arena Arena to allocate from.
+ * @param size Number of bytes to allocate.
+ * @return Pointer to allocated memory, suitably aligned for any object type.
+ */
+gpointer ig_arena_alloc (struct ig_arena *arena, gsize size);
+
+/**
+ * @brief Allocate a struct from arena.
+ */
+#define ig_arena_new0(ARENA, TYPE) ((TYPE *)ig_arena_alloc ((ARENA), sizeof (TYPE)))
+
+/**
+ * @brief Register data not allocated in the arena to be released together with the arena.
+ * @param arena Arena to register cleanup for.
+ * @param func Destructor to call for data.
+ * @param data Data to pass to destructor.
+ */
+void ig_arena_add_cleanup (struct ig_arena *arena, GDestroyNotify func, gpointer data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -20,23 +20,27 @@
 #include "ig_data.h"
 #include "logger.h"
 #include <stdio.h>
+#include <string.h>
 
-static struct ig_attribute *ig_attribute_new (const char *value, bool constant);
+static struct ig_attribute *ig_attribute_new (struct ig_arena *arena, const char *value, bool constant);
 static inline void          ig_attribute_free (struct ig_attribute *attr);
 static void                 ig_attribute_free_gpointer (gpointer attr);
 static const char          *ig_port_dir_name (enum ig_port_dir dir);
 
-#define IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE(PARENTPTR, QUEUE, CHILDTYPE, CHILDTOPARENT) do { \
-        if (PARENTPTR->QUEUE != NULL) { \
-            for (GList *li = PARENTPTR->QUEUE->head; li != NULL; li = li->next) { \
-                CHILDTYPE *child = (CHILDTYPE *)li->data; \
-                if (child->CHILDTOPARENT == PARENTPTR) child->CHILDTOPARENT = NULL; \
-                ig_obj_unref (IG_OBJECT (child)); \
-            } \
-            g_queue_free (PARENTPTR->QUEUE); \
+#define IG_OBJECT_ALLOC(TYPE, ARENA) \
+    ((ARENA) == NULL ? g_slice_new (TYPE) : ig_arena_new0 ((ARENA), TYPE))
+
+#define IG_OBJECT_CHILD_ARRAY_UNREF_AND_FREE(PARENTPTR, ARRAY, CHILDTYPE, CHILDTOPARENT) do { \
+        for (guint i = 0; i < ig_obj_array_len (&PARENTPTR->ARRAY); i++) { \
+            CHILDTYPE *child = (CHILDTYPE *)ig_obj_array_index (&PARENTPTR->ARRAY, i); \
+            if (child->CHILDTOPARENT == PARENTPTR) child->CHILDTOPARENT = NULL; \
+            ig_obj_unref (IG_OBJECT (child)); \
         } \
+        ig_obj_array_release (NULL, &PARENTPTR->ARRAY); \
 } while (false)
 
+#define IG_OBJ_ARRAY_ALLOC_MIN 4
+
 
 /*******************************************************
  * memory management debugging
@@ -51,20 +55,139 @@ static int ig_mman_cnt_attributes = 0;
 static int ig_mman_cnt_objects    = 0;
 #endif
 
+/*******************************************************
+ * string interning
+ *******************************************************/
+
+/* canonical strings with precomputed hash in front of the characters, released with the last database using them */
+struct ig_str_interned {
+    guint hash;
+    char  str[];
+};
+
+#define IG_STR_INTERNED(str) ((const struct ig_str_interned *)((const char *)(str) - G_STRUCT_OFFSET (struct ig_str_interned, str)))
+
+static GHashTable      *ig_str_intern_table   = NULL;
+static struct ig_arena *ig_str_intern_storage = NULL;
+static guint            ig_str_intern_users   = 0;
+
+void ig_str_intern_ref (void)
+{
+    ig_str_intern_users++;
+}
+
+void ig_str_intern_unref (void)
+{
+    if (ig_str_intern_users == 0) return;
+    if (--ig_str_intern_users > 0) return;
+    if (ig_str_intern_table == NULL) return;
+
+    g_hash_table_destroy (ig_str_intern_table);
+    ig_arena_free (ig_str_intern_storage);
+    ig_str_intern_table   = NULL;
+    ig_str_intern_storage = NULL;
+}
+
+bool ig_str_intern_clear (void)
+{
+    if (ig_str_intern_users > 1) return false;
+    if (ig_str_intern_table == NULL) return true;
+
+    g_hash_table_remove_all (ig_str_intern_table);
+    ig_arena_clear (ig_str_intern_storage);
+
+    return true;
+}
+
+const char *ig_str_intern (const char *str)
+{
+    if (str == NULL) return NULL;
+
+    if (ig_str_intern_table == NULL) {
+        ig_str_intern_table   = g_hash_table_new (g_str_hash, g_str_equal);
+        ig_str_intern_storage = ig_arena_new ();
+    }
+
+    const char *result = (const char *)g_hash_table_lookup (ig_str_intern_table, str);
+    if (result != NULL) return result;
+
+    gsize                   len      = strlen (str);
+    struct ig_str_interned *interned = (struct ig_str_interned *)ig_arena_alloc (ig_str_intern_storage, sizeof (struct ig_str_interned) + len + 1);
+
+    interned->hash = g_str_hash (str);
+    memcpy (interned->str, str, len + 1);
+
+    result = interned->str;
+    g_hash_table_insert (ig_str_intern_table, (gpointer)result, (gpointer)result);
+
+    return result;
+}
+
+const char *ig_str_intern_lookup (const char *str)
+{
+    if (str == NULL) return NULL;
+    if (ig_str_intern_table == NULL) return NULL;
+
+    return (const char *)g_hash_table_lookup (ig_str_intern_table, str);
+}
+
+guint ig_str_intern_hash (gconstpointer str)
+{
+    return IG_STR_INTERNED (str)->hash;
+}
+
 /*******************************************************
  * object data
  *******************************************************/
 
-static struct ig_attribute *ig_attribute_new (const char *value, bool constant)
+/* type string values with canonical integer or boolean representation */
+static void ig_attribute_classify (struct ig_attribute *attr)
 {
-    struct ig_attribute *result = g_slice_new (struct ig_attribute);
+    const char *value = attr->value;
+
+    attr->type = IG_ATTR_TYPE_STRING;
+
+    if ((value[0] == 't') || (value[0] == 'f')) {
+        if ((strcmp (value, "true") == 0) || (strcmp (value, "false") == 0)) {
+            attr->type             = IG_ATTR_TYPE_BOOL;
+            attr->typed.bool_value = (value[0] == 't');
+        }
+        return;
+    }
+
+    const char *digits = (value[0] == '-' ? value + 1 : value);
+    if ((digits[0] < '0') || (digits[0] > '9')) return;
+    /* no leading zeros, no "-0" */
+    if ((digits[0] == '0') && ((digits[1] != '\0') || (digits != value))) return;
+
+    int n_digits = 0;
+    for (; digits[n_digits] != '\0'; n_digits++) {
+        if ((digits[n_digits] < '0') || (digits[n_digits] > '9')) return;
+    }
+    /* larger values might not fit */
+    if (n_digits > 18) return;
+
+    attr->type            = IG_ATTR_TYPE_INT;
+    attr->typed.int_value = g_ascii_strtoll (value, NULL, 10);
+}
+
+static struct ig_attribute *ig_attribute_new (struct ig_arena *arena, const char *value, bool constant)
+{
+    struct ig_attribute *result = NULL;
+
+    if (arena != NULL) {
+        result = ig_arena_new0 (arena, struct ig_attribute);
+    } else {
+        result = g_slice_new (struct ig_attribute);
 
 #ifdef DEBUG_IG_MMAN
-    log_debug ("MManC", "memory management: created attribute - current total: %d", ++ig_mman_cnt_attributes);
+        log_debug ("MManC", "memory management: created attribute - current total: %d", ++ig_mman_cnt_attributes);
 #endif
+    }
 
     result->constant = constant;
     result->value    = value;
+    ig_attribute_classify (result);
 
     return result;
 }
@@ -73,6 +196,9 @@ static inline void ig_attribute_free (struct ig_attribute *attr)
 {
     if (attr == NULL) return;
 
+    if (attr->type == IG_ATTR_TYPE_LIST) {
+        g_free (attr->typed.list.items);
+    }
     g_slice_free (struct ig_attribute, attr);
 
 #ifdef DEBUG_IG_MMAN
@@ -106,7 +232,7 @@ const char *ig_obj_type_name (enum ig_object_type type)
     return "UNKNOWN";
 }
 
-void ig_obj_init (enum ig_object_type type, const char *name, struct ig_object *plist[], struct ig_object *obj, GStringChunk *storage)
+void ig_obj_init (enum ig_object_type type, const char *name, struct ig_object *plist[], struct ig_object *obj, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return;
     if (obj  == NULL) return;
@@ -116,28 +242,30 @@ void ig_obj_init (enum ig_object_type type, const char *name, struct ig_object *
 #endif
 
     /* id/parent */
-    GString *s_id = g_string_new (NULL);
-    s_id = g_string_append (s_id, ig_obj_type_name (type));
-    s_id = g_string_append (s_id, "##");
-
     struct ig_object *parent = NULL;
+    int               depth  = 0;
     if (plist != NULL) {
-        for (int i = 0; plist[i] != NULL; i++) {
-            struct ig_object *ip = plist[i];
-            s_id   = g_string_append (s_id, ig_obj_attr_get (ip, "name"));
-            s_id   = g_string_append (s_id, "#");
-            parent = ip;
+        for (depth = 0; plist[depth] != NULL; depth++) {
+            parent = plist[depth];
         }
     }
-    s_id = g_string_append (s_id, name);
 
     /* init */
-    log_debug ("DONew", "Creating object of type %s, name %s, parent %s", ig_obj_type_name (type), name, (parent != NULL ? parent->id : "<none>"));
+    log_debug ("DONew", "Creating object of type %s, name %s, parent %s", ig_obj_type_name (type), name, (parent != NULL ? parent->name : "<none>"));
 
-    obj->type     = type;
-    obj->refcount = 0;
+    obj->type      = type;
+    obj->handle    = 0;
+    obj->id        = NULL;
+    obj->id_parent = parent;
+    obj->id_depth  = depth;
+    obj->refcount  = 0;
+    obj->arena     = arena;
 
-    if (storage == NULL) {
+    if ((storage == NULL) && (arena != NULL)) {
+        obj->string_storage      = g_string_chunk_new (256);
+        obj->string_storage_free = false;
+        ig_arena_add_cleanup (arena, (GDestroyNotify)g_string_chunk_free, obj->string_storage);
+    } else if (storage == NULL) {
         obj->string_storage      = g_string_chunk_new (256);
         obj->string_storage_free = true;
     } else {
@@ -145,26 +273,34 @@ void ig_obj_init (enum ig_object_type type, const char *name, struct ig_object *
         obj->string_storage_free = false;
     }
 
-    obj->attributes = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, ig_attribute_free_gpointer);
+    for (int i = 0; i < IG_ATTR_SLOT_COUNT; i++) {
+        obj->attr_slots[i] = NULL;
+    }
+    obj->attr_slots_constant = 0;
+    obj->attributes          = NULL;
+    obj->epoch               = 0;
+
+    ig_obj_attr_set_static (obj, "type", ig_obj_type_name (type), true);
+    ig_obj_attr_set_static (obj, "name", ig_str_intern (name),    true);
 
-    ig_obj_attr_set (obj, "type", ig_obj_type_name (type), true);
-    ig_obj_attr_set (obj, "id",   s_id->str,               true);
-    ig_obj_attr_set (obj, "name", name,                    true);
+    /* id and parent are derived from the ID hierarchy on request */
+    obj->attr_slots_constant |= (1 << IG_ATTR_SLOT_ID);
     if (parent != NULL) {
-        ig_obj_attr_set (obj, "parent", parent->id, true);
+        obj->attr_slots_constant |= (1 << IG_ATTR_SLOT_PARENT);
     }
 
-    g_string_free (s_id, true);
-
-    obj->id   = ig_obj_attr_get (obj, "id");
     obj->name = ig_obj_attr_get (obj, "name");
 }
 
 void ig_obj_free (struct ig_object *obj)
 {
     if (obj == NULL) return;
+    /* released together with arena */
+    if (obj->arena != NULL) return;
 
-    g_hash_table_destroy (obj->attributes);
+    if (obj->attributes != NULL) {
+        g_hash_table_destroy (obj->attributes);
+    }
 
     if (obj->string_storage_free) {
         g_string_chunk_free (obj->string_storage);
@@ -200,6 +336,7 @@ void ig_obj_free_full (struct ig_object *obj)
 void ig_obj_ref (struct ig_object *obj)
 {
     if (obj == NULL) return;
+    if (obj->arena != NULL) return;
 
     obj->refcount++;
 }
@@ -207,49 +344,483 @@ void ig_obj_ref (struct ig_object *obj)
 void ig_obj_unref (struct ig_object *obj)
 {
     if (obj == NULL) return;
+    if (obj->arena != NULL) return;
 
     obj->refcount--;
     if (obj->refcount <= 0) {
-        log_debug ("DOUrf", "Freeing object %s of type %s after unref", obj->id, ig_obj_type_name (obj->type));
+        log_debug ("DOUrf", "Freeing object %s of type %s after unref", obj->name, ig_obj_type_name (obj->type));
         ig_obj_free_full (obj);
     }
 }
 
-bool ig_obj_attr_set (struct ig_object *obj, const char *name, const char *value, bool constant)
+const char *ig_obj_id (struct ig_object *obj)
+{
+    if (obj == NULL) return NULL;
+    if (obj->id != NULL) return obj->id;
+
+    GString          *s_id = g_string_new (obj->name);
+    struct ig_object *ip   = obj->id_parent;
+    for (int i = 0; i < obj->id_depth; i++) {
+        if (ip == NULL) break;
+        s_id = g_string_prepend (s_id, "#");
+        s_id = g_string_prepend (s_id, ip->name);
+        ip   = ip->id_parent;
+    }
+    s_id = g_string_prepend (s_id, "##");
+    s_id = g_string_prepend (s_id, ig_obj_type_name (obj->type));
+
+    /* unique per object: no need to deduplicate */
+    obj->id                          = g_string_chunk_insert (obj->string_storage, s_id->str);
+    obj->attr_slots[IG_ATTR_SLOT_ID] = obj->id;
+
+    g_string_free (s_id, true);
+
+    return obj->id;
+}
+
+static const char *ig_obj_attr_slot_names[IG_ATTR_SLOT_COUNT] = {
+    [IG_ATTR_SLOT_TYPE]       = "type",
+    [IG_ATTR_SLOT_ID]         = "id",
+    [IG_ATTR_SLOT_NAME]       = "name",
+    [IG_ATTR_SLOT_PARENT]     = "parent",
+    [IG_ATTR_SLOT_SIZE]       = "size",
+    [IG_ATTR_SLOT_SIGNAL]     = "signal",
+    [IG_ATTR_SLOT_DIRECTION]  = "direction",
+    [IG_ATTR_SLOT_CONNECTION] = "connection",
+    [IG_ATTR_SLOT_INVERT]     = "invert",
+    [IG_ATTR_SLOT_ADAPT]      = "adapt",
+    [IG_ATTR_SLOT_ORIGIN]     = "origin",
+};
+
+enum ig_attribute_slot ig_obj_attr_slot (const char *name)
+{
+    if (name == NULL) return IG_ATTR_SLOT_NONE;
+
+    enum ig_attribute_slot slot = IG_ATTR_SLOT_NONE;
+
+    /* preselect by first character to keep lookups of non-slot attributes cheap */
+    switch (name[0]) {
+        case 't': slot = IG_ATTR_SLOT_TYPE;       break;
+        case 'i': slot = (name[1] == 'd' ? IG_ATTR_SLOT_ID : IG_ATTR_SLOT_INVERT); break;
+        case 'n': slot = IG_ATTR_SLOT_NAME;       break;
+        case 'p': slot = IG_ATTR_SLOT_PARENT;     break;
+        case 's': slot = (name[1] == 'i' && name[2] == 'z' ? IG_ATTR_SLOT_SIZE : IG_ATTR_SLOT_SIGNAL); break;
+        case 'd': slot = IG_ATTR_SLOT_DIRECTION;  break;
+        case 'c': slot = IG_ATTR_SLOT_CONNECTION; break;
+        case 'a': slot = IG_ATTR_SLOT_ADAPT;      break;
+        case 'o': slot = IG_ATTR_SLOT_ORIGIN;     break;
+        default:  return IG_ATTR_SLOT_NONE;
+    }
+
+    if (strcmp (name, ig_obj_attr_slot_names[slot]) != 0) return IG_ATTR_SLOT_NONE;
+
+    return slot;
+}
+
+/* attribute table of object with interned names as keys, created on first use */
+static GHashTable *ig_obj_attr_table (struct ig_object *obj)
+{
+    if (obj->attributes == NULL) {
+        if (obj->arena == NULL) {
+            obj->attributes = g_hash_table_new_full (ig_str_intern_hash, g_direct_equal, NULL, ig_attribute_free_gpointer);
+        } else {
+            obj->attributes = g_hash_table_new (ig_str_intern_hash, g_direct_equal);
+            ig_arena_add_cleanup (obj->arena, (GDestroyNotify)g_hash_table_destroy, obj->attributes);
+        }
+    }
+
+    return obj->attributes;
+}
+
+/* transition from shared attribute table to table with attribute added */
+struct ig_attr_proto_key {
+    GHashTable *base;     /* table before or NULL if no attributes set */
+    const char *name;     /* interned */
+    const char *value;    /* deduplicated in string storage */
+    bool        constant;
+    bool        list;
+};
+
+static guint ig_attr_proto_key_hash (gconstpointer key)
+{
+    const struct ig_attr_proto_key *pkey = (const struct ig_attr_proto_key *)key;
+
+    guint result = g_direct_hash (pkey->base);
+    result = (result * 31) + ig_str_intern_hash (pkey->name);
+    result = (result * 31) + g_direct_hash (pkey->value);
+    result = (result * 31) + (pkey->constant ? 1 : 0);
+    result = (result * 31) + (pkey->list ? 1 : 0);
+
+    return result;
+}
+
+static gboolean ig_attr_proto_key_equal (gconstpointer a, gconstpointer b)
+{
+    const struct ig_attr_proto_key *key_a = (const struct ig_attr_proto_key *)a;
+    const struct ig_attr_proto_key *key_b = (const struct ig_attr_proto_key *)b;
+
+    return ((key_a->base == key_b->base) && (key_a->name == key_b->name) && (key_a->value == key_b->value)
+            && (key_a->constant == key_b->constant) && (key_a->list == key_b->list));
+}
+
+struct ig_attr_protos *ig_attr_protos_new (struct ig_arena *arena)
+{
+    if (arena == NULL) return NULL;
+
+    struct ig_attr_protos *protos = ig_arena_new0 (arena, struct ig_attr_protos);
+
+    protos->transitions = g_hash_table_new (ig_attr_proto_key_hash, ig_attr_proto_key_equal);
+    protos->uses        = g_hash_table_new (g_direct_hash, g_direct_equal);
+    protos->owned       = g_hash_table_new (g_direct_hash, g_direct_equal);
+    protos->arena       = arena;
+    ig_arena_add_cleanup (arena, (GDestroyNotify)g_hash_table_destroy, protos->transitions);
+    ig_arena_add_cleanup (arena, (GDestroyNotify)g_hash_table_destroy, protos->uses);
+    ig_arena_add_cleanup (arena, (GDestroyNotify)g_hash_table_destroy, protos->owned);
+
+    return protos;
+}
+
+void ig_attr_protos_freeze (struct ig_attr_protos *protos)
+{
+    if (protos == NULL) return;
+
+    g_hash_table_remove_all (protos->owned);
+}
+
+/* new table in prototype arena with entries of base */
+static GHashTable *ig_attr_protos_table_new (struct ig_attr_protos *protos, GHashTable *base)
+{
+    GHashTable *table = g_hash_table_new (ig_str_intern_hash, g_direct_equal);
+    ig_arena_add_cleanup (protos->arena, (GDestroyNotify)g_hash_table_destroy, table);
+
+    if (base != NULL) {
+        GHashTableIter iter;
+        gpointer       i_name, i_value;
+
+        g_hash_table_iter_init (&iter, base);
+        while (g_hash_table_iter_next (&iter, &i_name, &i_value)) {
+            g_hash_table_insert (table, i_name, i_value);
+        }
+    }
+
+    return table;
+}
+
+/* prototypes used by object or NULL if object owns its attribute table */
+static struct ig_attr_protos *ig_obj_attr_protos (const struct ig_object *obj)
+{
+    const struct ig_module *module = NULL;
+
+    if (obj->type == IG_OBJ_INSTANCE) {
+        module = ((const struct ig_instance *)obj)->module;
+    } else if (obj->type == IG_OBJ_PIN) {
+        const struct ig_instance *inst = ((const struct ig_pin *)obj)->parent;
+        if (inst != NULL) module = inst->module;
+    }
+
+    if (module == NULL) return NULL;
+
+    return module->attr_protos;
+}
+
+/* set non-slot attribute of object with shared table: switch to table containing the new value */
+static bool ig_obj_attr_store_proto (struct ig_object *obj, struct ig_attr_protos *protos, const char *name, const char *value, bool constant, bool is_static, struct ig_attribute **entry)
+{
+    if (obj->attributes != NULL) {
+        struct ig_attribute *old_val = (struct ig_attribute *)g_hash_table_lookup (obj->attributes, name);
+        if ((old_val != NULL) && (old_val->constant)) return false;
+    }
+
+    if (!is_static) {
+        value = g_string_chunk_insert_const (obj->string_storage, value);
+    }
+
+    GHashTable *base = obj->attributes;
+
+    /* private table: no other object references it */
+    if ((base != NULL) && (g_hash_table_lookup (protos->owned, base) == obj)) {
+        struct ig_attribute *value_entry = ig_attribute_new (protos->arena, value, constant);
+        g_hash_table_insert (base, (gpointer)name, value_entry);
+
+        if (entry != NULL) *entry = value_entry;
+        return true;
+    }
+
+    /* only the list setter requests the entry to add typed items */
+    struct ig_attr_proto_key key = {base, name, value, constant, (entry != NULL)};
+
+    GHashTable *proto = (GHashTable *)g_hash_table_lookup (protos->transitions, &key);
+
+    if (proto != NULL) {
+        guint uses = GPOINTER_TO_UINT (g_hash_table_lookup (protos->uses, proto));
+        g_hash_table_insert (protos->uses, proto, GUINT_TO_POINTER (uses + 1));
+
+        obj->attributes = proto;
+        return true;
+    }
+
+    struct ig_attribute *value_entry = ig_attribute_new (protos->arena, value, constant);
+    proto = ig_attr_protos_table_new (protos, base);
+    g_hash_table_insert (proto, (gpointer)name, value_entry);
+
+    if ((base != NULL) && (GPOINTER_TO_UINT (g_hash_table_lookup (protos->uses, base)) == 1)) {
+        /* diverging from a table no other object reached: further attributes are unlikely shared */
+        g_hash_table_insert (protos->owned, proto, obj);
+    } else {
+        struct ig_attr_proto_key *l_key = ig_arena_new0 (protos->arena, struct ig_attr_proto_key);
+        *l_key = key;
+        g_hash_table_insert (protos->transitions, l_key, proto);
+        g_hash_table_insert (protos->uses, proto, GUINT_TO_POINTER (1));
+    }
+
+    if (entry != NULL) *entry = value_entry;
+
+    obj->attributes = proto;
+
+    return true;
+}
+
+/*
+ * store attribute value, value is copied to string storage of object unless static,
+ * returns entry of non-slot attributes or NULL for slot attributes and already typed shared entries
+ */
+static bool ig_obj_attr_store (struct ig_object *obj, const char *name, const char *value, bool constant, bool is_static, struct ig_attribute **entry)
 {
     if (obj == NULL) return false;
     if (name == NULL) return false;
     if (value == NULL) return false;
 
-    struct ig_attribute *old_val = (struct ig_attribute *)g_hash_table_lookup (obj->attributes, name);
+    if (entry != NULL) *entry = NULL;
+
+    enum ig_attribute_slot slot = ig_obj_attr_slot (name);
+
+    if (slot != IG_ATTR_SLOT_NONE) {
+        if (obj->attr_slots_constant & (1 << slot)) return false;
+
+        obj->attr_slots[slot] = (is_static ? value : g_string_chunk_insert_const (obj->string_storage, value));
+        if (constant) {
+            obj->attr_slots_constant |= (1 << slot);
+        }
+
+        return true;
+    }
+
+    name = ig_str_intern (name);
+
+    struct ig_attr_protos *protos = ig_obj_attr_protos (obj);
+    if (protos != NULL) return ig_obj_attr_store_proto (obj, protos, name, value, constant, is_static, entry);
+
+    struct ig_attribute *old_val = (struct ig_attribute *)g_hash_table_lookup (ig_obj_attr_table (obj), name);
 
     if ((old_val != NULL) && (old_val->constant)) return false;
 
-    char                *local_name         = g_string_chunk_insert_const (obj->string_storage, name);
-    char                *local_value_string = g_string_chunk_insert_const (obj->string_storage, value);
-    struct ig_attribute *value_entry        = ig_attribute_new (local_value_string, constant);
+    if (!is_static) {
+        value = g_string_chunk_insert_const (obj->string_storage, value);
+    }
+    struct ig_attribute *value_entry = ig_attribute_new (obj->arena, value, constant);
+
+    g_hash_table_insert (obj->attributes, (gpointer)name, value_entry);
+
+    if (entry != NULL) *entry = value_entry;
+
+    return true;
+}
+
+bool ig_obj_attr_set (struct ig_object *obj, const char *name, const char *value, bool constant)
+{
+    return ig_obj_attr_store (obj, name, value, constant, false, NULL);
+}
+
+bool ig_obj_attr_set_static (struct ig_object *obj, const char *name, const char *value, bool constant)
+{
+    return ig_obj_attr_store (obj, name, value, constant, true, NULL);
+}
+
+bool ig_obj_attr_set_int (struct ig_object *obj, const char *name, gint64 value, bool constant)
+{
+    char value_string[24];
+
+    g_snprintf (value_string, sizeof (value_string), "%" G_GINT64_FORMAT, value);
 
-    g_hash_table_insert (obj->attributes, local_name, value_entry);
+    return ig_obj_attr_store (obj, name, value_string, constant, false, NULL);
+}
+
+bool ig_obj_attr_set_bool (struct ig_object *obj, const char *name, bool value, bool constant)
+{
+    return ig_obj_attr_store (obj, name, (value ? "true" : "false"), constant, false, NULL);
+}
+
+bool ig_obj_attr_set_list (struct ig_object *obj, const char *name, const char *value, const char *const *items, guint len, bool constant)
+{
+    if ((items == NULL) && (len > 0)) return false;
+
+    struct ig_attribute *entry = NULL;
+
+    if (!ig_obj_attr_store (obj, name, value, constant, false, &entry)) return false;
+    if (entry == NULL) return true;
+
+    const char **local_items = NULL;
+    if (len > 0) {
+        if (obj->arena != NULL) {
+            local_items = (const char **)ig_arena_alloc (obj->arena, len * sizeof (const char *));
+        } else {
+            local_items = g_new (const char *, len);
+        }
+    }
+    for (guint i = 0; i < len; i++) {
+        local_items[i] = g_string_chunk_insert_const (obj->string_storage, items[i]);
+    }
+
+    entry->type             = IG_ATTR_TYPE_LIST;
+    entry->typed.list.items = local_items;
+    entry->typed.list.len   = len;
 
     return true;
 }
 
+void ig_obj_attr_share (struct ig_object *obj, const struct ig_object *original)
+{
+    if (obj == NULL) return;
+    if (original == NULL) return;
+    if (original->attributes == NULL) return;
+    /* reference counted objects free their attribute entries */
+    if (obj->arena == NULL) return;
+
+    /* shared tables are never modified */
+    if (ig_obj_attr_protos (original) != NULL) {
+        obj->attributes = original->attributes;
+        return;
+    }
+
+    GHashTable    *table = ig_obj_attr_table (obj);
+    GHashTableIter iter;
+    gpointer       key, value;
+
+    g_hash_table_iter_init (&iter, original->attributes);
+    while (g_hash_table_iter_next (&iter, &key, &value)) {
+        g_hash_table_insert (table, key, value);
+    }
+}
+
+static inline const char *ig_obj_attr_slot_value (struct ig_object *obj, enum ig_attribute_slot slot)
+{
+    if (obj->attr_slots[slot] != NULL) return obj->attr_slots[slot];
+
+    if (slot == IG_ATTR_SLOT_ID)     return ig_obj_id (obj);
+    if (slot == IG_ATTR_SLOT_PARENT) return ig_obj_id (obj->id_parent);
+
+    return NULL;
+}
+
 const char *ig_obj_attr_get (struct ig_object *obj, const char *name)
 {
     if (obj == NULL) return NULL;
     if (name == NULL) return NULL;
 
-    struct ig_attribute *value = (struct ig_attribute *)g_hash_table_lookup (obj->attributes, name);
+    enum ig_attribute_slot slot = ig_obj_attr_slot (name);
+
+    if (slot != IG_ATTR_SLOT_NONE) return ig_obj_attr_slot_value (obj, slot);
+
+    if (obj->attributes == NULL) return NULL;
+
+    /* attributes never set on any object are not interned */
+    const char *key = ig_str_intern_lookup (name);
+    if (key == NULL) return NULL;
+
+    struct ig_attribute *value = (struct ig_attribute *)g_hash_table_lookup (obj->attributes, key);
 
     if (value == NULL) return NULL;
     return value->value;
 }
 
+bool ig_obj_attr_get_typed (struct ig_object *obj, const char *name, struct ig_attribute *attr)
+{
+    if (obj == NULL) return false;
+    if (name == NULL) return false;
+    if (attr == NULL) return false;
+
+    enum ig_attribute_slot slot = ig_obj_attr_slot (name);
+
+    if (slot != IG_ATTR_SLOT_NONE) {
+        const char *value = ig_obj_attr_slot_value (obj, slot);
+        if (value == NULL) return false;
+
+        /* slots store strings only */
+        attr->constant = (obj->attr_slots_constant & (1 << slot));
+        attr->value    = value;
+        ig_attribute_classify (attr);
+
+        return true;
+    }
+
+    if (obj->attributes == NULL) return false;
+
+    const char *key = ig_str_intern_lookup (name);
+    if (key == NULL) return false;
+
+    struct ig_attribute *entry = (struct ig_attribute *)g_hash_table_lookup (obj->attributes, key);
+    if (entry == NULL) return false;
+
+    *attr = *entry;
+
+    return true;
+}
+
+bool ig_obj_attr_get_int (struct ig_object *obj, const char *name, gint64 *value)
+{
+    struct ig_attribute attr;
+
+    if (!ig_obj_attr_get_typed (obj, name, &attr)) return false;
+    if (attr.type != IG_ATTR_TYPE_INT) return false;
+
+    if (value != NULL) *value = attr.typed.int_value;
+
+    return true;
+}
+
+bool ig_obj_attr_get_bool (struct ig_object *obj, const char *name, bool *value)
+{
+    struct ig_attribute attr;
+
+    if (!ig_obj_attr_get_typed (obj, name, &attr)) return false;
+    if (attr.type != IG_ATTR_TYPE_BOOL) return false;
+
+    if (value != NULL) *value = attr.typed.bool_value;
+
+    return true;
+}
+
+bool ig_obj_attr_get_list (struct ig_object *obj, const char *name, const char *const **items, guint *len)
+{
+    struct ig_attribute attr;
+
+    if (!ig_obj_attr_get_typed (obj, name, &attr)) return false;
+    if (attr.type != IG_ATTR_TYPE_LIST) return false;
+
+    if (items != NULL) *items = attr.typed.list.items;
+    if (len != NULL)   *len   = attr.typed.list.len;
+
+    return true;
+}
+
 GList *ig_obj_attr_get_keys (struct ig_object *obj)
 {
     if (obj == NULL) return NULL;
 
-    return g_hash_table_get_keys (obj->attributes);
+    GList *result = NULL;
+
+    if (obj->attributes != NULL) {
+        result = g_hash_table_get_keys (obj->attributes);
+    }
+
+    for (int i = IG_ATTR_SLOT_COUNT-1; i >= 0; i--) {
+        if ((obj->attr_slots[i] != NULL) || (i == IG_ATTR_SLOT_ID)
+            || ((i == IG_ATTR_SLOT_PARENT) && (obj->id_parent != NULL))) {
+            result = g_list_prepend (result, (gpointer)ig_obj_attr_slot_names[i]);
+        }
+    }
+
+    return result;
 }
 
 bool ig_obj_attr_set_from_gslist (struct ig_object *obj, GList *list)
@@ -277,6 +848,47 @@ bool ig_obj_attr_set_from_gslist (struct ig_object *obj, GList *list)
     return result;
 }
 
+static void ig_obj_array_init (struct ig_obj_array *array)
+{
+    array->pdata = NULL;
+    array->len   = 0;
+    array->alloc = 0;
+}
+
+void ig_obj_array_add (struct ig_arena *arena, struct ig_obj_array *array, gpointer data)
+{
+    if (array == NULL) return;
+
+    if (array->len == array->alloc) {
+        guint new_alloc = (array->alloc == 0 ? IG_OBJ_ARRAY_ALLOC_MIN : 2 * array->alloc);
+
+        if (arena == NULL) {
+            array->pdata = g_renew (gpointer, array->pdata, new_alloc);
+        } else {
+            /* previous storage stays in arena until it is cleared */
+            gpointer *new_pdata = (gpointer *)ig_arena_alloc (arena, new_alloc * sizeof (gpointer));
+            if (array->len > 0) {
+                memcpy (new_pdata, array->pdata, array->len * sizeof (gpointer));
+            }
+            array->pdata = new_pdata;
+        }
+        array->alloc = new_alloc;
+    }
+
+    array->pdata[array->len++] = data;
+}
+
+void ig_obj_array_release (struct ig_arena *arena, struct ig_obj_array *array)
+{
+    if (array == NULL) return;
+
+    if (arena == NULL) {
+        g_free (array->pdata);
+    }
+
+    ig_obj_array_init (array);
+}
+
 static const char *ig_port_dir_name (enum ig_port_dir dir)
 {
     switch (dir) {
@@ -292,14 +904,14 @@ static const char *ig_port_dir_name (enum ig_port_dir dir)
  * port data
  *******************************************************/
 
-struct ig_port *ig_port_new (const char *name, enum ig_port_dir dir, struct ig_module *parent, GStringChunk *storage)
+struct ig_port *ig_port_new (const char *name, enum ig_port_dir dir, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
 
-    struct ig_port   *port     = g_slice_new (struct ig_port);
+    struct ig_port   *port     = IG_OBJECT_ALLOC (struct ig_port, arena);
     struct ig_object *plist[2] = {IG_OBJECT (parent), NULL};
-    ig_obj_init (IG_OBJ_PORT, name, plist, IG_OBJECT (port), storage);
+    ig_obj_init (IG_OBJ_PORT, name, plist, IG_OBJECT (port), storage, arena);
 
     ig_obj_attr_set (IG_OBJECT (port), "direction", ig_port_dir_name (dir), true);
 
@@ -313,6 +925,7 @@ struct ig_port *ig_port_new (const char *name, enum ig_port_dir dir, struct ig_m
 void ig_port_free (struct ig_port *port)
 {
     if (port == NULL) return;
+    if (IG_OBJECT (port)->arena != NULL) return;
 
     ig_obj_free (IG_OBJECT (port));
     g_slice_free (struct ig_port, port);
@@ -322,18 +935,18 @@ void ig_port_free (struct ig_port *port)
  * parameter data
  *******************************************************/
 
-struct ig_param *ig_param_new (const char *name, const char *value, bool local, struct ig_module *parent, GStringChunk *storage)
+struct ig_param *ig_param_new (const char *name, const char *value, bool local, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
     if (value == NULL) return NULL;
 
-    struct ig_param  *param    = g_slice_new (struct ig_param);
+    struct ig_param  *param    = IG_OBJECT_ALLOC (struct ig_param, arena);
     struct ig_object *plist[2] = {IG_OBJECT (parent), NULL};
-    ig_obj_init (IG_OBJ_PARAMETER, name, plist, IG_OBJECT (param), storage);
+    ig_obj_init (IG_OBJ_PARAMETER, name, plist, IG_OBJECT (param), storage, arena);
 
     ig_obj_attr_set (IG_OBJECT (param), "value",  value, true);
-    ig_obj_attr_set (IG_OBJECT (param), "local",  (local ? "true" : "false"), true);
+    ig_obj_attr_set_bool (IG_OBJECT (param), "local",  local, true);
 
     param->value   = ig_obj_attr_get (IG_OBJECT (param), "value");
     param->local   = local;
@@ -346,6 +959,7 @@ struct ig_param *ig_param_new (const char *name, const char *value, bool local,
 void ig_param_free (struct ig_param *param)
 {
     if (param == NULL) return;
+    if (IG_OBJECT (param)->arena != NULL) return;
 
     ig_obj_free (IG_OBJECT (param));
     g_slice_free (struct ig_param, param);
@@ -356,16 +970,16 @@ void ig_param_free (struct ig_param *param)
  * declaration data
  *******************************************************/
 
-struct ig_decl *ig_decl_new (const char *name, const char *assign, bool default_type, struct ig_module *parent, GStringChunk *storage)
+struct ig_decl *ig_decl_new (const char *name, const char *assign, bool default_type, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
 
-    struct ig_decl   *decl     = g_slice_new (struct ig_decl);
+    struct ig_decl   *decl     = IG_OBJECT_ALLOC (struct ig_decl, arena);
     struct ig_object *plist[2] = {IG_OBJECT (parent), NULL};
-    ig_obj_init (IG_OBJ_DECLARATION, name, plist, IG_OBJECT (decl), storage);
+    ig_obj_init (IG_OBJ_DECLARATION, name, plist, IG_OBJECT (decl), storage, arena);
 
-    ig_obj_attr_set (IG_OBJECT (decl), "default_type", (default_type ? "true" : "false"), true);
+    ig_obj_attr_set_bool (IG_OBJECT (decl), "default_type", default_type, true);
     if (assign != NULL) ig_obj_attr_set (IG_OBJECT (decl), "assign", assign, true);
 
     decl->default_assignment = ig_obj_attr_get (IG_OBJECT (decl), "assign");
@@ -379,6 +993,7 @@ struct ig_decl *ig_decl_new (const char *name, const char *assign, bool default_
 void ig_decl_free (struct ig_decl *decl)
 {
     if (decl == NULL) return;
+    if (IG_OBJECT (decl)->arena != NULL) return;
 
     ig_obj_free (IG_OBJECT (decl));
     g_slice_free (struct ig_decl, decl);
@@ -388,7 +1003,7 @@ void ig_decl_free (struct ig_decl *decl)
  * codesection data
  *******************************************************/
 
-struct ig_code *ig_code_new (const char *name, const char *codesection, struct ig_module *parent, GStringChunk *storage)
+struct ig_code *ig_code_new (const char *name, const char *codesection, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (codesection == NULL) return NULL;
     if (parent == NULL) return NULL;
@@ -399,14 +1014,14 @@ struct ig_code *ig_code_new (const char *name, const char *codesection, struct i
 
     GString *s_name = g_string_new (NULL);
     if (name == NULL) {
-        g_string_printf (s_name, "_cs_%d", g_queue_get_length (parent->code));
+        g_string_printf (s_name, "_cs_%d", ig_obj_array_len (&parent->code));
     } else {
         s_name = g_string_append (s_name, name);
     }
 
-    struct ig_code   *code     = g_slice_new (struct ig_code);
+    struct ig_code   *code     = IG_OBJECT_ALLOC (struct ig_code, arena);
     struct ig_object *plist[2] = {IG_OBJECT (parent), NULL};
-    ig_obj_init (IG_OBJ_CODESECTION, s_name->str, plist, IG_OBJECT (code), storage);
+    ig_obj_init (IG_OBJ_CODESECTION, s_name->str, plist, IG_OBJECT (code), storage, arena);
 
     ig_obj_attr_set (IG_OBJECT (code), "code",   codesection,        true);
 
@@ -421,6 +1036,7 @@ struct ig_code *ig_code_new (const char *name, const char *codesection, struct i
 void ig_code_free (struct ig_code *code)
 {
     if (code == NULL) return;
+    if (IG_OBJECT (code)->arena != NULL) return;
 
     ig_obj_free (IG_OBJECT (code));
     g_slice_free (struct ig_code, code);
@@ -430,14 +1046,14 @@ void ig_code_free (struct ig_code *code)
  * regfile data
  *******************************************************/
 
-struct ig_rf_reg *ig_rf_reg_new (const char *name, struct ig_rf_entry *parent, GStringChunk *storage)
+struct ig_rf_reg *ig_rf_reg_new (const char *name, struct ig_rf_entry *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
 
-    struct ig_rf_reg *reg      = g_slice_new (struct ig_rf_reg);
+    struct ig_rf_reg *reg      = IG_OBJECT_ALLOC (struct ig_rf_reg, arena);
     struct ig_object *plist[4] = {IG_OBJECT (parent->parent->parent), IG_OBJECT (parent->parent), IG_OBJECT (parent), NULL};
-    ig_obj_init (IG_OBJ_REGFILE_REG, name, plist, IG_OBJECT (reg), storage);
+    ig_obj_init (IG_OBJ_REGFILE_REG, name, plist, IG_OBJECT (reg), storage, arena);
 
     reg->parent = parent;
 
@@ -447,22 +1063,23 @@ struct ig_rf_reg *ig_rf_reg_new (const char *name, struct ig_rf_entry *parent, G
 void ig_rf_reg_free (struct ig_rf_reg *reg)
 {
     if (reg == NULL) return;
+    if (IG_OBJECT (reg)->arena != NULL) return;
 
     ig_obj_free (IG_OBJECT (reg));
     g_slice_free (struct ig_rf_reg, reg);
 }
 
-struct ig_rf_entry *ig_rf_entry_new (const char *name, struct ig_rf_regfile *parent, GStringChunk *storage)
+struct ig_rf_entry *ig_rf_entry_new (const char *name, struct ig_rf_regfile *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
 
-    struct ig_rf_entry *entry    = g_slice_new (struct ig_rf_entry);
+    struct ig_rf_entry *entry    = IG_OBJECT_ALLOC (struct ig_rf_entry, arena);
     struct ig_object   *plist[3] = {IG_OBJECT (parent->parent), IG_OBJECT (parent), NULL};
-    ig_obj_init (IG_OBJ_REGFILE_ENTRY, name, plist, IG_OBJECT (entry), storage);
+    ig_obj_init (IG_OBJ_REGFILE_ENTRY, name, plist, IG_OBJECT (entry), storage, arena);
 
     entry->parent = parent;
-    entry->regs   = g_queue_new ();
+    ig_obj_array_init (&entry->regs);
 
     return entry;
 }
@@ -470,15 +1087,16 @@ struct ig_rf_entry *ig_rf_entry_new (const char *name, struct ig_rf_regfile *par
 void ig_rf_entry_free (struct ig_rf_entry *entry)
 {
     if (entry == NULL) return;
+    if (IG_OBJECT (entry)->arena != NULL) return;
 
     ig_obj_free (IG_OBJECT (entry));
 
-    IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (entry, regs, struct ig_rf_reg, parent);
+    IG_OBJECT_CHILD_ARRAY_UNREF_AND_FREE (entry, regs, struct ig_rf_reg, parent);
 
     g_slice_free (struct ig_rf_entry, entry);
 }
 
-struct ig_rf_regfile *ig_rf_regfile_new (const char *name, struct ig_module *parent, GStringChunk *storage)
+struct ig_rf_regfile *ig_rf_regfile_new (const char *name, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
@@ -487,12 +1105,12 @@ struct ig_rf_regfile *ig_rf_regfile_new (const char *name, struct ig_module *par
         return NULL;
     }
 
-    struct ig_rf_regfile *regfile  = g_slice_new (struct ig_rf_regfile);
+    struct ig_rf_regfile *regfile  = IG_OBJECT_ALLOC (struct ig_rf_regfile, arena);
     struct ig_object     *plist[2] = {IG_OBJECT (parent), NULL};
-    ig_obj_init (IG_OBJ_REGFILE, name, plist, IG_OBJECT (regfile), storage);
+    ig_obj_init (IG_OBJ_REGFILE, name, plist, IG_OBJECT (regfile), storage, arena);
 
     regfile->parent  = parent;
-    regfile->entries = g_queue_new ();
+    ig_obj_array_init (&regfile->entries);
 
     return regfile;
 }
@@ -500,10 +1118,11 @@ struct ig_rf_regfile *ig_rf_regfile_new (const char *name, struct ig_module *par
 void ig_rf_regfile_free (struct ig_rf_regfile *regfile)
 {
     if (regfile == NULL) return;
+    if (IG_OBJECT (regfile)->arena != NULL) return;
 
     ig_obj_free (IG_OBJECT (regfile));
 
-    IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (regfile, entries, struct ig_rf_entry, parent);
+    IG_OBJECT_CHILD_ARRAY_UNREF_AND_FREE (regfile, entries, struct ig_rf_entry, parent);
 
     g_slice_free (struct ig_rf_regfile, regfile);
 }
@@ -512,39 +1131,38 @@ void ig_rf_regfile_free (struct ig_rf_regfile *regfile)
  * module data
  *******************************************************/
 
-struct ig_module *ig_module_new (const char *name, bool ilm, bool resource, GStringChunk *storage)
+struct ig_module *ig_module_new (const char *name, bool ilm, bool resource, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     log_debug ("DMNew", "Generating module %s", name);
 
-    struct ig_module *module   = g_slice_new (struct ig_module);
+    struct ig_module *module   = IG_OBJECT_ALLOC (struct ig_module, arena);
     struct ig_object *plist[1] = {NULL};
-    ig_obj_init (IG_OBJ_MODULE, name, plist, IG_OBJECT (module), storage);
+    ig_obj_init (IG_OBJ_MODULE, name, plist, IG_OBJECT (module), storage, arena);
 
-    ig_obj_attr_set (IG_OBJECT (module), "ilm",      (ilm      ? "true" : "false"), true);
-    ig_obj_attr_set (IG_OBJECT (module), "resource", (resource ? "true" : "false"), true);
+    ig_obj_attr_set_bool (IG_OBJECT (module), "ilm",      ilm,      true);
+    ig_obj_attr_set_bool (IG_OBJECT (module), "resource", resource, true);
 
     module->ilm      = ilm;
     module->resource = resource;
 
-    module->params        = g_queue_new ();
-    module->ports         = g_queue_new ();
-    module->mod_instances = g_queue_new ();
+    /* resource modules are instanciated many times with mostly equal attributes */
+    module->attr_protos = (resource ? ig_attr_protos_new (arena) : NULL);
+
+    ig_obj_array_init (&module->params);
+    ig_obj_array_init (&module->ports);
+    ig_obj_array_init (&module->mod_instances);
+    ig_obj_array_init (&module->decls);
+    ig_obj_array_init (&module->code);
+    ig_obj_array_init (&module->child_instances);
+    ig_obj_array_init (&module->regfiles);
 
     if (resource) {
-        module->decls            = NULL;
-        module->code             = NULL;
-        module->child_instances  = NULL;
-        module->regfiles         = NULL;
         module->default_instance = NULL;
     } else {
-        module->decls            = g_queue_new ();
-        module->code             = g_queue_new ();
-        module->child_instances  = g_queue_new ();
-        module->regfiles         = g_queue_new ();
-        module->default_instance = ig_instance_new (name, module, NULL, storage);
+        module->default_instance = ig_instance_new (name, module, NULL, storage, arena);
 
-        g_queue_push_tail (module->mod_instances, module->default_instance);
+        ig_obj_array_add (arena, &module->mod_instances, module->default_instance);
         ig_obj_ref (IG_OBJECT (module->default_instance));
     }
 
@@ -554,6 +1172,7 @@ struct ig_module *ig_module_new (const char *name, bool ilm, bool resource, GStr
 void ig_module_free (struct ig_module *module)
 {
     if (module == NULL) return;
+    if (IG_OBJECT (module)->arena != NULL) return;
 
     if (!module->resource) {
         if (module->default_instance != NULL) {
@@ -565,13 +1184,13 @@ void ig_module_free (struct ig_module *module)
 
     ig_obj_free (IG_OBJECT (module));
 
-    IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (module, params,          struct ig_param,      parent);
-    IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (module, ports,           struct ig_port,       parent);
-    IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (module, mod_instances,   struct ig_instance,   module);
-    IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (module, decls,           struct ig_decl,       parent);
-    IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (module, code,            struct ig_code,       parent);
-    IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (module, child_instances, struct ig_instance,   parent);
-    IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (module, regfiles,        struct ig_rf_regfile, parent);
+    IG_OBJECT_CHILD_ARRAY_UNREF_AND_FREE (module, params,          struct ig_param,      parent);
+    IG_OBJECT_CHILD_ARRAY_UNREF_AND_FREE (module, ports,           struct ig_port,       parent);
+    IG_OBJECT_CHILD_ARRAY_UNREF_AND_FREE (module, mod_instances,   struct ig_instance,   module);
+    IG_OBJECT_CHILD_ARRAY_UNREF_AND_FREE (module, decls,           struct ig_decl,       parent);
+    IG_OBJECT_CHILD_ARRAY_UNREF_AND_FREE (module, code,            struct ig_code,       parent);
+    IG_OBJECT_CHILD_ARRAY_UNREF_AND_FREE (module, child_instances, struct ig_instance,   parent);
+    IG_OBJECT_CHILD_ARRAY_UNREF_AND_FREE (module, regfiles,        struct ig_rf_regfile, parent);
 
     g_slice_free (struct ig_module, module);
 }
@@ -581,15 +1200,15 @@ void ig_module_free (struct ig_module *module)
  * pin data
  *******************************************************/
 
-struct ig_pin *ig_pin_new (const char *name, const char *connection, struct ig_instance *parent, GStringChunk *storage)
+struct ig_pin *ig_pin_new (const char *name, const char *connection, struct ig_instance *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (connection == NULL) return NULL;
     if (parent == NULL) return NULL;
 
-    struct ig_pin    *pin      = g_slice_new (struct ig_pin);
+    struct ig_pin    *pin      = IG_OBJECT_ALLOC (struct ig_pin, arena);
     struct ig_object *plist[2] = {IG_OBJECT (parent), NULL};
-    ig_obj_init (IG_OBJ_PIN, name, plist, IG_OBJECT (pin), storage);
+    ig_obj_init (IG_OBJ_PIN, name, plist, IG_OBJECT (pin), storage, arena);
 
     ig_obj_attr_set (IG_OBJECT (pin), "connection", connection, true);
 
@@ -603,6 +1222,7 @@ struct ig_pin *ig_pin_new (const char *name, const char *connection, struct ig_i
 void ig_pin_free (struct ig_pin *pin)
 {
     if (pin == NULL) return;
+    if (IG_OBJECT (pin)->arena != NULL) return;
 
     ig_obj_free (IG_OBJECT (pin));
     g_slice_free (struct ig_pin, pin);
@@ -613,15 +1233,15 @@ void ig_pin_free (struct ig_pin *pin)
  * adjustment data
  *******************************************************/
 
-struct ig_adjustment *ig_adjustment_new (const char *name, const char *value, struct ig_instance *parent, GStringChunk *storage)
+struct ig_adjustment *ig_adjustment_new (const char *name, const char *value, struct ig_instance *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
     if (value == NULL) return NULL;
 
-    struct ig_adjustment *adjustment = g_slice_new (struct ig_adjustment);
+    struct ig_adjustment *adjustment = IG_OBJECT_ALLOC (struct ig_adjustment, arena);
     struct ig_object     *plist[2]   = {IG_OBJECT (parent), NULL};
-    ig_obj_init (IG_OBJ_ADJUSTMENT, name, plist, IG_OBJECT (adjustment), storage);
+    ig_obj_init (IG_OBJ_ADJUSTMENT, name, plist, IG_OBJECT (adjustment), storage, arena);
 
     ig_obj_attr_set (IG_OBJECT (adjustment), "value",  value, true);
 
@@ -635,6 +1255,7 @@ struct ig_adjustment *ig_adjustment_new (const char *name, const char *value, st
 void ig_adjustment_free (struct ig_adjustment *adjustment)
 {
     if (adjustment == NULL) return;
+    if (IG_OBJECT (adjustment)->arena != NULL) return;
 
     ig_obj_free (IG_OBJECT (adjustment));
     g_slice_free (struct ig_adjustment, adjustment);
@@ -645,7 +1266,7 @@ void ig_adjustment_free (struct ig_adjustment *adjustment)
  * instance data
  *******************************************************/
 
-struct ig_instance *ig_instance_new (const char *name, struct ig_module *module, struct ig_module *parent, GStringChunk *storage)
+struct ig_instance *ig_instance_new (const char *name, struct ig_module *module, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (module == NULL) return NULL;
@@ -656,17 +1277,18 @@ struct ig_instance *ig_instance_new (const char *name, struct ig_module *module,
         return NULL;
     }
 
-    struct ig_instance *instance = g_slice_new (struct ig_instance);
+    struct ig_instance *instance = IG_OBJECT_ALLOC (struct ig_instance, arena);
     struct ig_object   *plist[2] = {(parent == NULL ? NULL : IG_OBJECT (parent)), NULL};
-    ig_obj_init (IG_OBJ_INSTANCE, name, plist, IG_OBJECT (instance), storage);
-
-    ig_obj_attr_set (IG_OBJECT (instance), "module", IG_OBJECT (module)->id, true);
+    ig_obj_init (IG_OBJ_INSTANCE, name, plist, IG_OBJECT (instance), storage, arena);
 
+    /* module determines attribute prototypes */
     instance->module = module;
     instance->parent = parent;
 
-    instance->adjustments = g_queue_new ();
-    instance->pins        = g_queue_new ();
+    ig_obj_attr_set (IG_OBJECT (instance), "module", ig_obj_id (IG_OBJECT (module)), true);
+
+    ig_obj_array_init (&instance->adjustments);
+    ig_obj_array_init (&instance->pins);
 
     return instance;
 }
@@ -674,11 +1296,12 @@ struct ig_instance *ig_instance_new (const char *name, struct ig_module *module,
 void ig_instance_free (struct ig_instance *instance)
 {
     if (instance == NULL) return;
+    if (IG_OBJECT (instance)->arena != NULL) return;
 
     ig_obj_free (IG_OBJECT (instance));
 
-    IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (instance, adjustments, struct ig_adjustment, parent);
-    IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (instance, pins,        struct ig_pin,        parent);
+    IG_OBJECT_CHILD_ARRAY_UNREF_AND_FREE (instance, adjustments, struct ig_adjustment, parent);
+    IG_OBJECT_CHILD_ARRAY_UNREF_AND_FREE (instance, pins,        struct ig_pin,        parent);
 
     g_slice_free (struct ig_instance, instance);
 }
@@ -689,15 +1312,15 @@ void ig_instance_free (struct ig_instance *instance)
  * net data
  *******************************************************/
 
-struct ig_net *ig_net_new (const char *name, GStringChunk *storage)
+struct ig_net *ig_net_new (const char *name, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
 
-    struct ig_net    *net      = g_slice_new (struct ig_net);
+    struct ig_net    *net      = IG_OBJECT_ALLOC (struct ig_net, arena);
     struct ig_object *plist[1] = {NULL};
-    ig_obj_init (IG_OBJ_NET, name, plist, IG_OBJECT (net), storage);
+    ig_obj_init (IG_OBJ_NET, name, plist, IG_OBJECT (net), storage, arena);
 
-    net->objects = g_queue_new ();
+    ig_obj_array_init (&net->objects);
 
     return net;
 }
@@ -705,32 +1328,31 @@ struct ig_net *ig_net_new (const char *name, GStringChunk *storage)
 void ig_net_free (struct ig_net *net)
 {
     if (net == NULL) return;
+    if (IG_OBJECT (net)->arena != NULL) return;
 
     ig_obj_free (IG_OBJECT (net));
 
-    if (net->objects != NULL) {
-        for (GList *li = net->objects->head; li != NULL; li = li->next) {
-            struct ig_object *obj         = PTR_TO_IG_OBJECT (li->data);
-            struct ig_net   **obj_net_ptr = NULL;
-
-            if (obj->type == IG_OBJ_PORT) {
-                obj_net_ptr = &(IG_PORT (obj)->net);
-            } else if (obj->type == IG_OBJ_PIN) {
-                obj_net_ptr = &(IG_PIN (obj)->net);
-            } else if (obj->type == IG_OBJ_DECLARATION) {
-                obj_net_ptr = &(IG_DECL (obj)->net);
-            } else {
-                log_errorint ("NtFre", "Net %s contains object of invalid type %s.", IG_OBJECT (net)->name, ig_obj_type_name (obj->type));
-            }
-
-            if ((obj_net_ptr != NULL) && (*obj_net_ptr == net)) {
-                *obj_net_ptr = NULL;
-            }
+    for (guint i = 0; i < ig_obj_array_len (&net->objects); i++) {
+        struct ig_object *obj         = PTR_TO_IG_OBJECT (ig_obj_array_index (&net->objects, i));
+        struct ig_net   **obj_net_ptr = NULL;
+
+        if (obj->type == IG_OBJ_PORT) {
+            obj_net_ptr = &(IG_PORT (obj)->net);
+        } else if (obj->type == IG_OBJ_PIN) {
+            obj_net_ptr = &(IG_PIN (obj)->net);
+        } else if (obj->type == IG_OBJ_DECLARATION) {
+            obj_net_ptr = &(IG_DECL (obj)->net);
+        } else {
+            log_errorint ("NtFre", "Net %s contains object of invalid type %s.", IG_OBJECT (net)->name, ig_obj_type_name (obj->type));
+        }
 
-            ig_obj_unref (obj);
+        if ((obj_net_ptr != NULL) && (*obj_net_ptr == net)) {
+            *obj_net_ptr = NULL;
         }
-        g_queue_free (net->objects);
+
+        ig_obj_unref (obj);
     }
+    ig_obj_array_release (NULL, &net->objects);
 
     g_slice_free (struct ig_net, net);
 }
@@ -739,15 +1361,15 @@ void ig_net_free (struct ig_net *net)
  * generic data
  *******************************************************/
 
-struct ig_generic *ig_generic_new (const char *name, GStringChunk *storage)
+struct ig_generic *ig_generic_new (const char *name, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
 
-    struct ig_generic *generic  = g_slice_new (struct ig_generic);
+    struct ig_generic *generic  = IG_OBJECT_ALLOC (struct ig_generic, arena);
     struct ig_object  *plist[1] = {NULL};
-    ig_obj_init (IG_OBJ_GENERIC, name, plist, IG_OBJECT (generic), storage);
+    ig_obj_init (IG_OBJ_GENERIC, name, plist, IG_OBJECT (generic), storage, arena);
 
-    generic->objects = g_queue_new ();
+    ig_obj_array_init (&generic->objects);
 
     return generic;
 }
@@ -755,30 +1377,29 @@ struct ig_generic *ig_generic_new (const char *name, GStringChunk *storage)
 void ig_generic_free (struct ig_generic *generic)
 {
     if (generic == NULL) return;
+    if (IG_OBJECT (generic)->arena != NULL) return;
 
     ig_obj_free (IG_OBJECT (generic));
 
-    if (generic->objects != NULL) {
-        for (GList *li = generic->objects->head; li != NULL; li = li->next) {
-            struct ig_object   *obj             = PTR_TO_IG_OBJECT (li->data);
-            struct ig_generic **obj_generic_ptr = NULL;
-
-            if (obj->type == IG_OBJ_PARAMETER) {
-                obj_generic_ptr = &(IG_PARAM (obj)->generic);
-            } else if (obj->type == IG_OBJ_ADJUSTMENT) {
-                obj_generic_ptr = &(IG_ADJUSTMENT (obj)->generic);
-            } else {
-                log_errorint ("GnFre", "Generic %s contains object of invalid type %s.", IG_OBJECT (generic)->name, ig_obj_type_name (obj->type));
-            }
+    for (guint i = 0; i < ig_obj_array_len (&generic->objects); i++) {
+        struct ig_object   *obj             = PTR_TO_IG_OBJECT (ig_obj_array_index (&generic->objects, i));
+        struct ig_generic **obj_generic_ptr = NULL;
 
-            if ((obj_generic_ptr != NULL) && (*obj_generic_ptr == generic)) {
-                *obj_generic_ptr = NULL;
-            }
+        if (obj->type == IG_OBJ_PARAMETER) {
+            obj_generic_ptr = &(IG_PARAM (obj)->generic);
+        } else if (obj->type == IG_OBJ_ADJUSTMENT) {
+            obj_generic_ptr = &(IG_ADJUSTMENT (obj)->generic);
+        } else {
+            log_errorint ("GnFre", "Generic %s contains object of invalid type %s.", IG_OBJECT (generic)->name, ig_obj_type_name (obj->type));
+        }
 
-            ig_obj_unref (obj);
+        if ((obj_generic_ptr != NULL) && (*obj_generic_ptr == generic)) {
+            *obj_generic_ptr = NULL;
         }
-        g_queue_free (generic->objects);
+
+        ig_obj_unref (obj);
     }
+    ig_obj_array_release (NULL, &generic->objects);
 
     g_slice_free (struct ig_generic, generic);
 }
@@ -28,6 +28,7 @@
 #include <stdbool.h>
 
 #include <logger.h>
+#include "ig_arena.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -56,12 +57,90 @@ enum ig_object_type {
     IG_OBJ_GENERIC
 };
 
+/**
+ * @brief Number of object types in @ref ig_object_type.
+ */
+#define IG_OBJ_TYPE_COUNT (IG_OBJ_GENERIC + 1)
+
+/**
+ * @brief Type of attribute value in @ref ig_attribute.
+ */
+enum ig_attribute_type {
+    IG_ATTR_TYPE_STRING, /**< Plain string. */
+    IG_ATTR_TYPE_INT,    /**< Integer, string representation is its canonical decimal form. */
+    IG_ATTR_TYPE_BOOL,   /**< Boolean, string representation is "true" or "false". */
+    IG_ATTR_TYPE_LIST,   /**< List of strings. */
+};
+
 /**
  * @brief Attributes used in @ref ig_object
+ *
+ * Every attribute has a string representation in @ref value,
+ * typed values are available in addition depending on @ref type.
  */
 struct ig_attribute {
-    bool        constant; /**< @brief Attribute is write-once/read-only. */
-    const char *value;    /**< @brief Value of attribute. */
+    bool                   constant; /**< @brief Attribute is write-once/read-only. */
+    enum ig_attribute_type type;     /**< @brief Type of value. */
+    const char            *value;    /**< @brief Value of attribute as string. */
+    union {
+        gint64 int_value;            /**< @brief Value of @ref IG_ATTR_TYPE_INT attribute. */
+        bool   bool_value;           /**< @brief Value of @ref IG_ATTR_TYPE_BOOL attribute. */
+        struct {
+            const char **items;      /**< @brief Elements of @ref IG_ATTR_TYPE_LIST attribute. */
+            guint        len;        /**< @brief Number of elements. */
+        } list;
+    } typed;
+};
+
+/**
+ * @brief Well-known attributes stored in fixed slots of @ref ig_object.
+ */
+enum ig_attribute_slot {
+    IG_ATTR_SLOT_TYPE,
+    IG_ATTR_SLOT_ID,
+    IG_ATTR_SLOT_NAME,
+    IG_ATTR_SLOT_PARENT,
+    IG_ATTR_SLOT_SIZE,
+    IG_ATTR_SLOT_SIGNAL,
+    IG_ATTR_SLOT_DIRECTION,
+    IG_ATTR_SLOT_CONNECTION,
+    IG_ATTR_SLOT_INVERT,
+    IG_ATTR_SLOT_ADAPT,
+    IG_ATTR_SLOT_ORIGIN,
+
+    IG_ATTR_SLOT_COUNT,   /**< Number of fixed attribute slots. */
+    IG_ATTR_SLOT_NONE = -1 /**< Attribute has no fixed slot. */
+};
+
+/**
+ * @brief Growable array of objects keeping insertion order.
+ *
+ * Used for child objects of @ref ig_object derived structs.
+ * For modification see @ref ig_obj_array_add and @ref ig_obj_array_release,
+ * for iteration see @ref ig_obj_array_len and @ref ig_obj_array_index.
+ */
+struct ig_obj_array {
+    gpointer *pdata; /**< @brief Elements of array. */
+    guint     len;   /**< @brief Number of elements in array. */
+    guint     alloc; /**< @brief Number of elements allocated in @ref pdata. */
+};
+
+/**
+ * @brief Shared attribute prototypes.
+ *
+ * Objects of the same kind under one module (instances of a resource module and their pins)
+ * share their attribute table with all objects that got the same attributes set.
+ * Shared tables are never modified: setting an attribute moves the object to the table with
+ * this attribute added, which is created on first use and reused by subsequent objects.
+ * An object leaving a table no other object has reached gets a private copy instead,
+ * which is modified in place until frozen by @ref ig_attr_protos_freeze.
+ * See @ref ig_attr_protos_new.
+ */
+struct ig_attr_protos {
+    GHashTable      *transitions; /**< @brief Mapping of (table, attribute, value) to resulting table. */
+    GHashTable      *uses;        /**< @brief Number of objects that reached a table of @ref transitions. */
+    GHashTable      *owned;       /**< @brief Mapping of private tables to their owning object. */
+    struct ig_arena *arena;       /**< @brief Arena of shared tables and attribute entries. */
 };
 
 /**
@@ -72,12 +151,19 @@ struct ig_attribute {
  */
 struct ig_object {
     enum  ig_object_type type;         /**< @brief Type of Object stored in inheriting struct. */
-    const char          *id;           /**< @brief Unique Object-ID. */
+    guint32              handle;       /**< @brief Handle of object in database or 0 if not added to a database. */
+    const char          *id;           /**< @brief Unique Object-ID or @c NULL if not yet materialized (see @ref ig_obj_id). */
     const char          *name;         /**< @brief Object name. */
+    struct ig_object    *id_parent;    /**< @brief Closest object in Object-ID hierarchy or @c NULL. */
+    guint8               id_depth;     /**< @brief Number of ancestor names in Object-ID. */
 
-    int refcount;                      /**< @brief Reference count for memory management. */
+    int              refcount;         /**< @brief Reference count for memory management. */
+    struct ig_arena *arena;            /**< @brief Arena the object is allocated in or @c NULL if reference counted. */
 
-    GHashTable   *attributes;          /**< @brief Attributes. Key: (const char *), value: (struct @ref ig_attribute *). */
+    const char   *attr_slots[IG_ATTR_SLOT_COUNT]; /**< @brief Values of well-known attributes (see @ref ig_attribute_slot) or @c NULL if unset. */
+    guint16       attr_slots_constant; /**< @brief Bitmask of constant entries in @ref attr_slots. */
+    guint32       epoch;               /**< @brief Modification counter of child object arrays (see @ref ig_obj_modified). */
+    GHashTable   *attributes;          /**< @brief Other attributes or @c NULL if none set, possibly shared (see @ref ig_attr_protos). Key: (const char *), value: (struct @ref ig_attribute *). */
     GStringChunk *string_storage;      /**< @brief Strings used here, in @ref attributes and inheriting struct. */
     bool          string_storage_free; /**< @brief Free @ref string_storage when freeing object. */
 };
@@ -174,7 +260,7 @@ struct ig_rf_reg {
 struct ig_rf_entry {
     struct ig_object object;      /**< @brief Inherited @ref ig_object struct. */
 
-    GQueue *regs;                 /**< @brief Registers of entry. Queue data: (struct @ref ig_rf_reg *) */
+    struct ig_obj_array regs;     /**< @brief Registers of entry. Array data: (struct @ref ig_rf_reg *) */
 
     struct ig_rf_regfile *parent; /**< @brief Regfile containing regfile-entry. */
 };
@@ -188,7 +274,7 @@ struct ig_rf_entry {
 struct ig_rf_regfile {
     struct ig_object object;  /**< @brief Inherited @ref ig_object struct. */
 
-    GQueue *entries;          /**< @brief Regfile-entries. Queue data: (struct @ref ig_rf_entry *) */
+    struct ig_obj_array entries; /**< @brief Regfile-entries. Array data: (struct @ref ig_rf_entry *) */
 
     struct ig_module *parent; /**< @brief Module containing regfile. */
 };
@@ -206,17 +292,19 @@ struct ig_module {
     bool resource;            /**< @brief Resource property. */
 
     /* module content */
-    GQueue *params;           /**< @brief Parameters.   Queue data: (struct @ref ig_param *)      */
-    GQueue *ports;            /**< @brief Ports.        Queue data: (struct @ref ig_port *)       */
-    GQueue *decls;            /**< @brief Declarations. Queue data: (struct @ref ig_decl *)       */
-    GQueue *code;             /**< @brief Codesections. Queue data: (struct @ref ig_code *)       */
-    GQueue *regfiles;         /**< @brief Regfiles.     Queue data: (struct @ref ig_rf_regfile *) */
+    struct ig_obj_array params;          /**< @brief Parameters.   Array data: (struct @ref ig_param *)      */
+    struct ig_obj_array ports;           /**< @brief Ports.        Array data: (struct @ref ig_port *)       */
+    struct ig_obj_array decls;           /**< @brief Declarations. Array data: (struct @ref ig_decl *)       */
+    struct ig_obj_array code;            /**< @brief Codesections. Array data: (struct @ref ig_code *)       */
+    struct ig_obj_array regfiles;        /**< @brief Regfiles.     Array data: (struct @ref ig_rf_regfile *) */
     /* child instances inside module */
-    GQueue *child_instances;  /**< @brief Instances within module. Queue data: (struct @ref ig_instance *) */
+    struct ig_obj_array child_instances; /**< @brief Instances within module. Array data: (struct @ref ig_instance *) */
     /* instances of this module elsewhere */
-    GQueue *mod_instances;    /**< @brief Instances of module. Queue data: (struct @ref ig_instance *) */
+    struct ig_obj_array mod_instances;   /**< @brief Instances of module. Array data: (struct @ref ig_instance *) */
     /* default instance of this module */
     struct ig_instance *default_instance; /**< @brief Default instance of non-resource module. */
+    /* attributes of instances of this module */
+    struct ig_attr_protos *attr_protos;   /**< @brief Attribute prototypes of instances and their pins or @c NULL if not shared. */
 };
 
 /**
@@ -263,8 +351,8 @@ struct ig_instance {
     struct ig_module *parent; /**< @brief Module instanciating instance. */
 
     /* instance values */
-    GQueue *adjustments;      /**< @brief Instance adjustments. Queue data: (struct @ref ig_adjustment *) */
-    GQueue *pins;             /**< @brief Instance pins. Queue data: (struct @ref ig_pin *) */
+    struct ig_obj_array adjustments; /**< @brief Instance adjustments. Array data: (struct @ref ig_adjustment *) */
+    struct ig_obj_array pins;        /**< @brief Instance pins. Array data: (struct @ref ig_pin *) */
 };
 
 /**
@@ -276,7 +364,7 @@ struct ig_instance {
 struct ig_net {
     struct ig_object object;  /**< @brief Inherited @ref ig_object struct. */
 
-    GQueue *objects;          /**< @brief Objects of net. */
+    struct ig_obj_array objects; /**< @brief Objects of net. */
 };
 
 /**
@@ -288,7 +376,7 @@ struct ig_net {
 struct ig_generic {
     struct ig_object object;  /**< @brief Inherited @ref ig_object struct. */
 
-    GQueue *objects;          /**< @brief Objects of generic. */
+    struct ig_obj_array objects; /**< @brief Objects of generic. */
 };
 
 /*******************************************************
@@ -309,6 +397,73 @@ struct ig_generic {
  * Functions
  *******************************************************/
 
+/**
+ * @brief Get canonical copy of string from the intern pool.
+ * @param str String to intern.
+ * @return Canonical string with the same content, valid while the pool is in use (see @ref ig_str_intern_ref).
+ *
+ * Equal strings are interned to the same pointer, so interned object names and
+ * attribute names are compared by pointer and hashed via @ref ig_str_intern_hash.
+ * The pool is shared by all databases, so forks and loaded snapshots use the same pointers.
+ */
+const char *ig_str_intern (const char *str);
+
+/**
+ * @brief Register a user of the intern pool.
+ *
+ * Every database holding interned strings is a user, see @ref ig_lib_db_new.
+ */
+void ig_str_intern_ref (void);
+
+/**
+ * @brief Unregister a user of the intern pool.
+ *
+ * All interned strings are released together with the last user.
+ */
+void ig_str_intern_unref (void);
+
+/**
+ * @brief Release all interned strings if the caller is the only user of the pool.
+ * @return @c true if the pool was cleared, @c false if other users might still reference interned strings.
+ *
+ * Meant for a database dropping all of its objects, see @ref ig_lib_db_clear.
+ */
+bool ig_str_intern_clear (void);
+
+/**
+ * @brief Get canonical copy of string without adding it to the intern pool.
+ * @param str String to look up.
+ * @return Canonical string with the same content or @c NULL if not interned,
+ * so no object or attribute has this name.
+ */
+const char *ig_str_intern_lookup (const char *str);
+
+/**
+ * @brief Hash function for tables keyed by interned strings.
+ * @param str String returned by @ref ig_str_intern.
+ * @return Hash precomputed on interning, equal to @c g_str_hash of the content.
+ *
+ * Use together with @c g_direct_equal, so table order stays the same as with plain string keys.
+ */
+guint ig_str_intern_hash (gconstpointer str);
+
+/**
+ * @brief Create new attribute prototype container.
+ * @param arena Arena to allocate shared attribute tables in.
+ * @return Newly created container or @c NULL if @c arena is @c NULL.
+ *
+ * Prototypes are only available for arena allocated objects, the container is released with the arena.
+ */
+struct ig_attr_protos *ig_attr_protos_new (struct ig_arena *arena);
+
+/**
+ * @brief Turn private attribute tables of prototype container into shared tables.
+ * @param protos Prototype container.
+ *
+ * Required before tables are referenced by other objects, e.g. in a database fork.
+ */
+void ig_attr_protos_freeze (struct ig_attr_protos *protos);
+
 /**
  * @brief Human readable name of object type.
  * @param type Object type.
@@ -323,12 +478,14 @@ const char *ig_obj_type_name (enum ig_object_type type);
  * @param plist NULL-Terminated list of Parent-Objects in hierarchy.
  * @param obj object data structure.
  * @param storage GStringChunk string storage for shared string storage or @c NULL to create local string storage.
+ * @param arena Arena the object is allocated in or @c NULL for reference counted objects.
  * @return The newly created object struct or @c NULL in case of an error.
  *
  * This function should be called within the allocation function of the actual data struct pointed to by @c obj.
  * The initial reference count is set to 0 (see @ref ig_obj_ref and @ref ig_obj_unref).
+ * Objects allocated in an arena are not reference counted and are released together with the arena.
  */
-void ig_obj_init (enum ig_object_type type, const char *name, struct ig_object *plist[], struct ig_object *obj, GStringChunk *storage);
+void ig_obj_init (enum ig_object_type type, const char *name, struct ig_object *plist[], struct ig_object *obj, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free object data.
@@ -360,6 +517,7 @@ void ig_obj_free_full (struct ig_object *obj);
  * in a module, instanciations of a module, pins in an instance).
  * Back-references in this case must not increment the ref-count - currently
  * they are deleted (set to @c NULL) when the managing object is freed.
+ * For objects allocated in an arena this is a no-op.
  */
 void ig_obj_ref (struct ig_object *obj);
 
@@ -370,10 +528,79 @@ void ig_obj_ref (struct ig_object *obj);
  * This decrements the object's reference count.
  * If the reference count reaches a value <= 0 the object is freed using
  * @ref ig_obj_free_full.
+ * For objects allocated in an arena this is a no-op.
  */
 void ig_obj_unref (struct ig_object *obj);
 
 
+/**
+ * @brief Get Object-ID of object.
+ * @param obj Object to get Object-ID from.
+ * @return Unique Object-ID of object or @c NULL in case of an error.
+ *
+ * The Object-ID is built from the type and the names of the object and its ancestors
+ * on first request and stored in the object's string storage afterwards.
+ */
+const char *ig_obj_id (struct ig_object *obj);
+
+/**
+ * @brief Append element to object array.
+ * @param arena Arena to allocate element storage in or @c NULL to use the heap.
+ * @param array Array to modify.
+ * @param data Element to append.
+ *
+ * The same arena must be used for all modifications of an array.
+ */
+void ig_obj_array_add (struct ig_arena *arena, struct ig_obj_array *array, gpointer data);
+
+/**
+ * @brief Release element storage of object array.
+ * @param arena Arena element storage was allocated in or @c NULL.
+ * @param array Array to release.
+ *
+ * The array is empty afterwards. Elements are not freed.
+ */
+void ig_obj_array_release (struct ig_arena *arena, struct ig_obj_array *array);
+
+/**
+ * @brief Number of elements in object array.
+ * @param array Array to get length of.
+ * @return Number of elements.
+ */
+static inline guint ig_obj_array_len (const struct ig_obj_array *array)
+{
+    return array->len;
+}
+
+/**
+ * @brief Element of object array.
+ * @param array Array to get element from.
+ * @param index Index of element, must be smaller than @ref ig_obj_array_len.
+ * @return The element at the given index.
+ */
+static inline gpointer ig_obj_array_index (const struct ig_obj_array *array, guint index)
+{
+    return array->pdata[index];
+}
+
+/**
+ * @brief Mark child object arrays of object as modified.
+ * @param obj Object a child has been added to.
+ *
+ * Increments @ref ig_object::epoch, so data derived from the child arrays can be detected as outdated.
+ */
+static inline void ig_obj_modified (struct ig_object *obj)
+{
+    obj->epoch++;
+}
+
+/**
+ * @brief Get fixed attribute slot of attribute name.
+ * @param name Name of attribute.
+ * @return Slot of the attribute or @ref IG_ATTR_SLOT_NONE if attribute is stored in the attribute table.
+ */
+enum ig_attribute_slot ig_obj_attr_slot (const char *name);
+
 /**
  * @brief Set attribute of object.
  * @param obj Object where attribute is set.
@@ -384,6 +611,31 @@ void ig_obj_unref (struct ig_object *obj);
  */
 bool ig_obj_attr_set (struct ig_object *obj, const char *name, const char *value, bool constant);
 
+/**
+ * @brief Set attribute of object without copying name and value.
+ * @param obj Object where attribute is set.
+ * @param name Name of attribute to set.
+ * @param value Value to set.
+ * @param constant Make attribute constant (read-only).
+ * @return @c true on success, @c false in case of errors.
+ *
+ * Same as @ref ig_obj_attr_set, but @c name and @c value are referenced directly
+ * and must stay valid as long as the object exists.
+ */
+bool ig_obj_attr_set_static (struct ig_object *obj, const char *name, const char *value, bool constant);
+
+/**
+ * @brief Copy non-slot attributes of an object sharing names and values.
+ * @param obj Arena allocated object where attributes are set.
+ * @param original Object to copy attributes from.
+ *
+ * Attribute entries are never modified once set, so they are referenced directly
+ * and must stay valid as long as @c obj exists.
+ * Shared tables of objects using @ref ig_attr_protos are referenced as a whole,
+ * so @c obj must use prototypes as well.
+ */
+void ig_obj_attr_share (struct ig_object *obj, const struct ig_object *original);
+
 /**
  * @brief Get attribute of object.
  * @param obj Object to get attribute from.
@@ -392,6 +644,80 @@ bool ig_obj_attr_set (struct ig_object *obj, const char *name, const char *value
  */
 const char *ig_obj_attr_get (struct ig_object *obj, const char *name);
 
+/**
+ * @brief Set integer attribute of object.
+ * @param obj Object where attribute is set.
+ * @param name Name of attribute to set.
+ * @param value Value to set.
+ * @param constant Make attribute constant (read-only).
+ * @return @c true on success, @c false in case of errors.
+ */
+bool ig_obj_attr_set_int (struct ig_object *obj, const char *name, gint64 value, bool constant);
+
+/**
+ * @brief Set boolean attribute of object.
+ * @param obj Object where attribute is set.
+ * @param name Name of attribute to set.
+ * @param value Value to set.
+ * @param constant Make attribute constant (read-only).
+ * @return @c true on success, @c false in case of errors.
+ */
+bool ig_obj_attr_set_bool (struct ig_object *obj, const char *name, bool value, bool constant);
+
+/**
+ * @brief Set list attribute of object.
+ * @param obj Object where attribute is set.
+ * @param name Name of attribute to set.
+ * @param value String representation of list (e.g. as Tcl list).
+ * @param items Elements of list.
+ * @param len Number of elements.
+ * @param constant Make attribute constant (read-only).
+ * @return @c true on success, @c false in case of errors.
+ *
+ * Attributes with a fixed slot (see @ref ig_attribute_slot) only keep the string representation.
+ */
+bool ig_obj_attr_set_list (struct ig_object *obj, const char *name, const char *value, const char *const *items, guint len, bool constant);
+
+/**
+ * @brief Get attribute of object with typed value.
+ * @param obj Object to get attribute from.
+ * @param name Name of attribute to get.
+ * @param attr Filled with attribute data on success.
+ * @return @c true if attribute exists, @c false otherwise.
+ *
+ * Attributes set as strings are typed as integer or boolean if their string is the
+ * canonical representation of an integer or is "true"/"false".
+ */
+bool ig_obj_attr_get_typed (struct ig_object *obj, const char *name, struct ig_attribute *attr);
+
+/**
+ * @brief Get integer attribute of object.
+ * @param obj Object to get attribute from.
+ * @param name Name of attribute to get.
+ * @param value Filled with value on success.
+ * @return @c true if attribute exists and is an integer, @c false otherwise.
+ */
+bool ig_obj_attr_get_int (struct ig_object *obj, const char *name, gint64 *value);
+
+/**
+ * @brief Get boolean attribute of object.
+ * @param obj Object to get attribute from.
+ * @param name Name of attribute to get.
+ * @param value Filled with value on success.
+ * @return @c true if attribute exists and is a boolean, @c false otherwise.
+ */
+bool ig_obj_attr_get_bool (struct ig_object *obj, const char *name, bool *value);
+
+/**
+ * @brief Get list attribute of object.
+ * @param obj Object to get attribute from.
+ * @param name Name of attribute to get.
+ * @param items Filled with elements of list on success, owned by object.
+ * @param len Filled with number of elements on success.
+ * @return @c true if attribute exists and is a list, @c false otherwise.
+ */
+bool ig_obj_attr_get_list (struct ig_object *obj, const char *name, const char *const **items, guint *len);
+
 /**
  * @brief Get all available attributes of object.
  * @param obj Object to the attribute list from.
@@ -415,12 +741,13 @@ bool ig_obj_attr_set_from_gslist (struct ig_object *obj, GList *list);
  * @param dir Port direction.
  * @param parent Module where port is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate in or @c NULL.
  * @return The newly allocated port structure or @c NULL in case of an error.
  *
  * This creates the port with the related object and adds the port to the specified parent module.
  * Default attributes are set in the related object.
  */
-struct ig_port *ig_port_new  (const char *name, enum ig_port_dir dir, struct ig_module *parent, GStringChunk *storage);
+struct ig_port *ig_port_new  (const char *name, enum ig_port_dir dir, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free port data struct.
@@ -437,12 +764,13 @@ void ig_port_free (struct ig_port *port);
  * @param local Local parameter property.
  * @param parent Module where parameter is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate in or @c NULL.
  * @return The newly allocated parameter structure or @c NULL in case of an error.
  *
  * This creates the parameter with the related object and adds the parameter to the specified parent module.
  * Default attributes are set in the related object.
  */
-struct ig_param *ig_param_new  (const char *name, const char *value, bool local, struct ig_module *parent, GStringChunk *storage);
+struct ig_param *ig_param_new  (const char *name, const char *value, bool local, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free parameter data struct.
@@ -459,12 +787,13 @@ void ig_param_free (struct ig_param *param);
  * @param default_type Use default variable type.
  * @param parent Module where declaration is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate in or @c NULL.
  * @return The newly allocated declaration structure or @c NULL in case of an error.
  *
  * This creates the declaration with the related object and adds the declaration to the specified parent module.
  * Default attributes are set in the related object.
  */
-struct ig_decl *ig_decl_new (const char *name, const char *assign, bool default_type, struct ig_module *parent, GStringChunk *storage);
+struct ig_decl *ig_decl_new (const char *name, const char *assign, bool default_type, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free declaration data struct.
@@ -480,12 +809,13 @@ void ig_decl_free (struct ig_decl *decl);
  * @param codesection Code of codesection.
  * @param parent Module where codesection is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate in or @c NULL.
  * @return The newly allocated codesection structure or @c NULL in case of an error.
  *
  * This creates the codesection with the related object and adds the codesection to the specified parent module.
  * Default attributes are set in the related object.
  */
-struct ig_code *ig_code_new  (const char *name, const char *codesection, struct ig_module *parent, GStringChunk *storage);
+struct ig_code *ig_code_new  (const char *name, const char *codesection, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free codesection data struct.
@@ -500,12 +830,13 @@ void ig_code_free (struct ig_code *code);
  * @param name Name of register.
  * @param parent Regfile-entry where register is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate in or @c NULL.
  * @return The newly allocated register structure or @c NULL in case of an error.
  *
  * This creates the register with the related object and adds the register to the specified parent regfile-entry.
  * Default attributes are set in the related object.
  */
-struct ig_rf_reg *ig_rf_reg_new (const char *name, struct ig_rf_entry *parent, GStringChunk *storage);
+struct ig_rf_reg *ig_rf_reg_new (const char *name, struct ig_rf_entry *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free register data struct.
@@ -520,12 +851,13 @@ void ig_rf_reg_free (struct ig_rf_reg *reg);
  * @param name Name of regfile-entry.
  * @param parent Regfile where regfile-entry is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate in or @c NULL.
  * @return The newly allocated regfile-entry structure or @c NULL in case of an error.
  *
  * This creates the regfile-entry with the related object and adds the regfile-entry to the specified parent regfile.
  * Default attributes are set in the related object.
  */
-struct ig_rf_entry *ig_rf_entry_new (const char *name, struct ig_rf_regfile *parent, GStringChunk *storage);
+struct ig_rf_entry *ig_rf_entry_new (const char *name, struct ig_rf_regfile *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free regfile-entry data struct.
@@ -540,12 +872,13 @@ void ig_rf_entry_free (struct ig_rf_entry *entry);
  * @param name Name of regfile.
  * @param parent Module where regfile is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate in or @c NULL.
  * @return The newly allocated regfile structure or @c NULL in case of an error.
  *
  * This creates the regfile with the related object and adds the regfile to the specified parent module.
  * Default attributes are set in the related object.
  */
-struct ig_rf_regfile *ig_rf_regfile_new (const char *name, struct ig_module *parent, GStringChunk *storage);
+struct ig_rf_regfile *ig_rf_regfile_new (const char *name, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free regfile data struct.
@@ -561,12 +894,13 @@ void ig_rf_regfile_free (struct ig_rf_regfile *regfile);
  * @param ilm ILM property.
  * @param resource Resource property. Resource modules must not contain any regfiles, instances, codesections.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate in or @c NULL.
  * @return The newly allocated module structure or @c NULL in case of an error.
  *
  * This creates the module with the related object.
  * Default attributes are set in the related object.
  */
-struct ig_module *ig_module_new (const char *name, bool ilm, bool resource, GStringChunk *storage);
+struct ig_module *ig_module_new (const char *name, bool ilm, bool resource, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free module data struct.
@@ -582,12 +916,13 @@ void ig_module_free (struct ig_module *module);
  * @param connection Value/wire connectod to pin.
  * @param parent Instance where pin is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate in or @c NULL.
  * @return The newly allocated pin structure or @c NULL in case of an error.
  *
  * This creates the pin with the related object and adds the pin to the specified parent instance.
  * Default attributes are set in the related object.
  */
-struct ig_pin *ig_pin_new (const char *name, const char *connection, struct ig_instance *parent, GStringChunk *storage);
+struct ig_pin *ig_pin_new (const char *name, const char *connection, struct ig_instance *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free pin data struct.
@@ -603,12 +938,13 @@ void ig_pin_free (struct ig_pin *pin);
  * @param value Adjusted value for parameter.
  * @param parent Instance where adjustment is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate in or @c NULL.
  * @return The newly allocated adjustment structure or @c NULL in case of an error.
  *
  * This creates the adjustment with the related object and adds the adjustment to the specified parent instance.
  * Default attributes are set in the related object.
  */
-struct ig_adjustment *ig_adjustment_new (const char *name, const char *value, struct ig_instance *parent, GStringChunk *storage);
+struct ig_adjustment *ig_adjustment_new (const char *name, const char *value, struct ig_instance *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free adjustment data struct.
@@ -624,12 +960,13 @@ void ig_adjustment_free (struct ig_adjustment *adjustment);
  * @param module Module to be instanciated.
  * @param parent Module where instance is to be added or @c NULL.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate in or @c NULL.
  * @return The newly allocated instance structure or @c NULL in case of an error.
  *
  * This creates the instance with the related object and adds the instance to the specified parent module.
  * Default attributes are set in the related object.
  */
-struct ig_instance *ig_instance_new (const char *name, struct ig_module *module, struct ig_module *parent, GStringChunk *storage);
+struct ig_instance *ig_instance_new (const char *name, struct ig_module *module, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free instance data struct.
@@ -644,11 +981,12 @@ void ig_instance_free (struct ig_instance *instance);
  * @brief Create new net data struct.
  * @param name Name of net.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate in or @c NULL.
  * @return The newly allocated net structure or @c NULL in case of an error.
  *
  * Default attributes are set in the related object.
  */
-struct ig_net *ig_net_new (const char *name, GStringChunk *storage);
+struct ig_net *ig_net_new (const char *name, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free net data struct.
@@ -662,11 +1000,12 @@ void ig_net_free (struct ig_net *net);
  * @brief Create new generic data struct.
  * @param name Name of generic.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate in or @c NULL.
  * @return The newly allocated generic structure or @c NULL in case of an error.
  *
  * Default attributes are set in the related object.
  */
-struct ig_generic *ig_generic_new (const char *name, GStringChunk *storage);
+struct ig_generic *ig_generic_new (const char *name, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free generic data struct.
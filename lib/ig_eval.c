@@ -0,0 +1,403 @@
+/*
+ *  ICGlue is a Tcl-Library for scripted HDL generation
+ *  Copyright (C) 2017-2019  Andreas Dixius, Felix Neumärker
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "ig_eval.h"
+#include "logger.h"
+
+#include <string.h>
+
+/* memoized value of a parameter in an instance - key and value of the memoization table */
+struct ig_eval_memo {
+    struct ig_param     *param;
+    struct ig_instance  *inst;
+    bool                 busy;  /* evaluation in progress: a parameter reached again depends on itself */
+    struct ig_eval_value value;
+};
+
+/* scope to resolve parameter names in */
+struct ig_eval_scope {
+    struct ig_lib_db   *db;
+    struct ig_module   *mod;
+    struct ig_instance *inst;
+};
+
+static void ig_eval_expr (struct ig_eval_scope *scope, const char *str, gsize len, struct ig_eval_value *result);
+static void ig_eval_param (struct ig_lib_db *db, struct ig_param *param, struct ig_instance *inst, struct ig_eval_value *result);
+
+static const struct ig_eval_value ig_eval_invalid = {false, 0, -1, false};
+
+static guint ig_eval_memo_hash (gconstpointer key)
+{
+    const struct ig_eval_memo *memo = (const struct ig_eval_memo *)key;
+
+    return (g_direct_hash (memo->param) * 31) + g_direct_hash (memo->inst);
+}
+
+static gboolean ig_eval_memo_equal (gconstpointer a, gconstpointer b)
+{
+    const struct ig_eval_memo *memo_a = (const struct ig_eval_memo *)a;
+    const struct ig_eval_memo *memo_b = (const struct ig_eval_memo *)b;
+
+    return ((memo_a->param == memo_b->param) && (memo_a->inst == memo_b->inst));
+}
+
+GHashTable *ig_eval_cache_new (void)
+{
+    return g_hash_table_new_full (ig_eval_memo_hash, ig_eval_memo_equal, g_free, NULL);
+}
+
+void ig_eval_cache_clear (struct ig_lib_db *db)
+{
+    if (db == NULL) return;
+
+    g_hash_table_remove_all (db->param_values);
+}
+
+static bool ig_eval_isspace (char c)
+{
+    return g_ascii_isspace (c);
+}
+
+static void ig_eval_trim (const char **str, gsize *len)
+{
+    while ((*len > 0) && ig_eval_isspace ((*str)[0])) {
+        (*str)++;
+        (*len)--;
+    }
+    while ((*len > 0) && ig_eval_isspace ((*str)[*len - 1])) {
+        (*len)--;
+    }
+}
+
+/* digits in given base, '_' skipped if allowed - false on invalid digits or overflow */
+static bool ig_eval_parse_digits (const char *str, gsize len, guint base, bool underscores, guint64 *value)
+{
+    guint64 result   = 0;
+    gsize   n_digits = 0;
+
+    for (gsize i = 0; i < len; i++) {
+        if (underscores && (str[i] == '_')) continue;
+
+        int digit = g_ascii_xdigit_value (str[i]);
+        if ((digit < 0) || ((guint)digit >= base)) return false;
+
+        if (result > (G_MAXUINT64 - (guint)digit) / base) return false;
+        result = (result * base) + (guint)digit;
+        n_digits++;
+    }
+
+    if (n_digits == 0) return false;
+
+    *value = result;
+    return true;
+}
+
+/* integer like Tcl: optional sign, 0x/0o/0b/0d prefix, leading 0 for octal */
+static bool ig_eval_parse_integer (const char *str, gsize len, struct ig_eval_value *result)
+{
+    bool negative = false;
+
+    if ((len > 0) && ((str[0] == '+') || (str[0] == '-'))) {
+        negative = (str[0] == '-');
+        str++;
+        len--;
+    }
+    if (len == 0) return false;
+
+    guint base = 10;
+    if ((len > 2) && (str[0] == '0') && g_ascii_isalpha (str[1])) {
+        switch (g_ascii_tolower (str[1])) {
+            case 'x': base = 16; break;
+            case 'o': base =  8; break;
+            case 'b': base =  2; break;
+            case 'd': base = 10; break;
+            default: return false;
+        }
+        str += 2;
+        len -= 2;
+    } else if ((len > 1) && (str[0] == '0')) {
+        base = 8;
+    }
+
+    guint64 value;
+    if (!ig_eval_parse_digits (str, len, base, false, &value)) return false;
+    if (negative && (value > (guint64)G_MAXINT64 + 1)) return false;
+
+    result->valid      = true;
+    result->value      = (negative ? (gint64)(0 - value) : (gint64)value);
+    result->size       = -1;
+    result->unsigned64 = (!negative && (value > (guint64)G_MAXINT64));
+
+    return true;
+}
+
+/* verilog number with radix: [<width>]'<radix><digits> */
+static bool ig_eval_parse_based (const char *str, gsize len, struct ig_eval_value *result)
+{
+    const char *tick = memchr (str, '\'', len);
+    if ((tick == NULL) || (tick + 1 >= str + len)) return false;
+
+    gsize w_len = tick - str;
+    for (gsize i = 0; i < w_len; i++) {
+        if (!g_ascii_isdigit (str[i])) return false;
+    }
+
+    const char *digits = tick + 2;
+    gsize       d_len  = (str + len) - digits;
+
+    guint base = 0;
+    switch (tick[1]) {
+        case 'h': case 'H': base = 16; break;
+        case 'o': case 'O': base =  8; break;
+        case 'b': case 'B': base =  2; break;
+        case 'd': case 'D': base = 10; break;
+        default: return false;
+    }
+
+    guint64 value;
+    if (!ig_eval_parse_digits (digits, d_len, base, true, &value)) return false;
+
+    int size = -1;
+    if (w_len > 0) {
+        guint64 width;
+        if (!ig_eval_parse_digits (str, w_len, 10, false, &width)) return false;
+        if (width > G_MAXINT) return false;
+        size = (int)width;
+    }
+
+    result->valid      = true;
+    result->value      = (gint64)value;
+    result->size       = size;
+    result->unsigned64 = true;
+
+    return true;
+}
+
+static bool ig_eval_is_identifier (const char *str, gsize len)
+{
+    if ((len == 0) || !g_ascii_isalpha (str[0])) return false;
+
+    for (gsize i = 1; i < len; i++) {
+        if (!g_ascii_isalnum (str[i]) && (str[i] != '_')) return false;
+    }
+
+    return true;
+}
+
+/* parameter name in scope */
+static void ig_eval_identifier (struct ig_eval_scope *scope, const char *str, gsize len, struct ig_eval_value *result)
+{
+    *result = ig_eval_invalid;
+
+    if (scope->mod == NULL) return;
+
+    for (guint i = 0; i < ig_obj_array_len (&scope->mod->params); i++) {
+        struct ig_param *i_param = (struct ig_param *)ig_obj_array_index (&scope->mod->params, i);
+        const char      *i_name  = IG_OBJECT (i_param)->name;
+
+        if ((strncmp (i_name, str, len) == 0) && (i_name[len] == '\0')) {
+            ig_eval_param (scope->db, i_param, scope->inst, result);
+            return;
+        }
+    }
+}
+
+/* concatenation or value shifted in: false if the result exceeds the supported width */
+static bool ig_eval_shift_in (struct ig_eval_value *result, const struct ig_eval_value *val)
+{
+    if ((val->size < 0) || (result->size + val->size > 64)) return false;
+
+    guint64 shifted = (val->size == 64 ? 0 : ((guint64)result->value << val->size));
+
+    result->value  = (gint64)(shifted | (guint64)val->value);
+    result->size  += val->size;
+
+    return true;
+}
+
+/* content of braces: {<rep>{<value>}} or {<value>, ...} */
+static void ig_eval_braces (struct ig_eval_scope *scope, const char *str, gsize len, struct ig_eval_value *result)
+{
+    *result = ig_eval_invalid;
+
+    /* repetition: count followed by braced value up to the last closing brace */
+    const char *rep_end = memchr (str, '{', len);
+    const char *val_end = str + len;
+    if (rep_end != NULL) {
+        while ((val_end > rep_end + 1) && (val_end[-1] != '}')) val_end--;
+    }
+    if ((rep_end != NULL) && (rep_end > str) && (val_end[-1] == '}') && !ig_eval_isspace (str[0]) &&
+        (memchr (str, '}', rep_end - str) == NULL) && (memchr (str, ',', rep_end - str) == NULL)) {
+        struct ig_eval_value rep;
+        struct ig_eval_value val;
+
+        ig_eval_expr (scope, str, rep_end - str, &rep);
+        if (!rep.valid || (rep.value < 0)) return;
+        ig_eval_expr (scope, rep_end, val_end - rep_end, &val);
+        if (!val.valid || (val.size <= 0)) return;
+
+        struct ig_eval_value res = {true, 0, 0, true};
+        for (gint64 i = 0; i < rep.value; i++) {
+            if (!ig_eval_shift_in (&res, &val)) return;
+        }
+        *result = res;
+        return;
+    }
+
+    /* concatenation: split at commas outside of braces */
+    struct ig_eval_value res     = {true, 0, 0, true};
+    int                  balance = 0;
+    const char          *start   = str;
+    for (gsize i = 0; i <= len; i++) {
+        if (i < len) {
+            if (str[i] == '{') balance++;
+            if (str[i] == '}') balance--;
+            if ((str[i] != ',') || (balance != 0)) continue;
+        }
+        if (balance != 0) return;
+
+        struct ig_eval_value val;
+        ig_eval_expr (scope, start, (str + i) - start, &val);
+        if (!val.valid) return;
+        if (!ig_eval_shift_in (&res, &val)) return;
+
+        start = str + i + 1;
+    }
+    *result = res;
+}
+
+static void ig_eval_expr (struct ig_eval_scope *scope, const char *str, gsize len, struct ig_eval_value *result)
+{
+    ig_eval_trim (&str, &len);
+
+    *result = ig_eval_invalid;
+    if (len == 0) return;
+
+    if (ig_eval_parse_integer (str, len, result)) return;
+    if (ig_eval_parse_based (str, len, result)) return;
+
+    if (ig_eval_is_identifier (str, len)) {
+        ig_eval_identifier (scope, str, len, result);
+    } else if ((str[0] == '(') && (str[len - 1] == ')') && (len >= 2)) {
+        ig_eval_expr (scope, str + 1, len - 2, result);
+    } else if ((str[0] == '{') && (str[len - 1] == '}') && (len >= 2)) {
+        const char *content     = str + 1;
+        gsize       content_len = len - 2;
+        while ((content_len > 0) && ig_eval_isspace (content[0])) {
+            content++;
+            content_len--;
+        }
+        ig_eval_braces (scope, content, content_len, result);
+    }
+}
+
+static void ig_eval_param (struct ig_lib_db *db, struct ig_param *param, struct ig_instance *inst, struct ig_eval_value *result)
+{
+    if (inst == NULL) inst = param->parent->default_instance;
+
+    struct ig_eval_memo  key  = {param, inst, false, {false, 0, -1}};
+    struct ig_eval_memo *memo = (struct ig_eval_memo *)g_hash_table_lookup (db->param_values, &key);
+
+    if (memo != NULL) {
+        if (memo->busy) {
+            log_warn ("EPCyc", "parameter %s depends on itself", ig_obj_id (IG_OBJECT (param)));
+            *result = ig_eval_invalid;
+        } else {
+            *result = memo->value;
+        }
+        return;
+    }
+
+    memo       = g_new (struct ig_eval_memo, 1);
+    *memo      = key;
+    memo->busy = true;
+    g_hash_table_add (db->param_values, memo);
+
+    /* adjustment of the instance is evaluated in the parent module */
+    struct ig_adjustment *adj = NULL;
+    if ((inst != NULL) && (inst->parent != NULL)) {
+        for (guint i = 0; i < ig_obj_array_len (&inst->adjustments); i++) {
+            struct ig_adjustment *i_adj = (struct ig_adjustment *)ig_obj_array_index (&inst->adjustments, i);
+            if (strcmp (IG_OBJECT (i_adj)->name, IG_OBJECT (param)->name) == 0) {
+                adj = i_adj;
+                break;
+            }
+        }
+    }
+
+    struct ig_eval_value value;
+    if (adj != NULL) {
+        struct ig_eval_scope scope = {db, inst->parent, inst->parent->default_instance};
+        ig_eval_expr (&scope, adj->value, strlen (adj->value), &value);
+    } else {
+        struct ig_eval_scope scope = {db, param->parent, inst};
+        ig_eval_expr (&scope, param->value, strlen (param->value), &value);
+    }
+
+    memo->value = value;
+    memo->busy  = false;
+
+    *result = value;
+}
+
+bool ig_eval_value (struct ig_lib_db *db, const char *value, struct ig_module *mod, struct ig_instance *inst, struct ig_eval_value *result)
+{
+    if (result == NULL) return false;
+    *result = ig_eval_invalid;
+
+    if ((db == NULL) || (value == NULL)) return false;
+    if ((mod != NULL) && (inst == NULL)) inst = mod->default_instance;
+
+    struct ig_eval_scope scope = {db, mod, inst};
+    ig_eval_expr (&scope, value, strlen (value), result);
+
+    return result->valid;
+}
+
+bool ig_eval_parameter (struct ig_lib_db *db, struct ig_param *param, struct ig_instance *inst, struct ig_eval_value *result)
+{
+    if (result == NULL) return false;
+    *result = ig_eval_invalid;
+
+    if ((db == NULL) || (param == NULL)) return false;
+    if ((inst != NULL) && (inst->module != param->parent)) return false;
+
+    ig_eval_param (db, param, inst, result);
+
+    return result->valid;
+}
+
+bool ig_eval_generic (struct ig_lib_db *db, struct ig_generic *generic, struct ig_instance *inst, struct ig_eval_value *result)
+{
+    if (result == NULL) return false;
+    *result = ig_eval_invalid;
+
+    if ((db == NULL) || (generic == NULL) || (inst == NULL)) return false;
+
+    for (guint i = 0; i < ig_obj_array_len (&inst->module->params); i++) {
+        struct ig_param *i_param = (struct ig_param *)ig_obj_array_index (&inst->module->params, i);
+        if (i_param->generic != generic) continue;
+
+        ig_eval_param (db, i_param, inst, result);
+        return result->valid;
+    }
+
+    return false;
+}
+
@@ -0,0 +1,103 @@
+/*
+ *  ICGlue is a Tcl-Library for scripted HDL generation
+ *  Copyright (C) 2017-2019  Andreas Dixius, Felix Neumärker
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file
+ * @brief Evaluation of parameter values.
+ *
+ * Values are parsed as simple verilog values: integers, based numbers (e.g. @c 8'hff),
+ * parameter names, parentheses, concatenations and repetitions.
+ * Parameter names are resolved in the scope of a module: the effective value of a parameter
+ * in an instance is the value of the instance's adjustment evaluated in the parent module or,
+ * if the instance has no adjustment, the default value of the parameter.
+ * Parameter results are memoized per parameter and instance until parameters or the hierarchy change.
+ */
+#ifndef __IG_EVAL_H__
+#define __IG_EVAL_H__
+
+#include "ig_lib.h"
+
+#include <glib.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Result of a value evaluation.
+ */
+struct ig_eval_value {
+    bool   valid;      /**< @brief Value could be evaluated. */
+    gint64 value;      /**< @brief Evaluated value or 0 if invalid. */
+    int    size;       /**< @brief Number of bits specified by the value or -1 if unspecified/invalid. */
+    bool   unsigned64; /**< @brief @ref value holds the bits of an unsigned 64-bit value (based numbers, concatenations and integers above the signed range). */
+};
+
+/**
+ * @brief Create memoization table of parameter values.
+ * @return The newly created table for @ref ig_lib_db::param_values.
+ */
+GHashTable *ig_eval_cache_new (void);
+
+/**
+ * @brief Drop memoized parameter values.
+ * @param db Database to clear memoized values of.
+ *
+ * Needs to be called when parameters, adjustments or the hierarchy change.
+ */
+void ig_eval_cache_clear (struct ig_lib_db *db);
+
+/**
+ * @brief Evaluate a value.
+ * @param db Database containing the parameters.
+ * @param value Value to evaluate.
+ * @param mod Module to resolve parameter names in or @c NULL to resolve no parameters.
+ * @param inst Instance of @c mod to evaluate parameters for or @c NULL for the default instance of @c mod.
+ * @param result Pointer to store result to.
+ * @return @c true if the value could be evaluated.
+ */
+bool ig_eval_value (struct ig_lib_db *db, const char *value, struct ig_module *mod, struct ig_instance *inst, struct ig_eval_value *result);
+
+/**
+ * @brief Evaluate the effective value of a parameter.
+ * @param db Database containing the parameter.
+ * @param param Parameter to evaluate.
+ * @param inst Instance of the parameter's module to evaluate parameter for or @c NULL for its default instance.
+ * @param result Pointer to store result to.
+ * @return @c true if the parameter could be evaluated.
+ */
+bool ig_eval_parameter (struct ig_lib_db *db, struct ig_param *param, struct ig_instance *inst, struct ig_eval_value *result);
+
+/**
+ * @brief Evaluate the effective value of a generic in an instance.
+ * @param db Database containing the generic.
+ * @param generic Generic to evaluate.
+ * @param inst Instance to evaluate generic for.
+ * @param result Pointer to store result to.
+ * @return @c true if the module of @c inst has a parameter of @c generic and it could be evaluated.
+ */
+bool ig_eval_generic (struct ig_lib_db *db, struct ig_generic *generic, struct ig_instance *inst, struct ig_eval_value *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -18,30 +18,66 @@
  */
 
 #include "ig_lib.h"
+#include "ig_eval.h"
 #include "logger.h"
 
 #include <stdio.h>
 #include <string.h>
 
+/* successor lists longer than this are grouped via a hash table of objects when merging hierarchies */
+#define IG_LIB_MERGE_BUCKET_MIN 8
+/* initial node count of hierarchy trees */
+#define IG_LIB_HTREE_NODES_MIN 32
+/* no node: end of child/sibling list or parent of the root */
+#define IG_LIB_HTREE_NONE G_MAXUINT
+
 /* static functions */
-static GList   *ig_lib_gen_hierarchy (struct ig_lib_db *db, struct ig_lib_connection_info *cinfo);
+/* hierarchy of a single endpoint: NULL-terminated from root down to endpoint, the first n_shared levels are cached */
+struct ig_lib_hier_path {
+    struct ig_lib_connection_info **levels;
+    guint                           n_shared;
+};
+
+static bool     ig_lib_gen_hierarchy (struct ig_lib_db *db, struct ig_lib_connection_info *cinfo, struct ig_lib_hier_path *path);
+static void     ig_lib_hier_path_free (struct ig_lib_hier_path *path);
 static bool     ig_lib_check_cycle (struct ig_lib_db *db, struct ig_instance *child, struct ig_module *parent);
-static GNode   *ig_lib_merge_hierarchy_list (struct ig_lib_db *db, GList *hier_list, const char *signame);
-static void     ig_lib_htree_print (GNode *hier_tree);
-static GNode   *ig_lib_htree_reduce (GNode *hier_tree);
-static GList   *ig_lib_htree_process_signal (struct ig_lib_db *db, GNode *hier_tree);
-static gboolean ig_lib_htree_process_signal_tfunc (GNode *node, gpointer data);
-static GList   *ig_lib_htree_process_parameter (struct ig_lib_db *db, GNode *hier_tree, const char *defvalue);
-static gboolean ig_lib_htree_process_parameter_tfunc (GNode *node, gpointer data);
-static void     ig_lib_htree_free (GNode *hier_tree);
-static gboolean ig_lib_htree_free_tfunc (GNode *node, gpointer data);
+/* node of a hierarchy tree, linked by indices into the node array of the tree */
+struct ig_lib_htree_node {
+    struct ig_lib_connection_info cinfo;        /* merged hierarchy level */
+    guint                         parent;       /* index of parent node or IG_LIB_HTREE_NONE */
+    guint                         first_child;  /* index of first child node or IG_LIB_HTREE_NONE */
+    guint                         next_sibling; /* index of next sibling node or IG_LIB_HTREE_NONE */
+};
+
+/* hierarchy tree of a signal/parameter: flat node array, all memory (including generated names) from a scratch arena */
+struct ig_lib_htree {
+    struct ig_arena          *arena;   /* scratch memory the tree is allocated in */
+    struct ig_lib_htree_node *nodes;   /* node array */
+    guint                     n_nodes; /* number of nodes in use */
+    guint                     alloc;   /* number of allocated nodes */
+    guint                     root;    /* index of root node */
+};
+
+static guint    ig_lib_merge_hierarchy_list (struct ig_lib_htree *tree, struct ig_lib_connection_info ***hier_list, guint n_hier, const char *signame);
+static struct ig_lib_htree *ig_lib_connection_htree (struct ig_lib_db *db, GList *signames, struct ig_lib_connection_info *source, GList *targets);
+static struct ig_net *ig_lib_connection_process (struct ig_lib_db *db, struct ig_lib_htree *tree, const char *signame, const char *local_name);
+static GList   *ig_lib_connection_process_bundle (struct ig_lib_db *db, struct ig_lib_htree *tree, GList *signames);
+static guint    ig_lib_htree_node_new (struct ig_lib_htree *tree, const struct ig_lib_connection_info *cinfo);
+static guint    ig_lib_htree_n_children (struct ig_lib_htree *tree, guint node);
+static guint    ig_lib_htree_next (struct ig_lib_htree *tree, guint node);
+static void     ig_lib_htree_print (struct ig_lib_htree *tree);
+static bool     ig_lib_htree_reduce (struct ig_lib_htree *tree);
+static GList   *ig_lib_htree_process_signal (struct ig_lib_db *db, struct ig_lib_htree *tree, const char *signame);
+static void     ig_lib_htree_process_signal_node (struct ig_lib_db *db, struct ig_lib_htree *tree, guint node, const char *signame, GList **gen_objs);
+static GList   *ig_lib_htree_process_parameter (struct ig_lib_db *db, struct ig_lib_htree *tree, const char *defvalue);
+static void     ig_lib_htree_process_parameter_node (struct ig_lib_db *db, struct ig_lib_htree *tree, guint node, const char *defvalue, bool root_local, GList **gen_objs);
 
 static struct ig_net     *ig_lib_add_net     (struct ig_lib_db *db, const char *name, GList *objs);
 static struct ig_generic *ig_lib_add_generic (struct ig_lib_db *db, const char *name, GList *objs);
 
 static char *ig_lib_gen_name_signal  (struct ig_lib_db *db, const char *basename);
 static char *ig_lib_gen_name_pinport (struct ig_lib_db *db, const char *basename, enum ig_port_dir dir);
-static char *ig_lib_rm_suffix_pinport (struct ig_lib_db *db, const char *pinportname);
+static const char *ig_lib_rm_suffix_pinport (struct ig_arena *arena, const char *pinportname);
 static bool  ig_lib_gen_name_iscaps (const char *name);
 
 /*******************************************************
@@ -56,64 +92,757 @@ static bool  ig_lib_gen_name_iscaps (const char *name);
 static int ig_mman_cnt_coninfo = 0;
 #endif
 
-/* header functions */
-struct ig_lib_db *ig_lib_db_new ()
-{
-    struct ig_lib_db *result = g_slice_new (struct ig_lib_db);
+/* last database generation handed out */
+static guint ig_lib_db_generation = 0;
 
-    result->objects_by_id     = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify)ig_obj_unref);
-    result->modules_by_id     = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify)ig_obj_unref);
-    result->modules_by_name   = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify)ig_obj_unref);
-    result->instances_by_id   = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify)ig_obj_unref);
-    result->instances_by_name = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify)ig_obj_unref);
-    result->regfiles_by_id    = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify)ig_obj_unref);
-    result->regfiles_by_name  = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify)ig_obj_unref);
-    result->nets_by_id        = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify)ig_obj_unref);
-    result->nets_by_name      = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify)ig_obj_unref);
-    result->generics_by_id    = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify)ig_obj_unref);
-    result->generics_by_name  = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify)ig_obj_unref);
+/* object lookup by (type, ID-parent, name) - objects themselves are used as keys, names are interned */
+static guint ig_lib_obj_parent_hash (gconstpointer key)
+{
+    const struct ig_object *obj = (const struct ig_object *)key;
 
-    result->str_chunks = g_string_chunk_new (128);
+    guint result = ig_str_intern_hash (obj->name);
+    result = (result * 31) + obj->type;
+    result = (result * 31) + (obj->id_parent == NULL ? 0 : obj->id_parent->handle);
 
     return result;
 }
 
-void ig_lib_db_clear (struct ig_lib_db *db)
+static gboolean ig_lib_obj_parent_equal (gconstpointer a, gconstpointer b)
 {
-    g_hash_table_remove_all (db->modules_by_id);
-    g_hash_table_remove_all (db->modules_by_name);
-    g_hash_table_remove_all (db->instances_by_id);
-    g_hash_table_remove_all (db->instances_by_name);
-    g_hash_table_remove_all (db->regfiles_by_id);
-    g_hash_table_remove_all (db->regfiles_by_name);
-    g_hash_table_remove_all (db->nets_by_id);
-    g_hash_table_remove_all (db->nets_by_name);
-    g_hash_table_remove_all (db->generics_by_id);
-    g_hash_table_remove_all (db->generics_by_name);
-    g_hash_table_remove_all (db->objects_by_id);
+    const struct ig_object *obj_a = (const struct ig_object *)a;
+    const struct ig_object *obj_b = (const struct ig_object *)b;
 
-    g_string_chunk_clear (db->str_chunks);
+    if (obj_a->type != obj_b->type) return false;
+    if (obj_a->id_parent != obj_b->id_parent) return false;
+
+    return (obj_a->name == obj_b->name);
 }
 
-void ig_lib_db_free (struct ig_lib_db *db)
+gpointer ig_lib_db_name_lookup (GHashTable *table, const char *name)
 {
-    if (db == NULL) return;
+    if ((table == NULL) || (name == NULL)) return NULL;
+
+    /* names not interned yet cannot be in any table */
+    const char *key = ig_str_intern_lookup (name);
+    if (key == NULL) return NULL;
+
+    return g_hash_table_lookup (table, key);
+}
+
+/* add port/declaration to signal index of its module: ports before declarations, otherwise the first object is kept */
+static void ig_lib_module_signal_index_add (GHashTable *index, struct ig_object *obj)
+{
+    const char *signame = ig_obj_attr_get (obj, "signal");
+    if (signame == NULL) return;
+
+    struct ig_object *prev = (struct ig_object *)g_hash_table_lookup (index, signame);
+    if ((prev != NULL) && ((prev->type == IG_OBJ_PORT) || (obj->type == IG_OBJ_DECLARATION))) return;
+
+    g_hash_table_insert (index, (gpointer)signame, obj);
+}
+
+/* update signal index of module of a port/declaration whose signal was set - modules without index are indexed on first lookup */
+static void ig_lib_module_signal_update (struct ig_lib_db *db, struct ig_object *obj)
+{
+    struct ig_module *mod = NULL;
+
+    if (obj->type == IG_OBJ_PORT) {
+        mod = IG_PORT (obj)->parent;
+    } else if (obj->type == IG_OBJ_DECLARATION) {
+        mod = IG_DECL (obj)->parent;
+    }
+    if (mod == NULL) return;
+
+    GHashTable *index = (GHashTable *)g_hash_table_lookup (db->module_signals, mod);
+    if (index == NULL) return;
+
+    ig_lib_module_signal_index_add (index, obj);
+}
+
+struct ig_object *ig_lib_module_signal (struct ig_lib_db *db, struct ig_module *mod, const char *signame)
+{
+    if ((db == NULL) || (mod == NULL) || (signame == NULL)) return NULL;
+
+    GHashTable *index = (GHashTable *)g_hash_table_lookup (db->module_signals, mod);
+    if (index == NULL) {
+        index = g_hash_table_new (g_str_hash, g_str_equal);
+        for (guint i = 0; i < ig_obj_array_len (&mod->ports); i++) {
+            ig_lib_module_signal_index_add (index, PTR_TO_IG_OBJECT (ig_obj_array_index (&mod->ports, i)));
+        }
+        for (guint i = 0; i < ig_obj_array_len (&mod->decls); i++) {
+            ig_lib_module_signal_index_add (index, PTR_TO_IG_OBJECT (ig_obj_array_index (&mod->decls, i)));
+        }
+        g_hash_table_insert (db->module_signals, mod, index);
+    }
+
+    return (struct ig_object *)g_hash_table_lookup (index, signame);
+}
+
+static struct ig_object *ig_lib_db_get_child (struct ig_lib_db *db, enum ig_object_type type, struct ig_object *parent, const char *name)
+{
+    struct ig_object key;
+
+    key.type      = type;
+    key.id_parent = parent;
+    key.name      = ig_str_intern_lookup (name);
+
+    if (key.name == NULL) return NULL;
+
+    return (struct ig_object *)g_hash_table_lookup (db->objects_by_parent, &key);
+}
+
+/* assign handle to new object and make it accessible by Object-ID */
+static void ig_lib_db_register_object (struct ig_lib_db *db, struct ig_object *obj)
+{
+    obj->handle = db->objects_by_id->len;
+    g_ptr_array_add (db->objects_by_id, obj);
+
+    if (obj->id_parent != NULL) {
+        g_hash_table_insert (db->objects_by_parent, obj, obj);
+    }
+}
+
+/* cached hierarchy paths by (object, direction) */
+struct ig_lib_hier_key {
+    struct ig_object          *obj;
+    enum ig_lib_connection_dir dir;
+};
+
+static guint ig_lib_hier_key_hash (gconstpointer key)
+{
+    const struct ig_lib_hier_key *hkey = (const struct ig_lib_hier_key *)key;
+
+    return (g_direct_hash (hkey->obj) * 31) + hkey->dir;
+}
+
+static gboolean ig_lib_hier_key_equal (gconstpointer a, gconstpointer b)
+{
+    const struct ig_lib_hier_key *key_a = (const struct ig_lib_hier_key *)a;
+    const struct ig_lib_hier_key *key_b = (const struct ig_lib_hier_key *)b;
+
+    return ((key_a->obj == key_b->obj) && (key_a->dir == key_b->dir));
+}
 
+/* drop cached hierarchy paths after the hierarchy changed */
+static void ig_lib_hier_cache_clear (struct ig_lib_db *db)
+{
+    if (g_hash_table_size (db->hier_paths) == 0) return;
+
+    g_hash_table_remove_all (db->hier_paths);
+    ig_arena_clear (db->hier_paths_arena);
+}
+
+/* header functions */
+static void ig_lib_db_init_tables (struct ig_lib_db *db)
+{
+    /* db objects are owned by the arena, so tables do not hold references */
+    db->objects_by_id     = g_ptr_array_new ();
+    db->objects_by_parent = g_hash_table_new (ig_lib_obj_parent_hash, ig_lib_obj_parent_equal);
+    db->modules_by_id     = g_hash_table_new (g_direct_hash, g_direct_equal);
+    db->modules_by_name   = g_hash_table_new (ig_str_intern_hash, g_direct_equal);
+    db->modules_ordered   = g_ptr_array_new ();
+    db->instances_by_id   = g_hash_table_new (g_direct_hash, g_direct_equal);
+    db->instances_by_name = g_hash_table_new (ig_str_intern_hash, g_direct_equal);
+    db->instances_ordered = g_ptr_array_new ();
+    db->regfiles_by_id    = g_hash_table_new (g_direct_hash, g_direct_equal);
+    db->regfiles_by_name  = g_hash_table_new (ig_str_intern_hash, g_direct_equal);
+    db->regfiles_ordered  = g_ptr_array_new ();
+    db->nets_by_id        = g_hash_table_new (g_direct_hash, g_direct_equal);
+    db->nets_by_name      = g_hash_table_new (ig_str_intern_hash, g_direct_equal);
+    db->nets_ordered      = g_ptr_array_new ();
+    db->generics_by_id    = g_hash_table_new (g_direct_hash, g_direct_equal);
+    db->generics_by_name  = g_hash_table_new (ig_str_intern_hash, g_direct_equal);
+    db->generics_ordered  = g_ptr_array_new ();
+
+    db->hier_paths        = g_hash_table_new (ig_lib_hier_key_hash, ig_lib_hier_key_equal);
+    db->module_signals    = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL, (GDestroyNotify)g_hash_table_destroy);
+    db->param_values      = ig_eval_cache_new ();
+
+    /* handle 0 is reserved for objects not in the database */
+    g_ptr_array_add (db->objects_by_id, NULL);
+}
+
+static void ig_lib_db_destroy_tables (struct ig_lib_db *db)
+{
+    /* no destroy notifiers: destroying a table does not walk its entries */
     g_hash_table_destroy (db->modules_by_id);
     g_hash_table_destroy (db->modules_by_name);
+    g_ptr_array_free (db->modules_ordered, true);
     g_hash_table_destroy (db->instances_by_id);
     g_hash_table_destroy (db->instances_by_name);
+    g_ptr_array_free (db->instances_ordered, true);
     g_hash_table_destroy (db->regfiles_by_id);
     g_hash_table_destroy (db->regfiles_by_name);
+    g_ptr_array_free (db->regfiles_ordered, true);
     g_hash_table_destroy (db->nets_by_id);
     g_hash_table_destroy (db->nets_by_name);
+    g_ptr_array_free (db->nets_ordered, true);
     g_hash_table_destroy (db->generics_by_id);
     g_hash_table_destroy (db->generics_by_name);
-    g_hash_table_destroy (db->objects_by_id);
+    g_ptr_array_free (db->generics_ordered, true);
+    g_hash_table_destroy (db->hier_paths);
+    g_hash_table_destroy (db->module_signals);
+    g_hash_table_destroy (db->param_values);
+    g_hash_table_destroy (db->objects_by_parent);
+    g_ptr_array_free (db->objects_by_id, true);
+}
+
+struct ig_lib_db *ig_lib_db_new ()
+{
+    struct ig_lib_db *result = g_slice_new (struct ig_lib_db);
+
+    ig_lib_db_init_tables (result);
+
+    result->generation       = ++ig_lib_db_generation;
+    result->str_chunks       = g_string_chunk_new (128);
+    result->arena            = ig_arena_new ();
+    result->hier_paths_arena = ig_arena_new ();
+    result->htree_arena      = ig_arena_new ();
+    result->conn_deferred    = NULL;
+    result->conn_failed_msg  = NULL;
+    result->conn_failed      = 0;
+
+    ig_str_intern_ref ();
+
+    return result;
+}
 
+void ig_lib_db_clear (struct ig_lib_db *db)
+{
+    /* queued connections and their failures are discarded, deferred mode is kept */
+    if (db->conn_deferred != NULL) {
+        g_ptr_array_set_size (db->conn_deferred, 0);
+        g_string_truncate (db->conn_failed_msg, 0);
+        db->conn_failed = 0;
+    }
+
+    ig_lib_db_destroy_tables (db);
+    ig_lib_db_init_tables (db);
+    db->generation = ++ig_lib_db_generation;
+
+    ig_arena_clear (db->arena);
+    ig_arena_clear (db->hier_paths_arena);
+    g_string_chunk_clear (db->str_chunks);
+
+    /* names of dropped objects are kept while forks or other databases may share them */
+    ig_str_intern_clear ();
+}
+
+void ig_lib_db_free (struct ig_lib_db *db)
+{
+    if (db == NULL) return;
+
+    ig_lib_connection_defer_end (db);
+    ig_lib_db_destroy_tables (db);
+
+    ig_arena_free (db->arena);
+    ig_arena_free (db->hier_paths_arena);
+    ig_arena_free (db->htree_arena);
     g_string_chunk_free (db->str_chunks);
 
     g_slice_free (struct ig_lib_db, db);
+
+    ig_str_intern_unref ();
+}
+
+static gsize ig_lib_obj_size (enum ig_object_type type)
+{
+    switch (type) {
+        case IG_OBJ_PORT:          return sizeof (struct ig_port);
+        case IG_OBJ_PIN:           return sizeof (struct ig_pin);
+        case IG_OBJ_PARAMETER:     return sizeof (struct ig_param);
+        case IG_OBJ_ADJUSTMENT:    return sizeof (struct ig_adjustment);
+        case IG_OBJ_DECLARATION:   return sizeof (struct ig_decl);
+        case IG_OBJ_CODESECTION:   return sizeof (struct ig_code);
+        case IG_OBJ_MODULE:        return sizeof (struct ig_module);
+        case IG_OBJ_INSTANCE:      return sizeof (struct ig_instance);
+        case IG_OBJ_REGFILE_REG:   return sizeof (struct ig_rf_reg);
+        case IG_OBJ_REGFILE_ENTRY: return sizeof (struct ig_rf_entry);
+        case IG_OBJ_REGFILE:       return sizeof (struct ig_rf_regfile);
+        case IG_OBJ_NET:           return sizeof (struct ig_net);
+        case IG_OBJ_GENERIC:       return sizeof (struct ig_generic);
+    }
+
+    return sizeof (struct ig_object);
+}
+
+/*
+ * Memory of a database shared with its forks:
+ * objects of forks reference strings and attribute entries of the original database.
+ */
+struct ig_lib_db_storage {
+    int              refcount;
+    struct ig_arena *arena;
+    GStringChunk    *str_chunks;
+};
+
+static void ig_lib_db_storage_unref (gpointer data)
+{
+    struct ig_lib_db_storage *storage = (struct ig_lib_db_storage *)data;
+
+    if (--storage->refcount > 0) return;
+
+    ig_arena_free (storage->arena);
+    g_string_chunk_free (storage->str_chunks);
+    g_slice_free (struct ig_lib_db_storage, storage);
+}
+
+/* move current memory of database into shared storage, the database continues with new memory containers */
+static struct ig_lib_db_storage *ig_lib_db_share_storage (struct ig_lib_db *db)
+{
+    struct ig_lib_db_storage *storage = g_slice_new (struct ig_lib_db_storage);
+
+    storage->refcount   = 1;
+    storage->arena      = db->arena;
+    storage->str_chunks = db->str_chunks;
+
+    /* existing objects keep allocating from the shared storage */
+    db->arena      = ig_arena_new ();
+    db->str_chunks = g_string_chunk_new (128);
+    ig_arena_add_cleanup (db->arena, ig_lib_db_storage_unref, storage);
+
+    return storage;
+}
+
+/* remap object references of a copied array to the fork */
+static void ig_lib_db_fork_array (struct ig_lib_db *fork, GHashTable *obj_map, struct ig_obj_array *array)
+{
+    gpointer *pdata = array->pdata;
+    guint     len   = array->len;
+
+    array->pdata = NULL;
+    array->len   = 0;
+    array->alloc = 0;
+
+    if (len == 0) return;
+
+    array->pdata = (gpointer *)ig_arena_alloc (fork->arena, len * sizeof (gpointer));
+    array->alloc = len;
+    for (guint i = 0; i < len; i++) {
+        gpointer mapped = g_hash_table_lookup (obj_map, pdata[i]);
+        if (mapped == NULL) continue;
+        array->pdata[array->len++] = mapped;
+    }
+}
+
+/* turn bitwise copy of original object into object of the fork */
+static void ig_lib_db_fork_obj (struct ig_lib_db *fork, GHashTable *obj_map, struct ig_object *obj, const struct ig_object *original)
+{
+#define IG_LIB_FORK_REF(FIELD) ((FIELD) = g_hash_table_lookup (obj_map, (FIELD)))
+
+    obj->refcount            = 0;
+    obj->arena               = fork->arena;
+    obj->string_storage      = fork->str_chunks;
+    obj->string_storage_free = false;
+    obj->attributes          = NULL;
+    IG_LIB_FORK_REF (obj->id_parent);
+
+    /* strings are shared, new strings of the fork are stored in its own container */
+    ig_obj_attr_share (obj, original);
+
+    switch (obj->type) {
+        case IG_OBJ_PORT:
+            IG_LIB_FORK_REF (IG_PORT (obj)->parent);
+            IG_LIB_FORK_REF (IG_PORT (obj)->net);
+            break;
+        case IG_OBJ_PIN:
+            IG_LIB_FORK_REF (IG_PIN (obj)->parent);
+            IG_LIB_FORK_REF (IG_PIN (obj)->net);
+            break;
+        case IG_OBJ_PARAMETER:
+            IG_LIB_FORK_REF (IG_PARAM (obj)->parent);
+            IG_LIB_FORK_REF (IG_PARAM (obj)->generic);
+            break;
+        case IG_OBJ_ADJUSTMENT:
+            IG_LIB_FORK_REF (IG_ADJUSTMENT (obj)->parent);
+            IG_LIB_FORK_REF (IG_ADJUSTMENT (obj)->generic);
+            break;
+        case IG_OBJ_DECLARATION:
+            IG_LIB_FORK_REF (IG_DECL (obj)->parent);
+            IG_LIB_FORK_REF (IG_DECL (obj)->net);
+            break;
+        case IG_OBJ_CODESECTION:
+            IG_LIB_FORK_REF (IG_CODE (obj)->parent);
+            break;
+        case IG_OBJ_MODULE: {
+            struct ig_module *mod = IG_MODULE (obj);
+            IG_LIB_FORK_REF (mod->default_instance);
+            /* shared tables of the original are used as base for new prototypes of the fork */
+            if (mod->attr_protos != NULL) {
+                ig_attr_protos_freeze (mod->attr_protos);
+                mod->attr_protos = ig_attr_protos_new (fork->arena);
+            }
+            ig_lib_db_fork_array (fork, obj_map, &mod->params);
+            ig_lib_db_fork_array (fork, obj_map, &mod->ports);
+            ig_lib_db_fork_array (fork, obj_map, &mod->decls);
+            ig_lib_db_fork_array (fork, obj_map, &mod->code);
+            ig_lib_db_fork_array (fork, obj_map, &mod->regfiles);
+            ig_lib_db_fork_array (fork, obj_map, &mod->child_instances);
+            ig_lib_db_fork_array (fork, obj_map, &mod->mod_instances);
+            break;
+        }
+        case IG_OBJ_INSTANCE:
+            IG_LIB_FORK_REF (IG_INSTANCE (obj)->parent);
+            IG_LIB_FORK_REF (IG_INSTANCE (obj)->module);
+            ig_lib_db_fork_array (fork, obj_map, &IG_INSTANCE (obj)->adjustments);
+            ig_lib_db_fork_array (fork, obj_map, &IG_INSTANCE (obj)->pins);
+            break;
+        case IG_OBJ_REGFILE_REG:
+            IG_LIB_FORK_REF (IG_RF_REG (obj)->parent);
+            break;
+        case IG_OBJ_REGFILE_ENTRY:
+            IG_LIB_FORK_REF (IG_RF_ENTRY (obj)->parent);
+            ig_lib_db_fork_array (fork, obj_map, &IG_RF_ENTRY (obj)->regs);
+            break;
+        case IG_OBJ_REGFILE:
+            IG_LIB_FORK_REF (IG_RF_REGFILE (obj)->parent);
+            ig_lib_db_fork_array (fork, obj_map, &IG_RF_REGFILE (obj)->entries);
+            break;
+        case IG_OBJ_NET:
+            ig_lib_db_fork_array (fork, obj_map, &IG_NET (obj)->objects);
+            break;
+        case IG_OBJ_GENERIC:
+            ig_lib_db_fork_array (fork, obj_map, &IG_GENERIC (obj)->objects);
+            break;
+    }
+
+#undef IG_LIB_FORK_REF
+}
+
+struct ig_lib_db *ig_lib_db_fork (struct ig_lib_db *db)
+{
+    if (db == NULL) return NULL;
+
+    struct ig_lib_db         *result  = ig_lib_db_new ();
+    struct ig_lib_db_storage *storage = ig_lib_db_share_storage (db);
+
+    storage->refcount++;
+    ig_arena_add_cleanup (result->arena, ig_lib_db_storage_unref, storage);
+
+    /* registered objects in handle order, followed by default instances not instanciated yet */
+    GPtrArray *originals = g_ptr_array_new ();
+    guint      n_registered = db->objects_by_id->len;
+    for (guint i = 1; i < n_registered; i++) {
+        g_ptr_array_add (originals, g_ptr_array_index (db->objects_by_id, i));
+    }
+    for (guint i = 1; i < n_registered; i++) {
+        struct ig_object *obj = (struct ig_object *)g_ptr_array_index (db->objects_by_id, i);
+        if (obj->type != IG_OBJ_MODULE) continue;
+
+        struct ig_instance *def_inst = IG_MODULE (obj)->default_instance;
+        if ((def_inst != NULL) && (IG_OBJECT (def_inst)->handle == 0)) {
+            g_ptr_array_add (originals, def_inst);
+        }
+    }
+
+    GHashTable        *obj_map = g_hash_table_new (g_direct_hash, g_direct_equal);
+    struct ig_object **copies  = g_new (struct ig_object *, originals->len);
+    for (guint i = 0; i < originals->len; i++) {
+        struct ig_object *original = (struct ig_object *)g_ptr_array_index (originals, i);
+        gsize             size     = ig_lib_obj_size (original->type);
+
+        copies[i] = (struct ig_object *)ig_arena_alloc (result->arena, size);
+        memcpy (copies[i], original, size);
+        g_hash_table_insert (obj_map, original, copies[i]);
+    }
+    for (guint i = 0; i < originals->len; i++) {
+        ig_lib_db_fork_obj (result, obj_map, copies[i], (struct ig_object *)g_ptr_array_index (originals, i));
+    }
+
+    /* handles are kept, so lookup tables can be filled in handle order */
+    for (guint i = 0; i + 1 < n_registered; i++) {
+        ig_lib_db_restore_object (result, copies[i]);
+    }
+
+    g_free (copies);
+    g_hash_table_destroy (obj_map);
+    g_ptr_array_free (originals, true);
+
+    return result;
+}
+
+void ig_lib_db_swap (struct ig_lib_db *db_a, struct ig_lib_db *db_b)
+{
+    if ((db_a == NULL) || (db_b == NULL)) return;
+
+    struct ig_lib_db tmp = *db_a;
+    *db_a = *db_b;
+    *db_b = tmp;
+
+    /* deferred mode belongs to the database handle, not to its content */
+    GPtrArray *tmp_deferred   = db_a->conn_deferred;
+    GString   *tmp_failed_msg = db_a->conn_failed_msg;
+    guint      tmp_failed     = db_a->conn_failed;
+    db_a->conn_deferred   = db_b->conn_deferred;
+    db_a->conn_failed_msg = db_b->conn_failed_msg;
+    db_a->conn_failed     = db_b->conn_failed;
+    db_b->conn_deferred   = tmp_deferred;
+    db_b->conn_failed_msg = tmp_failed_msg;
+    db_b->conn_failed     = tmp_failed;
+}
+
+/* type of ID-parent of objects with ID-parent, root types map to themselves */
+static enum ig_object_type ig_lib_id_parent_type (enum ig_object_type type)
+{
+    switch (type) {
+        case IG_OBJ_PORT:          return IG_OBJ_MODULE;
+        case IG_OBJ_PARAMETER:     return IG_OBJ_MODULE;
+        case IG_OBJ_DECLARATION:   return IG_OBJ_MODULE;
+        case IG_OBJ_CODESECTION:   return IG_OBJ_MODULE;
+        case IG_OBJ_REGFILE:       return IG_OBJ_MODULE;
+        case IG_OBJ_PIN:           return IG_OBJ_INSTANCE;
+        case IG_OBJ_ADJUSTMENT:    return IG_OBJ_INSTANCE;
+        case IG_OBJ_REGFILE_ENTRY: return IG_OBJ_REGFILE;
+        case IG_OBJ_REGFILE_REG:   return IG_OBJ_REGFILE_ENTRY;
+        default:                   return type;
+    }
+}
+
+/* resolve "[parent#...#]name" part of an Object-ID */
+static struct ig_object *ig_lib_db_get_object_by_path (struct ig_lib_db *db, enum ig_object_type type, const char *path)
+{
+    switch (type) {
+        case IG_OBJ_MODULE:  return (struct ig_object *)ig_lib_db_name_lookup (db->modules_by_name, path);
+        case IG_OBJ_NET:     return (struct ig_object *)ig_lib_db_name_lookup (db->nets_by_name, path);
+        case IG_OBJ_GENERIC: return (struct ig_object *)ig_lib_db_name_lookup (db->generics_by_name, path);
+        case IG_OBJ_INSTANCE: {
+            /* instance names are unique: default instances have no parent in their ID */
+            const char *name = strchr (path, '#');
+            return (struct ig_object *)ig_lib_db_name_lookup (db->instances_by_name, (name == NULL ? path : name + 1));
+        }
+        default:
+            break;
+    }
+
+    /* ID-parent path is everything before the last '#' of its depth */
+    enum ig_object_type parent_type = ig_lib_id_parent_type (type);
+    int                 depth       = 1;
+    for (enum ig_object_type it = parent_type; ig_lib_id_parent_type (it) != it; it = ig_lib_id_parent_type (it)) {
+        depth++;
+    }
+
+    const char *name = path;
+    for (int i = 0; i < depth; i++) {
+        name = strchr (name, '#');
+        if (name == NULL) return NULL;
+        name++;
+    }
+
+    char             *parent_path = g_strndup (path, name - path - 1);
+    struct ig_object *parent      = ig_lib_db_get_object_by_path (db, parent_type, parent_path);
+    g_free (parent_path);
+
+    if (parent == NULL) return NULL;
+
+    return ig_lib_db_get_child (db, type, parent, name);
+}
+
+struct ig_object *ig_lib_db_get_object (struct ig_lib_db *db, const char *id)
+{
+    if (db == NULL) return NULL;
+    if (id == NULL) return NULL;
+
+    const char *path = strstr (id, "##");
+    if (path == NULL) return NULL;
+
+    static const enum ig_object_type types[] = {
+        IG_OBJ_PORT, IG_OBJ_PIN, IG_OBJ_PARAMETER, IG_OBJ_ADJUSTMENT, IG_OBJ_DECLARATION, IG_OBJ_CODESECTION, IG_OBJ_MODULE,
+        IG_OBJ_INSTANCE, IG_OBJ_REGFILE_REG, IG_OBJ_REGFILE_ENTRY, IG_OBJ_REGFILE, IG_OBJ_NET, IG_OBJ_GENERIC
+    };
+
+    struct ig_object *result = NULL;
+    for (size_t i = 0; i < G_N_ELEMENTS (types); i++) {
+        const char *type_name = ig_obj_type_name (types[i]);
+        if (strncmp (id, type_name, path - id) != 0) continue;
+        if (type_name[path - id] != '\0') continue;
+
+        result = ig_lib_db_get_object_by_path (db, types[i], path + 2);
+        break;
+    }
+
+    if (result == NULL) return NULL;
+
+    /* path resolution is ambiguous for names containing '#' */
+    if (strcmp (ig_obj_id (result), id) != 0) return NULL;
+
+    return result;
+}
+
+struct ig_object *ig_lib_db_get_object_by_handle (struct ig_lib_db *db, guint32 handle)
+{
+    if (db == NULL) return NULL;
+    if (handle == 0) return NULL;
+    if (handle >= db->objects_by_id->len) return NULL;
+
+    return (struct ig_object *)g_ptr_array_index (db->objects_by_id, handle);
+}
+
+void ig_lib_db_restore_object (struct ig_lib_db *db, struct ig_object *obj)
+{
+    if (db == NULL) return;
+    if (obj == NULL) return;
+
+    ig_lib_db_register_object (db, obj);
+
+    GHashTable *by_name = NULL;
+    GHashTable *by_id   = NULL;
+    GPtrArray  *ordered = NULL;
+    switch (obj->type) {
+        case IG_OBJ_MODULE:   by_name = db->modules_by_name;   by_id = db->modules_by_id;   ordered = db->modules_ordered;   break;
+        case IG_OBJ_INSTANCE: by_name = db->instances_by_name; by_id = db->instances_by_id; ordered = db->instances_ordered; break;
+        case IG_OBJ_REGFILE:  by_name = db->regfiles_by_name;  by_id = db->regfiles_by_id;  ordered = db->regfiles_ordered;  break;
+        case IG_OBJ_NET:      by_name = db->nets_by_name;      by_id = db->nets_by_id;      ordered = db->nets_ordered;      break;
+        case IG_OBJ_GENERIC:  by_name = db->generics_by_name;  by_id = db->generics_by_id;  ordered = db->generics_ordered;  break;
+        default:
+            return;
+    }
+
+    g_hash_table_insert (by_name, (gpointer)obj->name, obj);
+    g_hash_table_insert (by_id,   GUINT_TO_POINTER (obj->handle), obj);
+    g_ptr_array_add (ordered, obj);
+}
+
+/* bucket count of a glib hash table with the given number of entries right after its last resize */
+static guint ig_lib_stats_buckets (guint entries)
+{
+    guint buckets = 8;
+    while (buckets < entries + entries / 3) {
+        buckets <<= 1;
+    }
+    return buckets;
+}
+
+/* bucket storage of a glib hash table: hash, key and value per bucket */
+static gsize ig_lib_stats_table_bytes (guint buckets)
+{
+    return (gsize)buckets * (sizeof (guint) + 2 * sizeof (gpointer));
+}
+
+static gsize ig_lib_stats_array_bytes (struct ig_obj_array *array)
+{
+    return (gsize)array->alloc * sizeof (gpointer);
+}
+
+/* struct size of object including child object arrays */
+static gsize ig_lib_stats_struct_bytes (struct ig_object *obj)
+{
+    gsize result = ig_lib_obj_size (obj->type);
+
+    switch (obj->type) {
+        case IG_OBJ_REGFILE_ENTRY: result += ig_lib_stats_array_bytes (&IG_RF_ENTRY (obj)->regs);        break;
+        case IG_OBJ_REGFILE:       result += ig_lib_stats_array_bytes (&IG_RF_REGFILE (obj)->entries);   break;
+        case IG_OBJ_NET:           result += ig_lib_stats_array_bytes (&IG_NET (obj)->objects);          break;
+        case IG_OBJ_GENERIC:       result += ig_lib_stats_array_bytes (&IG_GENERIC (obj)->objects);      break;
+        case IG_OBJ_INSTANCE:
+            result += ig_lib_stats_array_bytes (&IG_INSTANCE (obj)->adjustments);
+            result += ig_lib_stats_array_bytes (&IG_INSTANCE (obj)->pins);
+            break;
+        case IG_OBJ_MODULE: {
+            struct ig_module *mod = IG_MODULE (obj);
+            result += ig_lib_stats_array_bytes (&mod->params)   + ig_lib_stats_array_bytes (&mod->ports);
+            result += ig_lib_stats_array_bytes (&mod->decls)    + ig_lib_stats_array_bytes (&mod->code);
+            result += ig_lib_stats_array_bytes (&mod->regfiles) + ig_lib_stats_array_bytes (&mod->child_instances);
+            result += ig_lib_stats_array_bytes (&mod->mod_instances);
+            break;
+        }
+        default:
+            break;
+    }
+
+    return result;
+}
+
+static gsize ig_lib_stats_str_bytes (GHashTable *counted, const char *str)
+{
+    if (str == NULL) return 0;
+    if (!g_hash_table_add (counted, (gpointer)str)) return 0;
+
+    return strlen (str) + 1;
+}
+
+static void ig_lib_stats_obj (struct ig_lib_db_stats *stats, GHashTable *counted, struct ig_object *obj)
+{
+    struct ig_lib_db_type_stats *tstats = &stats->types[obj->type];
+
+    tstats->count++;
+    tstats->struct_bytes += ig_lib_stats_struct_bytes (obj);
+
+    tstats->string_bytes += ig_lib_stats_str_bytes (counted, obj->id);
+    for (int i = 0; i < IG_ATTR_SLOT_COUNT; i++) {
+        tstats->string_bytes += ig_lib_stats_str_bytes (counted, obj->attr_slots[i]);
+    }
+
+    if (obj->attributes == NULL) return;
+    /* shared attribute tables are counted once */
+    if (!g_hash_table_add (counted, obj->attributes)) return;
+
+    guint entries = g_hash_table_size (obj->attributes);
+    tstats->attr_bytes += ig_lib_stats_table_bytes (ig_lib_stats_buckets (entries)) + entries * sizeof (struct ig_attribute);
+
+    GHashTableIter iter;
+    gpointer       key, value;
+    g_hash_table_iter_init (&iter, obj->attributes);
+    while (g_hash_table_iter_next (&iter, &key, &value)) {
+        struct ig_attribute *attr = (struct ig_attribute *)value;
+        tstats->string_bytes += ig_lib_stats_str_bytes (counted, (const char *)key);
+        tstats->string_bytes += ig_lib_stats_str_bytes (counted, attr->value);
+    }
+}
+
+void ig_lib_db_stats (struct ig_lib_db *db, struct ig_lib_db_stats *stats)
+{
+    if (db == NULL) return;
+    if (stats == NULL) return;
+
+    memset (stats, 0, sizeof (*stats));
+
+    GHashTable *counted = g_hash_table_new (g_direct_hash, g_direct_equal);
+
+    for (guint i = 1; i < db->objects_by_id->len; i++) {
+        struct ig_object *obj = (struct ig_object *)g_ptr_array_index (db->objects_by_id, i);
+        if (obj == NULL) continue;
+
+        ig_lib_stats_obj (stats, counted, obj);
+
+        /* default instances are only registered once instanciated */
+        if (obj->type == IG_OBJ_MODULE) {
+            struct ig_instance *def_inst = IG_MODULE (obj)->default_instance;
+            if ((def_inst != NULL) && (IG_OBJECT (def_inst)->handle == 0)) {
+                ig_lib_stats_obj (stats, counted, IG_OBJECT (def_inst));
+            }
+        }
+    }
+
+    g_hash_table_destroy (counted);
+
+    struct {
+        const char *name;
+        GHashTable *table;
+    } tables[IG_LIB_DB_TABLE_COUNT] = {
+        {"objects_by_parent", db->objects_by_parent},
+        {"modules_by_name",   db->modules_by_name},
+        {"modules_by_id",     db->modules_by_id},
+        {"instances_by_name", db->instances_by_name},
+        {"instances_by_id",   db->instances_by_id},
+        {"regfiles_by_name",  db->regfiles_by_name},
+        {"regfiles_by_id",    db->regfiles_by_id},
+        {"nets_by_name",      db->nets_by_name},
+        {"nets_by_id",        db->nets_by_id},
+        {"generics_by_name",  db->generics_by_name},
+        {"generics_by_id",    db->generics_by_id},
+    };
+
+    for (int i = 0; i < IG_LIB_DB_TABLE_COUNT; i++) {
+        struct ig_lib_db_table_stats *tstats = &stats->tables[i];
+
+        tstats->name    = tables[i].name;
+        tstats->entries = g_hash_table_size (tables[i].table);
+        tstats->buckets = ig_lib_stats_buckets (tstats->entries);
+        tstats->bytes   = ig_lib_stats_table_bytes (tstats->buckets);
+    }
+
+    stats->arena_used     = db->arena->bytes_used;
+    stats->arena_reserved = db->arena->bytes_reserved;
 }
 
 struct ig_module *ig_lib_add_module (struct ig_lib_db *db, const char *name, bool ilm, bool resource)
@@ -121,25 +850,19 @@ struct ig_module *ig_lib_add_module (struct ig_lib_db *db, const char *name, boo
     if (db == NULL) return NULL;
     if (name == NULL) return NULL;
 
-    if (g_hash_table_contains (db->modules_by_name, name)) {
+    if ((ig_lib_db_name_lookup (db->modules_by_name, name) != NULL)) {
         log_error ("EAExi", "module %s already exists", name);
         return NULL;
     }
 
-    struct ig_module *mod = ig_module_new (name, ilm, resource, db->str_chunks);
-
-    if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (mod)->id)) {
-        log_errorint ("EAExi", "object %s already exists", IG_OBJECT (mod)->id);
-        ig_module_free (mod);
-        return NULL;
-    }
+    struct ig_module *mod = ig_module_new (name, ilm, resource, db->str_chunks, db->arena);
 
-    char *l_name = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod)->name);
-    char *l_id   = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod)->id);
+    const char *l_name = IG_OBJECT (mod)->name;
 
-    g_hash_table_insert (db->modules_by_name, l_name, IG_OBJECT (mod));
-    g_hash_table_insert (db->modules_by_id,   l_id,   IG_OBJECT (mod));
-    g_hash_table_insert (db->objects_by_id,   l_id,   IG_OBJECT (mod));
+    ig_lib_db_register_object (db, IG_OBJECT (mod));
+    g_hash_table_insert (db->modules_by_name, (gpointer)l_name, IG_OBJECT (mod));
+    g_hash_table_insert (db->modules_by_id,   GUINT_TO_POINTER (IG_OBJECT (mod)->handle), IG_OBJECT (mod));
+    g_ptr_array_add (db->modules_ordered, IG_OBJECT (mod));
     ig_obj_ref (IG_OBJECT (mod));
     ig_obj_ref (IG_OBJECT (mod));
     ig_obj_ref (IG_OBJECT (mod));
@@ -150,47 +873,38 @@ struct ig_module *ig_lib_add_module (struct ig_lib_db *db, const char *name, boo
 struct ig_pin *ig_lib_add_pin (struct ig_lib_db *db, struct ig_instance *inst, const char *pin_name, const char *conn_name, const char *invert_attr)
 {
     /* create a pin */
-    struct ig_pin *inst_pin = ig_pin_new (pin_name, conn_name, inst, db->str_chunks);
+    struct ig_pin *inst_pin = ig_pin_new (pin_name, conn_name, inst, db->str_chunks, db->arena);
 
     ig_obj_attr_set (IG_OBJECT (inst_pin), "invert", invert_attr, false);
-    if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (inst_pin)->id)) {
-        log_error ("CPin", "Already declared pin %s", IG_OBJECT (inst_pin)->id);
+    if (g_hash_table_contains (db->objects_by_parent, IG_OBJECT (inst_pin))) {
+        log_error ("CPin", "Already declared pin %s", ig_obj_id (IG_OBJECT (inst_pin)));
         ig_pin_free (inst_pin);
         inst_pin = NULL;
     } else {
-        g_hash_table_insert (db->objects_by_id, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (inst_pin)->id), IG_OBJECT (inst_pin));
+        ig_lib_db_register_object (db, IG_OBJECT (inst_pin));
         ig_obj_ref (IG_OBJECT (inst_pin));
-        g_queue_push_tail (inst->pins, inst_pin);
+        ig_obj_array_add (db->arena, &inst->pins, inst_pin);
         ig_obj_ref (IG_OBJECT (inst_pin));
+        ig_obj_modified (IG_OBJECT (inst));
     }
 
     return inst_pin;
 }
 
+/* child is the default instance of a module without parent: check whether parent is located below it */
 static bool ig_lib_check_cycle (struct ig_lib_db *db, struct ig_instance *child, struct ig_module *parent)
 {
-    bool result = false;
-
+    if (db == NULL) return false;
     if (child == NULL) return false;
     if (parent == NULL) return false;
 
-    struct ig_lib_connection_info *start = ig_lib_connection_info_new (db->str_chunks, IG_OBJECT (parent), NULL, IG_LCDIR_DEFAULT);
-    GList                         *hlist = ig_lib_gen_hierarchy (db, start);
-
-    if (hlist == NULL) return false;
-
-    struct ig_object *root = ((struct ig_lib_connection_info *)hlist->data)->obj;
-
-    if (strcmp (root->id, IG_OBJECT (child)->id) == 0) {
-        result = true;
-    }
-
-    for (GList *li = hlist; li != NULL; li = li->next) {
-        ig_lib_connection_info_free ((struct ig_lib_connection_info *)li->data);
+    /* walk up to the root of parent's hierarchy */
+    for (struct ig_module *mod = parent; mod != NULL; mod = mod->default_instance->parent) {
+        if (mod->default_instance == NULL) break;
+        if (mod->default_instance == child) return true;
     }
-    g_list_free (hlist);
 
-    return result;
+    return false;
 }
 
 struct ig_instance *ig_lib_add_instance (struct ig_lib_db *db, const char *name, struct ig_module *type, struct ig_module *parent)
@@ -200,7 +914,7 @@ struct ig_instance *ig_lib_add_instance (struct ig_lib_db *db, const char *name,
     if (type == NULL) return NULL;
     if (parent == NULL) return NULL;
 
-    if (g_hash_table_contains (db->instances_by_name, name)) {
+    if ((ig_lib_db_name_lookup (db->instances_by_name, name) != NULL)) {
         log_error ("EAExi", "instance %s already exists", name);
         return NULL;
     }
@@ -230,24 +944,30 @@ struct ig_instance *ig_lib_add_instance (struct ig_lib_db *db, const char *name,
         }
 
         inst->parent = parent;
-        ig_obj_attr_set (IG_OBJECT (inst), "parent", IG_OBJECT (parent)->id, true);
-        g_queue_push_tail (parent->child_instances, inst);
+        ig_obj_attr_set (IG_OBJECT (inst), "parent", ig_obj_id (IG_OBJECT (parent)), true);
+        /* paths of the module and everything below now continue to the new parent */
+        ig_lib_hier_cache_clear (db);
+        ig_eval_cache_clear (db);
+        ig_obj_array_add (db->arena, &parent->child_instances, inst);
         ig_obj_ref (IG_OBJECT (inst));
+        ig_obj_modified (IG_OBJECT (parent));
     } else {
-        inst = ig_instance_new (name, type, parent, db->str_chunks);
+        inst = ig_instance_new (name, type, parent, db->str_chunks, db->arena);
 
-        g_queue_push_tail (parent->child_instances, inst);
+        ig_obj_array_add (db->arena, &parent->child_instances, inst);
         ig_obj_ref (IG_OBJECT (inst));
-        g_queue_push_tail (type->mod_instances, inst);
+        ig_obj_modified (IG_OBJECT (parent));
+        ig_obj_array_add (db->arena, &type->mod_instances, inst);
         ig_obj_ref (IG_OBJECT (inst));
+        ig_obj_modified (IG_OBJECT (type));
     }
 
-    char *l_name = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (inst)->name);
-    char *l_id   = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (inst)->id);
+    const char *l_name = IG_OBJECT (inst)->name;
 
-    g_hash_table_insert (db->instances_by_name, l_name, IG_OBJECT (inst));
-    g_hash_table_insert (db->instances_by_id,   l_id,   IG_OBJECT (inst));
-    g_hash_table_insert (db->objects_by_id,     l_id,   IG_OBJECT (inst));
+    ig_lib_db_register_object (db, IG_OBJECT (inst));
+    g_hash_table_insert (db->instances_by_name, (gpointer)l_name, IG_OBJECT (inst));
+    g_hash_table_insert (db->instances_by_id,   GUINT_TO_POINTER (IG_OBJECT (inst)->handle), IG_OBJECT (inst));
+    g_ptr_array_add (db->instances_ordered, IG_OBJECT (inst));
     ig_obj_ref (IG_OBJECT (inst));
     ig_obj_ref (IG_OBJECT (inst));
     ig_obj_ref (IG_OBJECT (inst));
@@ -262,19 +982,18 @@ struct ig_code *ig_lib_add_codesection (struct ig_lib_db *db, const char *name,
     if (parent == NULL) return NULL;
 
     log_debug ("LACSc", "new codesection for module %s...", IG_OBJECT (parent)->name);
-    struct ig_code *cs = ig_code_new (name, code, parent, db->str_chunks);
+    struct ig_code *cs = ig_code_new (name, code, parent, db->str_chunks, db->arena);
 
     if (cs == NULL) {
         log_error ("LACSc", "error while creating new codesection for module %s", IG_OBJECT (parent)->name);
         return NULL;
     }
 
-    char *l_id = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (cs)->id);
-
-    g_queue_push_tail (parent->code, cs);
+    ig_obj_array_add (db->arena, &parent->code, cs);
     ig_obj_ref (IG_OBJECT (cs));
+    ig_obj_modified (IG_OBJECT (parent));
 
-    g_hash_table_insert (db->objects_by_id, l_id, IG_OBJECT (cs));
+    ig_lib_db_register_object (db, IG_OBJECT (cs));
     ig_obj_ref (IG_OBJECT (cs));
     log_debug ("LACSc", "...added codesection for module %s", IG_OBJECT (parent)->name);
 
@@ -287,35 +1006,36 @@ struct ig_rf_regfile *ig_lib_add_regfile (struct ig_lib_db *db, const char *name
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
 
-    if (g_hash_table_contains (db->regfiles_by_name, name)) {
+    if ((ig_lib_db_name_lookup (db->regfiles_by_name, name) != NULL)) {
         log_error ("EAExi", "regfile %s already exists", name);
         return NULL;
     }
 
     log_debug ("LARgf", "new regfile %s for module %s...", name, IG_OBJECT (parent)->name);
-    struct ig_rf_regfile *rf = ig_rf_regfile_new (name, parent, db->str_chunks);
+    struct ig_rf_regfile *rf = ig_rf_regfile_new (name, parent, db->str_chunks, db->arena);
 
     if (rf == NULL) {
         log_error ("LARgf", "error while creating new regfile %s for module %s", name, IG_OBJECT (parent)->name);
         return NULL;
     }
 
-    if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (rf)->id)) {
-        log_errorint ("EAExi", "object %s already exists", IG_OBJECT (rf)->id);
+    if (g_hash_table_contains (db->objects_by_parent, IG_OBJECT (rf))) {
+        log_errorint ("EAExi", "object %s already exists", ig_obj_id (IG_OBJECT (rf)));
         ig_rf_regfile_free (rf);
 
         return NULL;
     }
 
-    char *l_id   = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (rf)->id);
-    char *l_name = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (rf)->name);
+    const char *l_name = IG_OBJECT (rf)->name;
 
-    g_queue_push_tail (parent->regfiles, rf);
+    ig_obj_array_add (db->arena, &parent->regfiles, rf);
     ig_obj_ref (IG_OBJECT (rf));
+    ig_obj_modified (IG_OBJECT (parent));
 
-    g_hash_table_insert (db->regfiles_by_name, l_name, IG_OBJECT (rf));
-    g_hash_table_insert (db->regfiles_by_id,   l_id,   IG_OBJECT (rf));
-    g_hash_table_insert (db->objects_by_id,    l_id,   IG_OBJECT (rf));
+    ig_lib_db_register_object (db, IG_OBJECT (rf));
+    g_hash_table_insert (db->regfiles_by_name, (gpointer)l_name, IG_OBJECT (rf));
+    g_hash_table_insert (db->regfiles_by_id,   GUINT_TO_POINTER (IG_OBJECT (rf)->handle), IG_OBJECT (rf));
+    g_ptr_array_add (db->regfiles_ordered, IG_OBJECT (rf));
     ig_obj_ref (IG_OBJECT (rf));
     ig_obj_ref (IG_OBJECT (rf));
     ig_obj_ref (IG_OBJECT (rf));
@@ -331,174 +1051,535 @@ struct ig_rf_entry *ig_lib_add_regfile_entry (struct ig_lib_db *db, const char *
     if (parent == NULL) return NULL;
 
     log_debug ("LARfE", "new entry %s for regfile %s...", name, IG_OBJECT (parent)->name);
-    struct ig_rf_entry *entry = ig_rf_entry_new (name, parent, db->str_chunks);
+    struct ig_rf_entry *entry = ig_rf_entry_new (name, parent, db->str_chunks, db->arena);
 
     if (entry == NULL) {
         log_error ("LARfE", "error while creating new entry %s for regfile %s", name, IG_OBJECT (parent)->name);
         return NULL;
     }
 
-    char *l_id = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (entry)->id);
-
-    if (g_hash_table_contains (db->objects_by_id, l_id)) {
+    if (g_hash_table_contains (db->objects_by_parent, IG_OBJECT (entry))) {
         log_error ("LARfE", "Regfile-Entry %s already exists in regfile %s", IG_OBJECT (entry)->name, IG_OBJECT (parent)->name);
         ig_rf_entry_free (entry);
 
         entry = NULL;
     } else {
-        g_queue_push_tail (parent->entries, entry);
+        ig_obj_array_add (db->arena, &parent->entries, entry);
         ig_obj_ref (IG_OBJECT (entry));
+        ig_obj_modified (IG_OBJECT (parent));
 
-        g_hash_table_insert (db->objects_by_id, l_id, IG_OBJECT (entry));
+        ig_lib_db_register_object (db, IG_OBJECT (entry));
         ig_obj_ref (IG_OBJECT (entry));
         log_debug ("LARfE", "...added entry %s for regfile %s", name, IG_OBJECT (parent)->name);
     }
 
-    return entry;
+    return entry;
+}
+
+struct ig_rf_reg *ig_lib_add_regfile_reg (struct ig_lib_db *db, const char *name, struct ig_rf_entry *parent)
+{
+    if (db == NULL) return NULL;
+    if (name == NULL) return NULL;
+    if (parent == NULL) return NULL;
+
+    log_debug ("LARfR", "new reg %s for regfile-entrty %s...", name, IG_OBJECT (parent)->name);
+    struct ig_rf_reg *reg = ig_rf_reg_new (name, parent, db->str_chunks, db->arena);
+
+    if (reg == NULL) {
+        log_error ("LARfR", "error while creating new reg %s for regfile-entry %s", name, IG_OBJECT (parent)->name);
+        return NULL;
+    }
+
+    if (g_hash_table_contains (db->objects_by_parent, IG_OBJECT (reg))) {
+        log_error ("LARfR", "Regfile-reg %s already exists in regfile-entry %s", IG_OBJECT (reg)->name, IG_OBJECT (parent)->name);
+        ig_rf_reg_free (reg);
+
+        reg = NULL;
+    } else {
+        ig_obj_array_add (db->arena, &parent->regs, reg);
+        ig_obj_ref (IG_OBJECT (reg));
+        ig_obj_modified (IG_OBJECT (parent));
+
+        ig_lib_db_register_object (db, IG_OBJECT (reg));
+        ig_obj_ref (IG_OBJECT (reg));
+        log_debug ("LARfR", "...added reg %s for regfile-entry %s", name, IG_OBJECT (parent)->name);
+    }
+
+    return reg;
+}
+
+
+/* generate hierarchy of endpoint: path is kept for freeing, its root level is added to the start list for merging */
+static bool ig_lib_hier_list_add (struct ig_lib_db *db, struct ig_lib_connection_info *cinfo, GList **paths, GList **start_list)
+{
+    struct ig_lib_hier_path *path = g_slice_new (struct ig_lib_hier_path);
+
+    if (!ig_lib_gen_hierarchy (db, cinfo, path)) {
+        g_slice_free (struct ig_lib_hier_path, path);
+        return false;
+    }
+
+    *paths      = g_list_prepend (*paths, path);
+    *start_list = g_list_prepend (*start_list, path->levels);
+
+    return true;
+}
+
+static void ig_lib_hier_list_free (GList *paths, GList *start_list)
+{
+    for (GList *li = paths; li != NULL; li = li->next) {
+        struct ig_lib_hier_path *path = (struct ig_lib_hier_path *)li->data;
+        ig_lib_hier_path_free (path);
+        g_slice_free (struct ig_lib_hier_path, path);
+    }
+    g_list_free (paths);
+    g_list_free (start_list);
+}
+
+/* hierarchy paths of all endpoints of a signal (bundle) - frees targets list, cinfos are owned by paths afterwards */
+static bool ig_lib_connection_paths (struct ig_lib_db *db, GList *signames, struct ig_lib_connection_info *source, GList *targets, GList **hier_paths, GList **hier_start_list)
+{
+    const char *signame = (const char *)signames->data;
+    bool        bundle  = (signames->next != NULL);
+
+    log_debug ("LConn", "creating individual hierarchies...");
+    bool error = false;
+
+    if (source != NULL) {
+        source->dir         = IG_LCDIR_UP;
+        source->is_explicit = true;
+        if (bundle && (source->local_name != NULL)) {
+            log_error ("LConn", "signal bundle %s: local signal names are not possible at endpoints (%s)", signame, ig_obj_id (source->obj));
+            error = true;
+        }
+        log_debug ("LConn", "creating startpoint hierarchy...");
+        if (!ig_lib_hier_list_add (db, source, hier_paths, hier_start_list)) {
+            error = true;
+        }
+    }
+
+    for (GList *li = targets; li != NULL; li = li->next) {
+        struct ig_lib_connection_info *start = (struct ig_lib_connection_info *)li->data;
+        start->is_explicit = true;
+        if (bundle && (start->local_name != NULL)) {
+            log_error ("LConn", "signal bundle %s: local signal names are not possible at endpoints (%s)", signame, ig_obj_id (start->obj));
+            error = true;
+        }
+
+        log_debug ("LConn", "creating targetpoint hierarchy...");
+        if (!ig_lib_hier_list_add (db, start, hier_paths, hier_start_list)) {
+            error = true;
+        }
+    }
+
+    g_list_free (targets);
+
+    return !error;
+}
+
+/* check signal names of a bundle to be new and distinct */
+static bool ig_lib_connection_check_names (struct ig_lib_db *db, GList *signames)
+{
+    bool        result       = true;
+    GHashTable *bundle_names = g_hash_table_new (g_str_hash, g_str_equal);
+
+    for (GList *li = signames; li != NULL; li = li->next) {
+        const char *i_name = (const char *)li->data;
+        if ((ig_lib_db_name_lookup (db->nets_by_name, i_name) != NULL)) {
+            log_error ("LConn", "signal %s already exists", i_name);
+            result = false;
+        } else if (!g_hash_table_add (bundle_names, (gpointer)i_name)) {
+            log_error ("LConn", "signal %s is specified multiple times in bundle", i_name);
+            result = false;
+        }
+    }
+    g_hash_table_destroy (bundle_names);
+
+    return result;
+}
+
+/* merge hierarchy paths (start cursors) to a new hierarchy tree allocated in arena or NULL on error */
+static struct ig_lib_htree *ig_lib_htree_merge (struct ig_arena *arena, GList *hier_start_list, const char *signame)
+{
+    struct ig_lib_htree *tree = ig_arena_new0 (arena, struct ig_lib_htree);
+    tree->arena = arena;
+
+    guint                            n_hier    = 0;
+    struct ig_lib_connection_info ***hier_list = (struct ig_lib_connection_info ***)ig_arena_alloc (arena, g_list_length (hier_start_list) * sizeof (struct ig_lib_connection_info **));
+    for (GList *li = hier_start_list; li != NULL; li = li->next) {
+        hier_list[n_hier++] = (struct ig_lib_connection_info **)li->data;
+    }
+
+    tree->root = ig_lib_merge_hierarchy_list (tree, hier_list, n_hier, signame);
+    if (tree->root == IG_LIB_HTREE_NONE) return NULL;
+
+    return tree;
+}
+
+/* merge and reduce hierarchy paths to the hierarchy tree of a signal or NULL on error - uses no database state, safe to run in worker threads */
+static struct ig_lib_htree *ig_lib_connection_route (struct ig_arena *arena, GList *hier_start_list, const char *signame)
+{
+    log_debug ("LConn", "merging to hierarchy tree...");
+    /* create hierarchy tree */
+    struct ig_lib_htree *hier_tree = ig_lib_htree_merge (arena, hier_start_list, signame);
+
+    if (hier_tree == NULL) return NULL;
+
+    log_debug ("LConn", "printing hierarchy tree...");
+    /* debug: printout */
+    ig_lib_htree_print (hier_tree);
+
+    log_debug ("LConn", "reducing hierarchy tree...");
+    if (!ig_lib_htree_reduce (hier_tree)) {
+        log_warn ("LConn", "Unable to create signal %s, because of insufficient hierarchy information.", signame);
+        return NULL;
+    }
+
+    ig_lib_htree_print (hier_tree);
+
+    return hier_tree;
+}
+
+/* reduced hierarchy tree of a signal (bundle) from its endpoints or NULL on error - frees source and targets, tree is allocated in the scratch arena of the database */
+static struct ig_lib_htree *ig_lib_connection_htree (struct ig_lib_db *db, GList *signames, struct ig_lib_connection_info *source, GList *targets)
+{
+    GList               *hier_paths      = NULL;
+    GList               *hier_start_list = NULL;
+    struct ig_lib_htree *hier_tree       = NULL;
+
+    if (ig_lib_connection_paths (db, signames, source, targets, &hier_paths, &hier_start_list) &&
+        ig_lib_connection_check_names (db, signames)) {
+        hier_tree = ig_lib_connection_route (db->htree_arena, hier_start_list, (const char *)signames->data);
+    }
+
+    ig_lib_hier_list_free (hier_paths, hier_start_list);
+
+    return hier_tree;
+}
+
+/* create ports, pins, declaration and net of a signal from its hierarchy tree - local_name overrides local names if not NULL */
+static struct ig_net *ig_lib_connection_process (struct ig_lib_db *db, struct ig_lib_htree *hier_tree, const char *signame, const char *local_name)
+{
+    log_debug ("LConn", "processing hierarchy tree...");
+    GList *gen_objs_res = ig_lib_htree_process_signal (db, hier_tree, local_name);
+
+    if (gen_objs_res != NULL) {
+        log_info ("LConn", "successfully created signal %s", signame);
+    } else {
+        log_warn ("LConn", "nothing created for signal %s", signame);
+    }
+
+    struct ig_net *net = ig_lib_add_net (db, signame, gen_objs_res);
+
+    g_list_free (gen_objs_res);
+
+    return net;
+}
+
+/* create all signals of a bundle from its hierarchy tree - routing is the same for all members, only names differ */
+static GList *ig_lib_connection_process_bundle (struct ig_lib_db *db, struct ig_lib_htree *hier_tree, GList *signames)
+{
+    GList *nets = NULL;
+
+    for (GList *li = signames; li != NULL; li = li->next) {
+        const char *i_name = (const char *)li->data;
+
+        nets = g_list_prepend (nets, ig_lib_connection_process (db, hier_tree, i_name, (signames->next != NULL ? i_name : NULL)));
+    }
+
+    return g_list_reverse (nets);
+}
+
+bool ig_lib_connection (struct ig_lib_db *db, const char *signame, struct ig_lib_connection_info *source, GList *targets, struct ig_net **gen_net)
+{
+    GList                signames  = {(gpointer)signame, NULL, NULL};
+    struct ig_lib_htree *hier_tree = ig_lib_connection_htree (db, &signames, source, targets);
+
+    if (hier_tree == NULL) {
+        ig_arena_reset (db->htree_arena);
+        return false;
+    }
+
+    struct ig_net *net = ig_lib_connection_process (db, hier_tree, signame, NULL);
+
+    if (gen_net != NULL) {
+        *gen_net = net;
+    }
+
+    log_debug ("LConn", "deleting hierarchy tree...");
+    ig_arena_reset (db->htree_arena);
+
+    log_debug ("LConn", "finished...");
+    return true;
+}
+
+bool ig_lib_connection_bundle (struct ig_lib_db *db, GList *signames, struct ig_lib_connection_info *source, GList *targets, GList **gen_nets)
+{
+    if (signames == NULL) {
+        if (source != NULL) ig_lib_connection_info_free (source);
+        for (GList *li = targets; li != NULL; li = li->next) {
+            ig_lib_connection_info_free ((struct ig_lib_connection_info *)li->data);
+        }
+        g_list_free (targets);
+        return false;
+    }
+
+    struct ig_lib_htree *hier_tree = ig_lib_connection_htree (db, signames, source, targets);
+
+    if (hier_tree == NULL) {
+        ig_arena_reset (db->htree_arena);
+        return false;
+    }
+
+    GList *nets = ig_lib_connection_process_bundle (db, hier_tree, signames);
+
+    if (gen_nets != NULL) {
+        *gen_nets = nets;
+    } else {
+        g_list_free (nets);
+    }
+
+    log_debug ("LConn", "deleting hierarchy tree...");
+    ig_arena_reset (db->htree_arena);
+
+    log_debug ("LConn", "finished...");
+    return true;
+}
+
+/* queued connection of deferred mode */
+struct ig_lib_connection_request {
+    GList                         *signames;        /* signal names in database string storage */
+    struct ig_lib_connection_info *source;          /* source as given to ig_lib_connection_defer, owned by hier_paths after commit */
+    GList                         *targets;         /* targets as given to ig_lib_connection_defer */
+    gpointer                       data;            /* user data for commit callback */
+    GDestroyNotify                 data_destroy;    /* free function of user data or NULL */
+
+    GList                         *hier_paths;      /* hierarchy paths of all endpoints */
+    GList                         *hier_start_list; /* start cursors of hier_paths */
+    bool                           paths_valid;     /* hierarchy paths could be created for all endpoints */
+    GPtrArray                     *paths_log;       /* captured log messages of path creation */
+    struct ig_lib_htree           *hier_tree;       /* routing result, allocated in the arena of the slice */
+    GPtrArray                     *route_log;       /* captured log messages of routing */
+    GPtrArray                     *post_log;        /* captured log messages of the caller after queueing, see ig_lib_connection_defer_log */
+};
+
+/* range of queued connections routed by one worker: trees share a scratch arena separate from the database */
+struct ig_lib_connection_slice {
+    GPtrArray       *queue; /* queue of deferred connections */
+    guint            start; /* first queue index of slice */
+    guint            end;   /* queue index after last one of slice */
+    struct ig_arena *arena; /* memory of hierarchy trees in this slice */
+};
+
+static void ig_lib_connection_request_free (struct ig_lib_connection_request *req)
+{
+    if (req->source != NULL) ig_lib_connection_info_free (req->source);
+    for (GList *li = req->targets; li != NULL; li = li->next) {
+        ig_lib_connection_info_free ((struct ig_lib_connection_info *)li->data);
+    }
+    g_list_free (req->targets);
+    g_list_free (req->signames);
+
+    ig_lib_hier_list_free (req->hier_paths, req->hier_start_list);
+
+    log_capture_free (req->paths_log);
+    log_capture_free (req->route_log);
+    log_capture_free (req->post_log);
+
+    if (req->data_destroy != NULL) req->data_destroy (req->data);
+
+    g_slice_free (struct ig_lib_connection_request, req);
 }
 
-struct ig_rf_reg *ig_lib_add_regfile_reg (struct ig_lib_db *db, const char *name, struct ig_rf_entry *parent)
+/* worker thread function: route the queued connections of a slice, log messages are kept for the commit */
+static void ig_lib_connection_slice_route (gpointer data, gpointer user_data)
 {
-    if (db == NULL) return NULL;
-    if (name == NULL) return NULL;
-    if (parent == NULL) return NULL;
+    struct ig_lib_connection_slice *slice = (struct ig_lib_connection_slice *)data;
 
-    log_debug ("LARfR", "new reg %s for regfile-entrty %s...", name, IG_OBJECT (parent)->name);
-    struct ig_rf_reg *reg = ig_rf_reg_new (name, parent, db->str_chunks);
+    for (guint i = slice->start; i < slice->end; i++) {
+        struct ig_lib_connection_request *req = (struct ig_lib_connection_request *)g_ptr_array_index (slice->queue, i);
+        if (!req->paths_valid) continue;
 
-    if (reg == NULL) {
-        log_error ("LARfR", "error while creating new reg %s for regfile-entry %s", name, IG_OBJECT (parent)->name);
-        return NULL;
+        log_capture_begin ();
+        req->hier_tree = ig_lib_connection_route (slice->arena, req->hier_start_list, (const char *)req->signames->data);
+        req->route_log = log_capture_end ();
     }
+}
 
-    char *l_id = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (reg)->id);
-
-    if (g_hash_table_contains (db->objects_by_id, l_id)) {
-        log_error ("LARfR", "Regfile-reg %s already exists in regfile-entry %s", IG_OBJECT (reg)->name, IG_OBJECT (parent)->name);
-        ig_rf_reg_free (reg);
+void ig_lib_connection_defer_begin (struct ig_lib_db *db)
+{
+    if (db == NULL) return;
+    if (db->conn_deferred != NULL) return;
 
-        reg = NULL;
-    } else {
-        g_queue_push_tail (parent->regs, reg);
-        ig_obj_ref (IG_OBJECT (reg));
+    db->conn_deferred   = g_ptr_array_new_with_free_func ((GDestroyNotify)ig_lib_connection_request_free);
+    db->conn_failed_msg = g_string_new (NULL);
+    db->conn_failed     = 0;
+}
 
-        g_hash_table_insert (db->objects_by_id, l_id, IG_OBJECT (reg));
-        ig_obj_ref (IG_OBJECT (reg));
-        log_debug ("LARfR", "...added reg %s for regfile-entry %s", name, IG_OBJECT (parent)->name);
-    }
+void ig_lib_connection_defer_end (struct ig_lib_db *db)
+{
+    if (db == NULL) return;
+    if (db->conn_deferred == NULL) return;
 
-    return reg;
+    g_ptr_array_free (db->conn_deferred, true);
+    g_string_free (db->conn_failed_msg, true);
+    db->conn_deferred   = NULL;
+    db->conn_failed_msg = NULL;
+    db->conn_failed     = 0;
 }
 
-
-bool ig_lib_connection (struct ig_lib_db *db, const char *signame, struct ig_lib_connection_info *source, GList *targets, struct ig_net **gen_net)
+void ig_lib_connection_defer_log (struct ig_lib_db *db, GPtrArray *captured)
 {
-    GList *hier_start_list = NULL;
+    if (captured == NULL) return;
 
-    log_debug ("LConn", "creating individual hierarchies...");
-    bool error = false;
+    if ((db == NULL) || (db->conn_deferred == NULL) || (db->conn_deferred->len == 0)) {
+        log_capture_replay (captured);
+        return;
+    }
 
-    if (source != NULL) {
-        source->dir         = IG_LCDIR_UP;
-        source->is_explicit = true;
-        log_debug ("LConn", "creating startpoint hierarchy...");
-        GList *source_hier = ig_lib_gen_hierarchy (db, source);
-        if (source_hier == NULL) {
-            error = true;
-        } else {
-            hier_start_list = g_list_prepend (hier_start_list, source_hier);
+    struct ig_lib_connection_request *req = (struct ig_lib_connection_request *)g_ptr_array_index (db->conn_deferred, db->conn_deferred->len - 1);
+    if (req->post_log == NULL) {
+        req->post_log = captured;
+    } else {
+        log_capture_append (req->post_log, captured);
+    }
+}
+
+bool ig_lib_connection_defer (struct ig_lib_db *db, GList *signames, struct ig_lib_connection_info *source, GList *targets, gpointer data, GDestroyNotify data_destroy)
+{
+    if ((db == NULL) || (db->conn_deferred == NULL) || (signames == NULL)) {
+        if (source != NULL) ig_lib_connection_info_free (source);
+        for (GList *li = targets; li != NULL; li = li->next) {
+            ig_lib_connection_info_free ((struct ig_lib_connection_info *)li->data);
         }
-        log_debug ("LConn", "startpoint hierarchy depth: %d", g_list_length (source_hier));
+        g_list_free (targets);
+        if (data_destroy != NULL) data_destroy (data);
+        return false;
     }
 
-    for (GList *li = targets; li != NULL; li = li->next) {
-        struct ig_lib_connection_info *start = (struct ig_lib_connection_info *)li->data;
-        start->is_explicit = true;
+    struct ig_lib_connection_request *req = g_slice_new0 (struct ig_lib_connection_request);
 
-        log_debug ("LConn", "creating targetpoint hierarchy...");
-        GList *target_hier = ig_lib_gen_hierarchy (db, start);
-        if (target_hier == NULL) {
-            error = true;
-        } else {
-            hier_start_list = g_list_prepend (hier_start_list, target_hier);
-        }
-        log_debug ("LConn", "targetpoint hierarchy depth: %d", g_list_length (target_hier));
+    for (GList *li = signames; li != NULL; li = li->next) {
+        req->signames = g_list_prepend (req->signames, g_string_chunk_insert_const (db->str_chunks, (const char *)li->data));
     }
+    req->signames     = g_list_reverse (req->signames);
+    req->source       = source;
+    req->targets      = targets;
+    req->data         = data;
+    req->data_destroy = data_destroy;
 
-    g_list_free (targets);
+    g_ptr_array_add (db->conn_deferred, req);
 
-    bool result = true;
+    return true;
+}
 
-    if (error) {
-        result = false;
-        goto l_ig_lib_connection_final_free_hierlist;
-    }
+guint ig_lib_connection_commit (struct ig_lib_db *db, guint n_threads, ig_lib_connection_commit_func commit_func, gpointer commit_data)
+{
+    if (db == NULL) return 0;
+    if ((db->conn_deferred == NULL) || (db->conn_deferred->len == 0)) return 0;
 
-    if (g_hash_table_contains (db->nets_by_name, signame)) {
-        log_error ("LConn", "signal %s already exists", signame);
-        result = false;
-        goto l_ig_lib_connection_final_free_hierlist;
-    }
+    GPtrArray *queue   = db->conn_deferred;
+    guint      n_route = 0;
+    guint      n_fail  = 0;
 
-    log_debug ("LConn", "merging to hierarchy tree...");
-    /* create hierarchy tree */
-    GNode *hier_tree = ig_lib_merge_hierarchy_list (db, hier_start_list, signame);
+    log_debug ("LConn", "committing %d deferred connections...", queue->len);
 
-    if (hier_tree == NULL) {
-        result = false;
-        goto l_ig_lib_connection_final_free_hierlist;
-    }
+    /* hierarchy paths: sequential, the path cache is shared */
+    for (guint i = 0; i < queue->len; i++) {
+        struct ig_lib_connection_request *req = (struct ig_lib_connection_request *)g_ptr_array_index (queue, i);
 
-    log_debug ("LConn", "printing hierarchy tree...");
-    /* debug: printout */
-    ig_lib_htree_print (hier_tree);
+        log_capture_begin ();
+        req->paths_valid = ig_lib_connection_paths (db, req->signames, req->source, req->targets, &req->hier_paths, &req->hier_start_list);
+        req->source      = NULL;
+        req->targets     = NULL;
+        req->paths_log   = log_capture_end ();
 
-    log_debug ("LConn", "reducing hierarchy tree...");
-    hier_tree = ig_lib_htree_reduce (hier_tree);
-    if (hier_tree == NULL) {
-        log_warn ("LConn", "Unable to create signal %s, because of insufficient hierarchy information.", signame);
-        result = false;
-        goto l_ig_lib_connection_final_free_hierlist;
+        if (!req->paths_valid) continue;
+
+        /* object IDs are generated on first use - not in worker threads */
+        for (GList *li = req->hier_start_list; li != NULL; li = li->next) {
+            for (struct ig_lib_connection_info **lp = (struct ig_lib_connection_info **)li->data; *lp != NULL; lp++) {
+                ig_obj_id ((*lp)->obj);
+            }
+        }
+        n_route++;
     }
 
-    ig_lib_htree_print (hier_tree);
+    /* routing: independent for all connections, in contiguous slices of the queue -
+     * several slices per thread for load balancing, the arena of a slice is released when its connections are committed */
+    guint                           n_slices = MIN (queue->len, 4 * MAX (n_threads, 1));
+    struct ig_lib_connection_slice *slices   = g_new (struct ig_lib_connection_slice, n_slices);
+    for (guint i = 0; i < n_slices; i++) {
+        slices[i].queue = queue;
+        slices[i].start = (guint)(((guint64)queue->len * i) / n_slices);
+        slices[i].end   = (guint)(((guint64)queue->len * (i + 1)) / n_slices);
+        slices[i].arena = ig_arena_new ();
+    }
 
-    log_debug ("LConn", "processing hierarchy tree...");
-    GList *gen_objs_res = ig_lib_htree_process_signal (db, hier_tree);
-    if (gen_objs_res != NULL) {
-        log_info ("LConn", "successfully created signal %s", signame);
+    if ((n_threads > 1) && (n_route > 1)) {
+        GThreadPool *pool = g_thread_pool_new (ig_lib_connection_slice_route, NULL, MIN (n_threads, n_slices), true, NULL);
+        for (guint i = 0; i < n_slices; i++) {
+            g_thread_pool_push (pool, &slices[i], NULL);
+        }
+        g_thread_pool_free (pool, false, true);
     } else {
-        log_warn ("LConn", "nothing created for signal %s", signame);
+        for (guint i = 0; i < n_slices; i++) {
+            ig_lib_connection_slice_route (&slices[i], NULL);
+        }
     }
 
-    struct ig_net *net = ig_lib_add_net (db, signame, gen_objs_res);
+    /* commit in queue order with log messages in the order of immediate mode */
+    guint i_slice = 0;
+    for (guint i = 0; i < queue->len; i++) {
+        struct ig_lib_connection_request *req = (struct ig_lib_connection_request *)g_ptr_array_index (queue, i);
+        GList                            *nets = NULL;
 
-    if (gen_net != NULL) {
-        *gen_net = net;
-    }
+        log_capture_replay (req->paths_log);
+        req->paths_log = NULL;
 
-    g_list_free (gen_objs_res);
+        if (req->paths_valid && ig_lib_connection_check_names (db, req->signames)) {
+            log_capture_replay (req->route_log);
+            req->route_log = NULL;
+        }
 
-    log_debug ("LConn", "deleting hierarchy tree...");
-    ig_lib_htree_free (hier_tree);
+        if (req->route_log != NULL) {
+            /* not routed in immediate mode */
+            n_fail++;
+        } else if (req->hier_tree == NULL) {
+            n_fail++;
+        } else {
+            nets = ig_lib_connection_process_bundle (db, req->hier_tree, req->signames);
 
-l_ig_lib_connection_final_free_hierlist:
-    for (GList *li = hier_start_list; li != NULL; li = li->next) {
-        GList *hier = (GList *)li->data;
-        for (GList *lj = hier; lj != NULL; lj = lj->next) {
-            struct ig_lib_connection_info *cinfo = (struct ig_lib_connection_info *)lj->data;
-            ig_lib_connection_info_free (cinfo);
+            log_debug ("LConn", "deleting hierarchy tree...");
+            req->hier_tree = NULL;
+
+            log_debug ("LConn", "finished...");
+        }
+
+        if (i + 1 == slices[i_slice].end) {
+            ig_arena_free (slices[i_slice].arena);
+            slices[i_slice].arena = NULL;
+            i_slice++;
         }
-        g_list_free (hier);
+
+        if (commit_func != NULL) commit_func (db, nets, req->data, commit_data);
+        g_list_free (nets);
+
+        log_capture_replay (req->post_log);
+        req->post_log = NULL;
     }
-    g_list_free (hier_start_list);
 
-    log_debug ("LConn", "finished...");
-    return result;
+    g_free (slices);
+    g_ptr_array_set_size (queue, 0);
+
+    db->conn_failed += n_fail;
+
+    return n_fail;
 }
 
 bool ig_lib_parameter (struct ig_lib_db *db, const char *parname, const char *defvalue, GList *targets, struct ig_generic **gen_generic)
 {
+    GList *hier_paths      = NULL;
     GList *hier_start_list = NULL;
 
     log_debug ("LParm", "creating individual hierarchies...");
@@ -509,13 +1590,9 @@ bool ig_lib_parameter (struct ig_lib_db *db, const char *parname, const char *de
         start->is_explicit = true;
 
         log_debug ("LParm", "creating targetpoint hierarchy...");
-        GList *target_hier = ig_lib_gen_hierarchy (db, start);
-        if (target_hier == NULL) {
+        if (!ig_lib_hier_list_add (db, start, &hier_paths, &hier_start_list)) {
             error = true;
-        } else {
-            hier_start_list = g_list_prepend (hier_start_list, target_hier);
         }
-        log_debug ("LParm", "targetpoint hierarchy depth: %d", g_list_length (target_hier));
     }
 
     g_list_free (targets);
@@ -527,7 +1604,7 @@ bool ig_lib_parameter (struct ig_lib_db *db, const char *parname, const char *de
         goto l_ig_lib_parameter_final_free_hierlist;
     }
 
-    if (g_hash_table_contains (db->generics_by_name, parname)) {
+    if ((ig_lib_db_name_lookup (db->generics_by_name, parname) != NULL)) {
         log_error ("LParm", "parameter %s already exists", parname);
         result = false;
         goto l_ig_lib_parameter_final_free_hierlist;
@@ -535,7 +1612,7 @@ bool ig_lib_parameter (struct ig_lib_db *db, const char *parname, const char *de
 
     log_debug ("LParm", "merging to hierarchy tree...");
     /* create hierarchy tree */
-    GNode *hier_tree = ig_lib_merge_hierarchy_list (db, hier_start_list, parname);
+    struct ig_lib_htree *hier_tree = ig_lib_htree_merge (db->htree_arena, hier_start_list, parname);
 
     if (hier_tree == NULL) {
         result = false;
@@ -547,8 +1624,7 @@ bool ig_lib_parameter (struct ig_lib_db *db, const char *parname, const char *de
     ig_lib_htree_print (hier_tree);
 
     log_debug ("LParm", "reducing hierarchy tree...");
-    hier_tree = ig_lib_htree_reduce (hier_tree);
-    if (hier_tree == NULL) {
+    if (!ig_lib_htree_reduce (hier_tree)) {
         log_warn ("LParm", "Unable to create parameter %s, because of insufficient hierarchy information.", parname);
         result = false;
         goto l_ig_lib_parameter_final_free_hierlist;
@@ -565,6 +1641,7 @@ bool ig_lib_parameter (struct ig_lib_db *db, const char *parname, const char *de
     }
 
     struct ig_generic *generic = ig_lib_add_generic (db, parname, gen_objs_res);
+    ig_eval_cache_clear (db);
 
     if (gen_generic != NULL) {
         *gen_generic = generic;
@@ -573,147 +1650,244 @@ bool ig_lib_parameter (struct ig_lib_db *db, const char *parname, const char *de
     g_list_free (gen_objs_res);
 
     log_debug ("LParm", "deleting hierarchy tree...");
-    ig_lib_htree_free (hier_tree);
 
 
 l_ig_lib_parameter_final_free_hierlist:
-    for (GList *li = hier_start_list; li != NULL; li = li->next) {
-        GList *hier = (GList *)li->data;
-        for (GList *lj = hier; lj != NULL; lj = lj->next) {
-            struct ig_lib_connection_info *cinfo = (struct ig_lib_connection_info *)lj->data;
-            ig_lib_connection_info_free (cinfo);
-        }
-        g_list_free (hier);
-    }
-    g_list_free (hier_start_list);
+    ig_arena_reset (db->htree_arena);
+    ig_lib_hier_list_free (hier_paths, hier_start_list);
 
     return result;
 }
 
 
-static GNode *ig_lib_merge_hierarchy_list (struct ig_lib_db *db, GList *hier_list, const char *signame)
+static guint ig_lib_merge_hierarchy_list (struct ig_lib_htree *tree, struct ig_lib_connection_info ***hier_list, guint n_hier, const char *signame)
 {
-    if (db == NULL) return NULL;
-    if (hier_list == NULL) return NULL;
+    if (tree == NULL) return IG_LIB_HTREE_NONE;
+    if (n_hier == 0) return IG_LIB_HTREE_NONE;
 
     log_debug ("LMrHi", "merging a hierarchy level...");
 
-    GNode *result = NULL;
-
     /* check for equality */
-    GList                         *lhier_first = (GList *)hier_list->data;
-    struct ig_lib_connection_info *cinfo_first = (struct ig_lib_connection_info *)lhier_first->data;
+    struct ig_lib_connection_info **lhier_first = hier_list[0];
+    struct ig_lib_connection_info  *cinfo_first = *lhier_first;
 
-    struct ig_lib_connection_info *cinfo_node = ig_lib_connection_info_copy (db->str_chunks, cinfo_first);
-    if (cinfo_node == NULL) return NULL;
-    log_debug ("LMrHi", "reference node: %s", cinfo_first->obj->id);
+    struct ig_lib_connection_info cinfo_node = *cinfo_first;
+    log_debug ("LMrHi", "reference node: %s", cinfo_first->obj->name);
 
-    GList *successor_list = NULL;
-    if (lhier_first->next != NULL) {
-        successor_list = g_list_prepend (successor_list, lhier_first->next);
-    }
+    guint n_succ = (lhier_first[1] != NULL ? 1 : 0);
 
-    for (GList *li = hier_list->next; li != NULL; li = li->next) {
-        GList *lhier = (GList *)li->data;
+    for (guint i = 1; i < n_hier; i++) {
+        struct ig_lib_connection_info **lhier = hier_list[i];
         if (lhier == NULL) continue;
-        struct ig_lib_connection_info *i_cinfo = (struct ig_lib_connection_info *)lhier->data;
-        log_debug ("LMrHi", "current node: %s", i_cinfo->obj->id);
+        struct ig_lib_connection_info *i_cinfo = *lhier;
+        log_debug ("LMrHi", "current node: %s", i_cinfo->obj->name);
 
         /* object equality */
-        if (i_cinfo->obj != cinfo_node->obj) {
-            log_error ("LMrHi", "hierarchy has no common start (%s and %s)", i_cinfo->obj->id, cinfo_node->obj->id);
-            ig_lib_connection_info_free (cinfo_node);
-            g_list_free (successor_list);
-            return NULL;
+        if (i_cinfo->obj != cinfo_node.obj) {
+            log_error ("LMrHi", "hierarchy has no common start (%s and %s)", ig_obj_id (i_cinfo->obj), ig_obj_id (cinfo_node.obj));
+            return IG_LIB_HTREE_NONE;
         }
 
         /* local name? */
         if (i_cinfo->local_name != NULL) {
-            cinfo_node->local_name = i_cinfo->local_name;
-            cinfo_node->force_name = i_cinfo->force_name;
+            cinfo_node.local_name = i_cinfo->local_name;
+            cinfo_node.force_name = i_cinfo->force_name;
         }
 
         /* dir merge */
-        if (cinfo_node->dir == IG_LCDIR_DEFAULT) {
-            cinfo_node->dir = i_cinfo->dir;
-        } else if ((i_cinfo->dir != IG_LCDIR_DEFAULT) && (i_cinfo->dir != cinfo_node->dir)) {
+        if (cinfo_node.dir == IG_LCDIR_DEFAULT) {
+            cinfo_node.dir = i_cinfo->dir;
+        } else if ((i_cinfo->dir != IG_LCDIR_DEFAULT) && (i_cinfo->dir != cinfo_node.dir)) {
             log_warn ("LMrHi", "merging ports to bidirectional");
-            cinfo_node->dir = IG_LCDIR_BIDIR;
+            cinfo_node.dir = IG_LCDIR_BIDIR;
         }
 
         /* inv merge */
-        cinfo_node->invert = (cinfo_node->invert || i_cinfo->invert);
+        cinfo_node.invert = (cinfo_node.invert || i_cinfo->invert);
 
         /* explicit */
-        if (i_cinfo->is_explicit) cinfo_node->is_explicit = true;
+        if (i_cinfo->is_explicit) cinfo_node.is_explicit = true;
 
-        if (lhier->next != NULL) {
-            successor_list = g_list_prepend (successor_list, lhier->next);
-        }
+        if (lhier[1] != NULL) n_succ++;
     }
 
-    if (cinfo_node->local_name == NULL) cinfo_node->local_name = signame;
-    result = g_node_new (cinfo_node);
+    if (cinfo_node.local_name == NULL) cinfo_node.local_name = signame;
+    guint result = ig_lib_htree_node_new (tree, &cinfo_node);
 
-    log_debug ("LMrHi", "generating subhierarchies (successor_list size is %d)...", g_list_length (successor_list));
+    /* successors in reverse order of hier_list */
+    struct ig_lib_connection_info ***succ       = (struct ig_lib_connection_info ***)ig_arena_alloc (tree->arena, n_succ * sizeof (struct ig_lib_connection_info **));
+    struct ig_lib_connection_info ***equal_list = (struct ig_lib_connection_info ***)ig_arena_alloc (tree->arena, n_succ * sizeof (struct ig_lib_connection_info **));
+    bool                            *succ_done  = (bool *)ig_arena_alloc (tree->arena, n_succ * sizeof (bool));
+    guint                           *succ_next  = (guint *)ig_arena_alloc (tree->arena, n_succ * sizeof (guint));
 
-    const char *local_default_name = cinfo_node->local_name;
-    if (cinfo_node->force_name) {
-        local_default_name = ig_lib_rm_suffix_pinport (db, local_default_name);
+    guint i_succ = 0;
+    for (guint i = n_hier; i > 0; i--) {
+        struct ig_lib_connection_info **lhier = hier_list[i-1];
+        if ((lhier == NULL) || (lhier[1] == NULL)) continue;
+        succ[i_succ++] = lhier + 1;
+    }
+
+    /* successors bucketed by object (keeping succ order), buckets are linked via succ_next:
+     * only successors of the same object can be merged, so grouping needs only one bucket scan
+     * instead of a scan of all remaining successors for each child (high-fanout nets).
+     * short lists are kept in a single bucket to save the hash table.
+     * the hash table stores bucket head + 1, so a missing entry yields IG_LIB_HTREE_NONE. */
+    GHashTable *obj_buckets = NULL;
+    guint       all_bucket  = IG_LIB_HTREE_NONE;
+
+    if (n_succ > IG_LIB_MERGE_BUCKET_MIN) {
+        obj_buckets = g_hash_table_new (g_direct_hash, g_direct_equal);
+    }
+    for (guint i = n_succ; i > 0; i--) {
+        if (obj_buckets == NULL) {
+            succ_next[i-1] = all_bucket;
+            all_bucket     = i-1;
+            continue;
+        }
+        struct ig_object *obj = (*succ[i-1])->obj;
+        succ_next[i-1] = GPOINTER_TO_UINT (g_hash_table_lookup (obj_buckets, obj)) - 1;
+        g_hash_table_insert (obj_buckets, obj, GUINT_TO_POINTER (i));
+    }
+
+    log_debug ("LMrHi", "generating subhierarchies (successor_list size is %d)...", n_succ);
+
+    const char *local_default_name = cinfo_node.local_name;
+    if (cinfo_node.force_name) {
+        local_default_name = ig_lib_rm_suffix_pinport (tree->arena, local_default_name);
     }
 
     /* generate children */
-    while (successor_list != NULL) {
-        /* pick one */
-        GList                         *equal_list    = successor_list;
-        GList                         *ref_hier_list = (GList *)equal_list->data;
-        struct ig_lib_connection_info *ref_cinfo     = (struct ig_lib_connection_info *)ref_hier_list->data;
-        log_debug ("LMrHi", "current node: %s", ref_cinfo->obj->id);
+    for (guint i = 0; i < n_succ; i++) {
+        if (succ_done[i]) continue;
+
+        /* pick one - first remaining element of its bucket */
+        struct ig_lib_connection_info *ref_cinfo = *succ[i];
+        log_debug ("LMrHi", "current node: %s", ref_cinfo->obj->name);
 
-        successor_list = g_list_remove_link (successor_list, equal_list);
+        guint bucket  = all_bucket;
+        guint n_equal = 0;
+        if (obj_buckets != NULL) {
+            bucket = GPOINTER_TO_UINT (g_hash_table_lookup (obj_buckets, ref_cinfo->obj)) - 1;
+        }
 
-        GList *li = successor_list;
-        while (li != NULL) {
-            GList                         *i_hier_list = (GList *)li->data;
-            struct ig_lib_connection_info *i_cinfo     = (struct ig_lib_connection_info *)i_hier_list->data;
+        guint i_prev = IG_LIB_HTREE_NONE;
+        guint i_cur  = bucket;
+        while (i_cur != IG_LIB_HTREE_NONE) {
+            struct ig_lib_connection_info *i_cinfo = *succ[i_cur];
+            guint                          i_next  = succ_next[i_cur];
 
             if (i_cinfo->obj != ref_cinfo->obj) {
-                li = li->next;
+                i_prev = i_cur;
+                i_cur  = i_next;
                 continue;
             }
             /* don't merge different names */
-            if ((i_cinfo->local_name != NULL) && (ref_cinfo->local_name != NULL)) {
+            if ((i_cur != i) && (i_cinfo->local_name != NULL) && (ref_cinfo->local_name != NULL)) {
                 if (strcmp (i_cinfo->local_name, ref_cinfo->local_name) != 0) {
-                    li = li->next;
+                    i_prev = i_cur;
+                    i_cur  = i_next;
                     continue;
                 }
             }
 
             /* part of equal list */
-            GList *li_next = li->next;
-            successor_list = g_list_remove_link (successor_list, li);
-            equal_list     = g_list_concat (equal_list, li);
-            li             = li_next;
+            equal_list[n_equal++] = succ[i_cur];
+            succ_done[i_cur]      = true;
+            if (i_prev == IG_LIB_HTREE_NONE) {
+                bucket = i_next;
+            } else {
+                succ_next[i_prev] = i_next;
+            }
+            i_cur = i_next;
+        }
+        if (obj_buckets != NULL) {
+            g_hash_table_insert (obj_buckets, ref_cinfo->obj, GUINT_TO_POINTER (bucket + 1));
+        } else {
+            all_bucket = bucket;
         }
 
-        GNode *child_node = ig_lib_merge_hierarchy_list (db, equal_list, local_default_name);
-
-        child_node = g_node_insert (result, 0, child_node);
+        /* equal_list is only used up to the return of the recursion and can be reused for the next child */
+        guint child = ig_lib_merge_hierarchy_list (tree, equal_list, n_equal, local_default_name);
+        if (child == IG_LIB_HTREE_NONE) continue;
 
-        g_list_free (equal_list);
+        /* insert as first child - node array may have been moved by recursion */
+        tree->nodes[child].parent       = result;
+        tree->nodes[child].next_sibling = tree->nodes[result].first_child;
+        tree->nodes[result].first_child = child;
     }
 
+    if (obj_buckets != NULL) g_hash_table_destroy (obj_buckets);
+
     return result;
 }
 
 
-static GList *ig_lib_gen_hierarchy (struct ig_lib_db *db, struct ig_lib_connection_info *cinfo)
+/* next object towards the hierarchy root in a signal/parameter path or NULL at the root */
+static struct ig_object *ig_lib_hier_next (struct ig_object *obj)
+{
+    if (obj->type == IG_OBJ_INSTANCE) return IG_OBJECT (IG_INSTANCE (obj)->parent);
+    if (obj->type == IG_OBJ_MODULE)   return IG_OBJECT (IG_MODULE (obj)->default_instance);
+
+    return NULL;
+}
+
+/*
+ * cached path of plain hierarchy elements (no local name, not explicit) from root down to obj,
+ * NULL-terminated and shared between all endpoints below obj
+ */
+static struct ig_lib_connection_info **ig_lib_hier_cache_path (struct ig_lib_db *db, struct ig_object *obj, enum ig_lib_connection_dir dir, guint *len)
+{
+    struct ig_lib_hier_key key = {obj, dir};
+
+    struct ig_lib_connection_info **result = (struct ig_lib_connection_info **)g_hash_table_lookup (db->hier_paths, &key);
+    if (result != NULL) {
+        for (*len = 0; result[*len] != NULL; (*len)++);
+        return result;
+    }
+
+    struct ig_object *next = ig_lib_hier_next (obj);
+
+    guint                           next_len  = 0;
+    struct ig_lib_connection_info **next_path = NULL;
+    if (next != NULL) {
+        next_path = ig_lib_hier_cache_path (db, next, dir, &next_len);
+    }
+
+    struct ig_lib_connection_info *cinfo = ig_arena_new0 (db->hier_paths_arena, struct ig_lib_connection_info);
+    cinfo->obj         = obj;
+    cinfo->dir         = dir;
+    cinfo->is_explicit = false;
+    cinfo->force_name  = false;
+    cinfo->invert      = false;
+    cinfo->local_name  = NULL;
+    cinfo->parent_name = NULL;
+
+    result = (struct ig_lib_connection_info **)ig_arena_alloc (db->hier_paths_arena, (next_len + 2) * sizeof (struct ig_lib_connection_info *));
+    if (next_len > 0) {
+        memcpy (result, next_path, next_len * sizeof (struct ig_lib_connection_info *));
+    }
+    result[next_len]     = cinfo;
+    result[next_len + 1] = NULL;
+
+    struct ig_lib_hier_key *l_key = ig_arena_new0 (db->hier_paths_arena, struct ig_lib_hier_key);
+    *l_key = key;
+    g_hash_table_insert (db->hier_paths, l_key, result);
+
+    *len = next_len + 1;
+    return result;
+}
+
+static bool ig_lib_gen_hierarchy (struct ig_lib_db *db, struct ig_lib_connection_info *cinfo, struct ig_lib_hier_path *path)
 {
-    GList *result = NULL;
+    /* elements specific to this endpoint, prepended so the topmost comes first */
+    GList *private_list = NULL;
 
     bool copy_first    = false;
     bool explicit_next = false;
 
+    path->levels   = NULL;
+    path->n_shared = 0;
+
     /* startpoint is instance of generated module? */
     if (cinfo->obj->type == IG_OBJ_INSTANCE) {
         struct ig_instance *inst = IG_INSTANCE (cinfo->obj);
@@ -733,25 +1907,27 @@ static GList *ig_lib_gen_hierarchy (struct ig_lib_db *db, struct ig_lib_connecti
     }
 
     log_debug ("LGnHi", "creating hierarchy list...");
+    /* remaining path above the private elements is a plain path of this object */
+    struct ig_object *shared_obj = NULL;
     while (true) {
-        if (cinfo == NULL) return result;
-
-        log_debug ("LGnHi", "hierarchy element: %s", cinfo->obj->id);
+        log_debug ("LGnHi", "hierarchy element: %s", cinfo->obj->name);
 
         if (cinfo->obj->type == IG_OBJ_INSTANCE) {
-            result = g_list_prepend (result, cinfo);
+            private_list = g_list_prepend (private_list, cinfo);
             struct ig_instance *inst = IG_INSTANCE (cinfo->obj);
-            if (inst->parent == NULL) return result;
-            cinfo = ig_lib_connection_info_new (db->str_chunks, IG_OBJECT (inst->parent), NULL, cinfo->dir);
+            if (inst->parent == NULL) break;
             if (explicit_next) {
+                cinfo = ig_lib_connection_info_new (db->str_chunks, IG_OBJECT (inst->parent), NULL, cinfo->dir);
                 cinfo->is_explicit = true;
                 explicit_next      = false;
+                continue;
             }
-            continue;
+            shared_obj = IG_OBJECT (inst->parent);
+            break;
         } else if (cinfo->obj->type == IG_OBJ_MODULE) {
-            result = g_list_prepend (result, cinfo);
+            private_list = g_list_prepend (private_list, cinfo);
             struct ig_module *mod = IG_MODULE (cinfo->obj);
-            if (mod->default_instance == NULL) return result;
+            if (mod->default_instance == NULL) break;
             if (copy_first) {
                 bool force_name = cinfo->force_name;
                 bool invert     = cinfo->invert;
@@ -759,22 +1935,178 @@ static GList *ig_lib_gen_hierarchy (struct ig_lib_db *db, struct ig_lib_connecti
                 cinfo->force_name = force_name;
                 cinfo->invert     = invert;
                 copy_first        = false;
-            } else {
-                cinfo = ig_lib_connection_info_new (db->str_chunks, IG_OBJECT (mod->default_instance), NULL, cinfo->dir);
+                continue;
             }
-            continue;
+            shared_obj = IG_OBJECT (mod->default_instance);
+            break;
         } else {
             log_errorint ("LGnHi", "object of invalid type in module/instance hierarchy");
             ig_lib_connection_info_free (cinfo);
-            for (GList *li = result; li != NULL; li = li->next) {
+            for (GList *li = private_list; li != NULL; li = li->next) {
                 ig_lib_connection_info_free ((struct ig_lib_connection_info *)li->data);
             }
-            g_list_free (result);
-            return NULL;
+            g_list_free (private_list);
+            return false;
+        }
+    }
+
+    guint                           n_shared = 0;
+    struct ig_lib_connection_info **shared   = NULL;
+    if (shared_obj != NULL) {
+        shared = ig_lib_hier_cache_path (db, shared_obj, cinfo->dir, &n_shared);
+    }
+
+    guint n_private = g_list_length (private_list);
+
+    path->levels   = g_new (struct ig_lib_connection_info *, n_shared + n_private + 1);
+    path->n_shared = n_shared;
+    if (n_shared > 0) {
+        memcpy (path->levels, shared, n_shared * sizeof (struct ig_lib_connection_info *));
+    }
+
+    guint i = n_shared;
+    for (GList *li = private_list; li != NULL; li = li->next) {
+        path->levels[i++] = (struct ig_lib_connection_info *)li->data;
+    }
+    path->levels[i] = NULL;
+
+    g_list_free (private_list);
+
+    log_debug ("LGnHi", "hierarchy depth: %d (%d cached)", n_shared + n_private, n_shared);
+
+    return true;
+}
+
+/* free elements of path not shared with the path cache */
+static void ig_lib_hier_path_free (struct ig_lib_hier_path *path)
+{
+    if (path->levels == NULL) return;
+
+    for (guint i = path->n_shared; path->levels[i] != NULL; i++) {
+        ig_lib_connection_info_free (path->levels[i]);
+    }
+    g_free (path->levels);
+
+    path->levels   = NULL;
+    path->n_shared = 0;
+}
+
+/* fingerprint: strings are length-prefixed, so concatenations cannot collide */
+static void ig_lib_fp_str (GChecksum *checksum, const char *str)
+{
+    guint32 len = (str == NULL ? G_MAXUINT32 : strlen (str));
+
+    g_checksum_update (checksum, (const guchar *)&len, sizeof (len));
+    if (str != NULL) {
+        g_checksum_update (checksum, (const guchar *)str, len);
+    }
+}
+
+/* add Object-ID of object and on first visit its attributes - returns true on first visit */
+static bool ig_lib_fp_obj (GChecksum *checksum, GHashTable *visited, struct ig_object *obj)
+{
+    if (obj == NULL) {
+        ig_lib_fp_str (checksum, NULL);
+        return false;
+    }
+
+    ig_lib_fp_str (checksum, ig_obj_id (obj));
+
+    if (g_hash_table_contains (visited, obj)) return false;
+    g_hash_table_insert (visited, obj, obj);
+
+    GList *keys = g_list_sort (ig_obj_attr_get_keys (obj), (GCompareFunc)strcmp);
+    for (GList *li = keys; li != NULL; li = li->next) {
+        ig_lib_fp_str (checksum, (const char *)li->data);
+        ig_lib_fp_str (checksum, ig_obj_attr_get (obj, (const char *)li->data));
+    }
+    g_list_free (keys);
+
+    return true;
+}
+
+static void ig_lib_fp_tree (GChecksum *checksum, GHashTable *visited, struct ig_object *obj, bool child_instances);
+
+static void ig_lib_fp_array (GChecksum *checksum, GHashTable *visited, struct ig_obj_array *array, bool child_instances)
+{
+    guint32 len = ig_obj_array_len (array);
+
+    g_checksum_update (checksum, (const guchar *)&len, sizeof (len));
+    for (guint i = 0; i < len; i++) {
+        ig_lib_fp_tree (checksum, visited, PTR_TO_IG_OBJECT (ig_obj_array_index (array, i)), child_instances);
+    }
+}
+
+static void ig_lib_fp_tree (GChecksum *checksum, GHashTable *visited, struct ig_object *obj, bool child_instances)
+{
+    if (!ig_lib_fp_obj (checksum, visited, obj)) return;
+
+    switch (obj->type) {
+        case IG_OBJ_PORT:        ig_lib_fp_tree (checksum, visited, PTR_TO_IG_OBJECT (IG_PORT (obj)->net),           false); break;
+        case IG_OBJ_PIN:         ig_lib_fp_tree (checksum, visited, PTR_TO_IG_OBJECT (IG_PIN (obj)->net),            false); break;
+        case IG_OBJ_DECLARATION: ig_lib_fp_tree (checksum, visited, PTR_TO_IG_OBJECT (IG_DECL (obj)->net),           false); break;
+        case IG_OBJ_PARAMETER:   ig_lib_fp_tree (checksum, visited, PTR_TO_IG_OBJECT (IG_PARAM (obj)->generic),      false); break;
+        case IG_OBJ_ADJUSTMENT:  ig_lib_fp_tree (checksum, visited, PTR_TO_IG_OBJECT (IG_ADJUSTMENT (obj)->generic), false); break;
+        case IG_OBJ_CODESECTION:
+        case IG_OBJ_REGFILE_REG:
+            break;
+        case IG_OBJ_MODULE: {
+            struct ig_module *mod = IG_MODULE (obj);
+            ig_lib_fp_array (checksum, visited, &mod->params,   false);
+            ig_lib_fp_array (checksum, visited, &mod->ports,    false);
+            ig_lib_fp_array (checksum, visited, &mod->decls,    false);
+            ig_lib_fp_array (checksum, visited, &mod->code,     false);
+            ig_lib_fp_array (checksum, visited, &mod->regfiles, false);
+            if (child_instances) {
+                ig_lib_fp_array (checksum, visited, &mod->child_instances, false);
+            }
+            break;
+        }
+        case IG_OBJ_INSTANCE: {
+            struct ig_instance *inst = IG_INSTANCE (obj);
+            /* interface of instanciated module, but not its content */
+            ig_lib_fp_tree  (checksum, visited, IG_OBJECT (inst->module), false);
+            ig_lib_fp_array (checksum, visited, &inst->adjustments, false);
+            ig_lib_fp_array (checksum, visited, &inst->pins,        false);
+            break;
+        }
+        case IG_OBJ_REGFILE:
+            ig_lib_fp_obj   (checksum, visited, IG_OBJECT (IG_RF_REGFILE (obj)->parent));
+            ig_lib_fp_array (checksum, visited, &IG_RF_REGFILE (obj)->entries, false);
+            break;
+        case IG_OBJ_REGFILE_ENTRY:
+            ig_lib_fp_array (checksum, visited, &IG_RF_ENTRY (obj)->regs, false);
+            break;
+        case IG_OBJ_NET:
+        case IG_OBJ_GENERIC: {
+            /* other endpoints are only referenced by Object-ID */
+            struct ig_obj_array *objects = (obj->type == IG_OBJ_NET ? &IG_NET (obj)->objects : &IG_GENERIC (obj)->objects);
+            for (guint i = 0; i < ig_obj_array_len (objects); i++) {
+                ig_lib_fp_str (checksum, ig_obj_id (PTR_TO_IG_OBJECT (ig_obj_array_index (objects, i))));
+            }
+            break;
         }
     }
 }
 
+char *ig_lib_obj_fingerprint (struct ig_object *obj, const char *data)
+{
+    if (obj == NULL) return NULL;
+
+    GChecksum  *checksum = g_checksum_new (G_CHECKSUM_SHA1);
+    GHashTable *visited  = g_hash_table_new (g_direct_hash, g_direct_equal);
+
+    ig_lib_fp_str  (checksum, data);
+    ig_lib_fp_tree (checksum, visited, obj, true);
+
+    char *result = g_strdup (g_checksum_get_string (checksum));
+
+    g_hash_table_destroy (visited);
+    g_checksum_free (checksum);
+
+    return result;
+}
+
 struct ig_lib_connection_info *ig_lib_connection_info_new (GStringChunk *str_chunks, struct ig_object *obj, const char *local_name, enum ig_lib_connection_dir dir)
 {
     if (obj == NULL) return NULL;
@@ -845,17 +2177,60 @@ void ig_lib_connection_info_free (struct ig_lib_connection_info *cinfo)
 #endif
 }
 
-static void ig_lib_htree_print (GNode *hier_tree)
+static guint ig_lib_htree_node_new (struct ig_lib_htree *tree, const struct ig_lib_connection_info *cinfo)
+{
+    if (tree->n_nodes == tree->alloc) {
+        guint                     alloc = (tree->alloc == 0 ? IG_LIB_HTREE_NODES_MIN : 2 * tree->alloc);
+        struct ig_lib_htree_node *nodes = (struct ig_lib_htree_node *)ig_arena_alloc (tree->arena, alloc * sizeof (struct ig_lib_htree_node));
+
+        if (tree->n_nodes > 0) memcpy (nodes, tree->nodes, tree->n_nodes * sizeof (struct ig_lib_htree_node));
+        tree->nodes = nodes;
+        tree->alloc = alloc;
+    }
+
+    guint                     result = tree->n_nodes++;
+    struct ig_lib_htree_node *node   = &tree->nodes[result];
+
+    node->cinfo        = *cinfo;
+    node->parent       = IG_LIB_HTREE_NONE;
+    node->first_child  = IG_LIB_HTREE_NONE;
+    node->next_sibling = IG_LIB_HTREE_NONE;
+
+    return result;
+}
+
+static guint ig_lib_htree_n_children (struct ig_lib_htree *tree, guint node)
+{
+    guint result = 0;
+
+    for (guint in = tree->nodes[node].first_child; in != IG_LIB_HTREE_NONE; in = tree->nodes[in].next_sibling) {
+        result++;
+    }
+
+    return result;
+}
+
+/* successor of node in pre-order traversal of the tree or IG_LIB_HTREE_NONE at the end */
+static guint ig_lib_htree_next (struct ig_lib_htree *tree, guint node)
 {
-    GList *pr_stack  = NULL;
-    int    pr_indent = 0;
+    if (tree->nodes[node].first_child != IG_LIB_HTREE_NONE) return tree->nodes[node].first_child;
+
+    while (node != tree->root) {
+        if (tree->nodes[node].next_sibling != IG_LIB_HTREE_NONE) return tree->nodes[node].next_sibling;
+        node = tree->nodes[node].parent;
+    }
+
+    return IG_LIB_HTREE_NONE;
+}
 
-    pr_stack = g_list_prepend (pr_stack, hier_tree);
+static void ig_lib_htree_print (struct ig_lib_htree *tree)
+{
+    guint i_node    = tree->root;
+    int   pr_indent = 0;
 
-    while (pr_stack != NULL) {
-        GNode *i_node = (GNode *)pr_stack->data;
-        log_debug ("LPHTr", "current node: depth=%d, n_children=%d", g_node_depth (i_node), g_node_n_children (i_node));
-        struct ig_lib_connection_info *i_info = (struct ig_lib_connection_info *)i_node->data;
+    while (i_node != IG_LIB_HTREE_NONE) {
+        log_debug ("LPHTr", "current node: depth=%d, n_children=%d", pr_indent + 1, ig_lib_htree_n_children (tree, i_node));
+        struct ig_lib_connection_info *i_info = &tree->nodes[i_node].cinfo;
 
         /* print node */
         GString *str_t = g_string_new (NULL);
@@ -877,7 +2252,7 @@ static void ig_lib_htree_print (GNode *hier_tree)
             str_t = g_string_append (str_t, "-?- ");
         }
 
-        str_t = g_string_append (str_t, i_info->obj->id);
+        str_t = g_string_append (str_t, ig_obj_id (i_info->obj));
         str_t = g_string_append (str_t, ".");
         if (i_info->invert) {
             str_t = g_string_append (str_t, "~");
@@ -894,90 +2269,86 @@ static void ig_lib_htree_print (GNode *hier_tree)
         log_debug ("HTree", "%s", str_t->str);
         g_string_free (str_t, true);
 
-        /* modify stack and continue */
-        if (g_node_first_child (i_node) != NULL) {
+        /* descend or continue with next sibling of node or its parents */
+        if (tree->nodes[i_node].first_child != IG_LIB_HTREE_NONE) {
             log_debug ("LPHTr", "node has child...");
             pr_indent++;
-            pr_stack = g_list_prepend (pr_stack, g_node_first_child (i_node));
+            i_node = tree->nodes[i_node].first_child;
             continue;
         }
 
-        while (pr_stack != NULL) {
-            i_node = (GNode *)pr_stack->data;
-            if (g_node_next_sibling (i_node) != NULL) {
+        while (i_node != IG_LIB_HTREE_NONE) {
+            if ((i_node != tree->root) && (tree->nodes[i_node].next_sibling != IG_LIB_HTREE_NONE)) {
                 log_debug ("LPHTr", "node has sibling...");
-                pr_stack->data = g_node_next_sibling (i_node);
+                i_node = tree->nodes[i_node].next_sibling;
                 break;
             }
             log_debug ("LPHTr", "node is last one in subhierarchy...");
             pr_indent--;
-            GList *temp = pr_stack;
-            pr_stack = g_list_remove_link (pr_stack, temp);
-            g_list_free (temp);
+            i_node = (i_node == tree->root ? IG_LIB_HTREE_NONE : tree->nodes[i_node].parent);
         }
     }
 }
 
-static GNode *ig_lib_htree_reduce (GNode *hier_tree)
+/* move root of tree down to the first explicit or branching node - false if there is none */
+static bool ig_lib_htree_reduce (struct ig_lib_htree *tree)
 {
-    GNode *temp = hier_tree;
+    guint temp = tree->root;
 
     for (;;) {
-        if (g_node_n_children (temp) > 1) break;
-        temp = g_node_first_child (temp);
+        if (ig_lib_htree_n_children (tree, temp) > 1) break;
+        temp = tree->nodes[temp].first_child;
 
-        if (temp == NULL) break;
+        if (temp == IG_LIB_HTREE_NONE) break;
 
-        struct ig_lib_connection_info *cinfo = (struct ig_lib_connection_info *)temp->data;
-        if (cinfo->is_explicit) break;
+        if (tree->nodes[temp].cinfo.is_explicit) break;
     }
 
-    if (temp == NULL) {
-        if (hier_tree != NULL) ig_lib_htree_free (hier_tree);
+    if (temp == IG_LIB_HTREE_NONE) {
         log_debug ("HTrRd", "!htree_reduce returns NULL!");
-        return NULL;
+        return false;
     }
 
-    g_node_unlink (temp);
-    ig_lib_htree_free (hier_tree);
+    /* unlink new root - nodes above are left unused in the arena */
+    tree->nodes[temp].parent       = IG_LIB_HTREE_NONE;
+    tree->nodes[temp].next_sibling = IG_LIB_HTREE_NONE;
+    tree->root                     = temp;
 
-    return temp;
+    return true;
 }
 
-struct ig_lib_htree_process_signal_data {
-    struct ig_lib_db *db;
-    GList            *gen_objs;
-};
-
-static GList *ig_lib_htree_process_signal (struct ig_lib_db *db, GNode *hier_tree)
+static GList *ig_lib_htree_process_signal (struct ig_lib_db *db, struct ig_lib_htree *tree, const char *signame)
 {
-    struct ig_lib_htree_process_signal_data data = {db, NULL};
+    GList *gen_objs = NULL;
 
-    g_node_traverse (hier_tree, G_PRE_ORDER, G_TRAVERSE_ALL, -1, ig_lib_htree_process_signal_tfunc, &data);
+    /* pre-order: parent_name of children is set when processing their parent */
+    for (guint node = tree->root; node != IG_LIB_HTREE_NONE; node = ig_lib_htree_next (tree, node)) {
+        ig_lib_htree_process_signal_node (db, tree, node, signame, &gen_objs);
+    }
 
-    return data.gen_objs;
+    return gen_objs;
 }
 
-static gboolean ig_lib_htree_process_signal_tfunc (GNode *node, gpointer data)
+static void ig_lib_htree_process_signal_node (struct ig_lib_db *db, struct ig_lib_htree *tree, guint node, const char *signame, GList **gen_objs)
 {
-    struct ig_lib_htree_process_signal_data *pdata = (struct ig_lib_htree_process_signal_data *)data;
-
-    struct ig_lib_connection_info *cinfo = (struct ig_lib_connection_info *)node->data;
-    struct ig_lib_db              *db    = (struct ig_lib_db *)pdata->db;
+    struct ig_lib_connection_info *cinfo = &tree->nodes[node].cinfo;
 
     struct ig_object *obj = cinfo->obj;
 
     const char *local_name  = cinfo->local_name;
     const char *parent_name = cinfo->parent_name;
 
-    log_debug ("HTrPS", "processing node %s", obj->id);
+    /* signal bundles: tree is shared between signals with default local names */
+    if (signame != NULL) local_name = signame;
+
+    log_debug ("HTrPS", "processing node %s", obj->name);
 
     if (obj->type == IG_OBJ_INSTANCE) {
         struct ig_instance *inst = IG_INSTANCE (obj);
 
         const char *conn_name = parent_name;
         if (conn_name == NULL) {
-            log_error ("HTrPS", "No connection for signal %s in instance %s", local_name, obj->id);
+            log_error ("HTrPS", "No connection for signal %s in instance %s", local_name, ig_obj_id (obj));
             conn_name = "";
         }
 
@@ -999,20 +2370,19 @@ static gboolean ig_lib_htree_process_signal_tfunc (GNode *node, gpointer data)
         struct ig_pin *inst_pin = ig_lib_add_pin (db, inst, pin_name, conn_name, (cinfo->invert ? "true" : "false"));
         /* connecting the pin */
         if (inst_pin) {
-            pdata->gen_objs = g_list_prepend (pdata->gen_objs, IG_OBJECT (inst_pin));
-            log_debug ("CPin", "Created pin \"%s\" in instance \"%s\" connected to \"%s\"", pin_name, IG_OBJECT (inst)->id, conn_name);
+            *gen_objs = g_list_prepend (*gen_objs, IG_OBJECT (inst_pin));
+            log_debug ("CPin", "Created pin \"%s\" in instance \"%s\" connected to \"%s\"", pin_name, IG_OBJECT (inst)->name, conn_name);
         }
 
-        for (GNode *in = g_node_first_child (node); in != NULL; in = g_node_next_sibling (in)) {
-            struct ig_lib_connection_info *i_cinfo = (struct ig_lib_connection_info *)in->data;
-            i_cinfo->parent_name = pin_name;
+        for (guint in = tree->nodes[node].first_child; in != IG_LIB_HTREE_NONE; in = tree->nodes[in].next_sibling) {
+            tree->nodes[in].cinfo.parent_name = pin_name;
         }
     } else if (obj->type == IG_OBJ_MODULE) {
         struct ig_module *mod = IG_MODULE (obj);
 
         const char *signal_name = NULL;
 
-        if (G_NODE_IS_ROOT (node)) {
+        if (node == tree->root) {
             if (cinfo->force_name) {
                 signal_name = local_name;
             } else {
@@ -1020,22 +2390,23 @@ static gboolean ig_lib_htree_process_signal_tfunc (GNode *node, gpointer data)
             }
 
             /* create a declaration */
-            struct ig_decl *mod_decl = ig_decl_new (signal_name, NULL, true, mod, db->str_chunks);
-            if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (mod_decl)->id)) {
-                log_error ("HTrPS", "Already declared declaration %s", IG_OBJECT (mod_decl)->id);
+            struct ig_decl *mod_decl = ig_decl_new (signal_name, NULL, true, mod, db->str_chunks, db->arena);
+            if (g_hash_table_contains (db->objects_by_parent, IG_OBJECT (mod_decl))) {
+                log_error ("HTrPS", "Already declared declaration %s", ig_obj_id (IG_OBJECT (mod_decl)));
                 ig_decl_free (mod_decl);
             } else {
-                g_hash_table_insert (db->objects_by_id, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod_decl)->id), IG_OBJECT (mod_decl));
+                ig_lib_db_register_object (db, IG_OBJECT (mod_decl));
                 ig_obj_ref (IG_OBJECT (mod_decl));
-                g_queue_push_tail (mod->decls, mod_decl);
+                ig_obj_array_add (db->arena, &mod->decls, mod_decl);
                 ig_obj_ref (IG_OBJECT (mod_decl));
-                pdata->gen_objs = g_list_prepend (pdata->gen_objs, IG_OBJECT (mod_decl));
-                log_debug ("HTrPS", "Created declaration \"%s\" in module \"%s\"", signal_name, IG_OBJECT (mod)->id);
+                ig_obj_modified (IG_OBJECT (mod));
+                *gen_objs = g_list_prepend (*gen_objs, IG_OBJECT (mod_decl));
+                log_debug ("HTrPS", "Created declaration \"%s\" in module \"%s\"", signal_name, IG_OBJECT (mod)->name);
             }
         } else {
             signal_name = parent_name;
             if (signal_name == NULL) {
-                log_error ("HTrPS", "No pin for signal %s in instance of module %s", local_name, obj->id);
+                log_error ("HTrPS", "No pin for signal %s in instance of module %s", local_name, ig_obj_id (obj));
                 signal_name = "";
             }
 
@@ -1046,162 +2417,134 @@ static gboolean ig_lib_htree_process_signal_tfunc (GNode *node, gpointer data)
                 pdir = IG_PD_BIDIR;
             }
             /* create a port */
-            struct ig_port *mod_port = ig_port_new (signal_name, pdir, mod, db->str_chunks);
-            if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (mod_port)->id)) {
-                log_error ("HTrPS", "Already declared port %s", IG_OBJECT (mod_port)->id);
+            struct ig_port *mod_port = ig_port_new (signal_name, pdir, mod, db->str_chunks, db->arena);
+            if (g_hash_table_contains (db->objects_by_parent, IG_OBJECT (mod_port))) {
+                log_error ("HTrPS", "Already declared port %s", ig_obj_id (IG_OBJECT (mod_port)));
                 ig_port_free (mod_port);
             } else {
-                g_queue_push_tail (mod->ports, mod_port);
+                ig_obj_array_add (db->arena, &mod->ports, mod_port);
                 ig_obj_ref (IG_OBJECT (mod_port));
-                g_hash_table_insert (db->objects_by_id, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod_port)->id), IG_OBJECT (mod_port));
+                ig_obj_modified (IG_OBJECT (mod));
+                ig_lib_db_register_object (db, IG_OBJECT (mod_port));
                 ig_obj_ref (IG_OBJECT (mod_port));
-                pdata->gen_objs = g_list_prepend (pdata->gen_objs, IG_OBJECT (mod_port));
-                log_debug ("HTrPS", "Created port \"%s\" in module \"%s\"", signal_name, IG_OBJECT (mod)->id);
+                *gen_objs = g_list_prepend (*gen_objs, IG_OBJECT (mod_port));
+                log_debug ("HTrPS", "Created port \"%s\" in module \"%s\"", signal_name, IG_OBJECT (mod)->name);
             }
         }
 
-        for (GNode *in = g_node_first_child (node); in != NULL; in = g_node_next_sibling (in)) {
-            struct ig_lib_connection_info *i_cinfo = (struct ig_lib_connection_info *)in->data;
-            i_cinfo->parent_name = signal_name;
+        for (guint in = tree->nodes[node].first_child; in != IG_LIB_HTREE_NONE; in = tree->nodes[in].next_sibling) {
+            tree->nodes[in].cinfo.parent_name = signal_name;
         }
     } else {
         log_errorint ("HTrPS", "invalid object in hierarchy tree");
     }
-
-    return false;
 }
 
-struct ig_lib_htree_process_parameter_data {
-    struct ig_lib_db *db;
-    GList            *gen_objs;
-    const char       *defvalue;
-    bool              root_local;
-};
-
-static GList *ig_lib_htree_process_parameter (struct ig_lib_db *db, GNode *hier_tree, const char *defvalue)
+static GList *ig_lib_htree_process_parameter (struct ig_lib_db *db, struct ig_lib_htree *tree, const char *defvalue)
 {
-    struct ig_lib_htree_process_parameter_data data = {db, NULL, defvalue, false};
+    GList *gen_objs = NULL;
 
-    g_node_traverse (hier_tree, G_PRE_ORDER, G_TRAVERSE_ALL, -1, ig_lib_htree_process_parameter_tfunc, &data);
+    for (guint node = tree->root; node != IG_LIB_HTREE_NONE; node = ig_lib_htree_next (tree, node)) {
+        ig_lib_htree_process_parameter_node (db, tree, node, defvalue, false, &gen_objs);
+    }
 
-    return data.gen_objs;
+    return gen_objs;
 }
 
-static gboolean ig_lib_htree_process_parameter_tfunc (GNode *node, gpointer data)
+static void ig_lib_htree_process_parameter_node (struct ig_lib_db *db, struct ig_lib_htree *tree, guint node, const char *defvalue, bool root_local, GList **gen_objs)
 {
-    struct ig_lib_htree_process_parameter_data *pdata = (struct ig_lib_htree_process_parameter_data *)data;
-
-    struct ig_lib_connection_info *cinfo    = (struct ig_lib_connection_info *)node->data;
-    struct ig_lib_db              *db       = pdata->db;
-    const char                    *defvalue = pdata->defvalue;
+    struct ig_lib_connection_info *cinfo = &tree->nodes[node].cinfo;
 
     struct ig_object *obj = cinfo->obj;
 
     const char *local_name  = cinfo->local_name;
     const char *parent_name = cinfo->parent_name;
 
-    log_debug ("HTrPP", "processing node %s", obj->id);
+    log_debug ("HTrPP", "processing node %s", obj->name);
 
     if (obj->type == IG_OBJ_INSTANCE) {
         struct ig_instance *inst = IG_INSTANCE (obj);
 
         const char *adj_name = parent_name;
         if (adj_name == NULL) {
-            log_error ("HTrPP", "No value for parameter adjustment %s in instance %s", local_name, obj->id);
+            log_error ("HTrPP", "No value for parameter adjustment %s in instance %s", local_name, ig_obj_id (obj));
             adj_name = "";
         }
 
         const char *par_name = local_name;
 
         /* create an adjustment */
-        struct ig_adjustment *inst_adj = ig_adjustment_new (par_name, adj_name, inst, db->str_chunks);
-        if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (inst_adj)->id)) {
-            log_error ("HTrPP", "Already declared parameter adjustment %s", IG_OBJECT (inst_adj)->id);
+        struct ig_adjustment *inst_adj = ig_adjustment_new (par_name, adj_name, inst, db->str_chunks, db->arena);
+        if (g_hash_table_contains (db->objects_by_parent, IG_OBJECT (inst_adj))) {
+            log_error ("HTrPP", "Already declared parameter adjustment %s", ig_obj_id (IG_OBJECT (inst_adj)));
             ig_adjustment_free (inst_adj);
         } else {
-            g_hash_table_insert (db->objects_by_id, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (inst_adj)->id), IG_OBJECT (inst_adj));
+            ig_lib_db_register_object (db, IG_OBJECT (inst_adj));
             ig_obj_ref (IG_OBJECT (inst_adj));
-            g_queue_push_tail (inst->adjustments, inst_adj);
+            ig_obj_array_add (db->arena, &inst->adjustments, inst_adj);
             ig_obj_ref (IG_OBJECT (inst_adj));
-            pdata->gen_objs = g_list_prepend (pdata->gen_objs, IG_OBJECT (inst_adj));
-            log_debug ("HTrPP", "Created adjustment of parameter \"%s\" in instance \"%s\" to value \"%s\"", par_name, IG_OBJECT (inst)->id, adj_name);
+            ig_obj_modified (IG_OBJECT (inst));
+            *gen_objs = g_list_prepend (*gen_objs, IG_OBJECT (inst_adj));
+            log_debug ("HTrPP", "Created adjustment of parameter \"%s\" in instance \"%s\" to value \"%s\"", par_name, IG_OBJECT (inst)->name, adj_name);
         }
-        for (GNode *in = g_node_first_child (node); in != NULL; in = g_node_next_sibling (in)) {
-            struct ig_lib_connection_info *i_cinfo = (struct ig_lib_connection_info *)in->data;
-            i_cinfo->parent_name = par_name;
+        for (guint in = tree->nodes[node].first_child; in != IG_LIB_HTREE_NONE; in = tree->nodes[in].next_sibling) {
+            tree->nodes[in].cinfo.parent_name = par_name;
         }
     } else if (obj->type == IG_OBJ_MODULE) {
         struct ig_module *mod = IG_MODULE (obj);
 
         const char *par_name = NULL;
 
-        if (pdata->root_local && G_NODE_IS_ROOT (node)) {
+        if (root_local && (node == tree->root)) {
             par_name = local_name;
 
             /* create a local parameter */
-            struct ig_param *mod_param = ig_param_new (par_name, defvalue, true, mod, db->str_chunks);
-            if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (mod_param)->id)) {
-                log_error ("HTrPP", "Already declared parameter %s", IG_OBJECT (mod_param)->id);
+            struct ig_param *mod_param = ig_param_new (par_name, defvalue, true, mod, db->str_chunks, db->arena);
+            if (g_hash_table_contains (db->objects_by_parent, IG_OBJECT (mod_param))) {
+                log_error ("HTrPP", "Already declared parameter %s", ig_obj_id (IG_OBJECT (mod_param)));
                 ig_param_free (mod_param);
             } else {
-                g_hash_table_insert (db->objects_by_id, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod_param)->id), IG_OBJECT (mod_param));
+                ig_lib_db_register_object (db, IG_OBJECT (mod_param));
                 ig_obj_ref (IG_OBJECT (mod_param));
-                g_queue_push_tail (mod->params, mod_param);
+                ig_obj_array_add (db->arena, &mod->params, mod_param);
                 ig_obj_ref (IG_OBJECT (mod_param));
-                pdata->gen_objs = g_list_prepend (pdata->gen_objs, IG_OBJECT (mod_param));
-                log_debug ("HTrPP", "Created local parameter \"%s\" in module \"%s\"", par_name, IG_OBJECT (mod)->id);
+                ig_obj_modified (IG_OBJECT (mod));
+                *gen_objs = g_list_prepend (*gen_objs, IG_OBJECT (mod_param));
+                log_debug ("HTrPP", "Created local parameter \"%s\" in module \"%s\"", par_name, IG_OBJECT (mod)->name);
             }
         } else {
-            if (G_NODE_IS_ROOT (node)) {
+            if (node == tree->root) {
                 par_name = local_name;
             } else {
                 par_name = parent_name;
             }
             if (par_name == NULL) {
-                log_error ("HTrPP", "No module-parameter for parameter %s in module %s", local_name, obj->id);
+                log_error ("HTrPP", "No module-parameter for parameter %s in module %s", local_name, ig_obj_id (obj));
                 par_name = "";
             }
 
             /* create a parameter */
-            struct ig_param *mod_param = ig_param_new (par_name, defvalue, false, mod, db->str_chunks);
-            if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (mod_param)->id)) {
-                log_error ("HTrPP", "Already declared parameter %s", IG_OBJECT (mod_param)->id);
+            struct ig_param *mod_param = ig_param_new (par_name, defvalue, false, mod, db->str_chunks, db->arena);
+            if (g_hash_table_contains (db->objects_by_parent, IG_OBJECT (mod_param))) {
+                log_error ("HTrPP", "Already declared parameter %s", ig_obj_id (IG_OBJECT (mod_param)));
                 ig_param_free (mod_param);
             } else {
-                g_hash_table_insert (db->objects_by_id, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod_param)->id), IG_OBJECT (mod_param));
+                ig_lib_db_register_object (db, IG_OBJECT (mod_param));
                 ig_obj_ref (IG_OBJECT (mod_param));
-                g_queue_push_tail (mod->params, mod_param);
+                ig_obj_array_add (db->arena, &mod->params, mod_param);
                 ig_obj_ref (IG_OBJECT (mod_param));
-                pdata->gen_objs = g_list_prepend (pdata->gen_objs, IG_OBJECT (mod_param));
-                log_debug ("HTrPP", "Created parameter \"%s\" in module \"%s\"", par_name, IG_OBJECT (mod)->id);
+                ig_obj_modified (IG_OBJECT (mod));
+                *gen_objs = g_list_prepend (*gen_objs, IG_OBJECT (mod_param));
+                log_debug ("HTrPP", "Created parameter \"%s\" in module \"%s\"", par_name, IG_OBJECT (mod)->name);
             }
         }
 
-        for (GNode *in = g_node_first_child (node); in != NULL; in = g_node_next_sibling (in)) {
-            struct ig_lib_connection_info *i_cinfo = (struct ig_lib_connection_info *)in->data;
-            i_cinfo->parent_name = par_name;
+        for (guint in = tree->nodes[node].first_child; in != IG_LIB_HTREE_NONE; in = tree->nodes[in].next_sibling) {
+            tree->nodes[in].cinfo.parent_name = par_name;
         }
     } else {
         log_errorint ("HTrPP", "invalid object in hierarchy tree");
     }
-
-    return false;
-}
-
-static void ig_lib_htree_free (GNode *hier_tree)
-{
-    g_node_traverse (hier_tree, G_LEVEL_ORDER, G_TRAVERSE_ALL, -1, ig_lib_htree_free_tfunc, NULL);
-    g_node_destroy (hier_tree);
-}
-
-static gboolean ig_lib_htree_free_tfunc (GNode *node, gpointer data)
-{
-    struct ig_lib_connection_info *cinfo = (struct ig_lib_connection_info *)node->data;
-
-    ig_lib_connection_info_free (cinfo);
-    node->data = NULL;
-
-    return false;
 }
 
 static struct ig_net *ig_lib_add_net (struct ig_lib_db *db, const char *name, GList *objs)
@@ -1209,14 +2552,14 @@ static struct ig_net *ig_lib_add_net (struct ig_lib_db *db, const char *name, GL
     if (db == NULL) return NULL;
     if (name == NULL) return NULL;
 
-    struct ig_net *net = ig_net_new (name, db->str_chunks);
+    struct ig_net *net = ig_net_new (name, db->str_chunks, db->arena);
     if (net == NULL) return NULL;
 
     for (GList *li = objs; li != NULL; li = li->next) {
         struct ig_object *obj = PTR_TO_IG_OBJECT (li->data);
         ig_obj_attr_set (obj, "signal",  name,                true);
         ig_obj_attr_set (obj, "net",     name,                true);
-        ig_obj_attr_set (obj, "netid",   IG_OBJECT (net)->id, true);
+        ig_obj_attr_set (obj, "netid",   ig_obj_id (IG_OBJECT (net)), true);
 
         struct ig_net **obj_net_ptr = NULL;
 
@@ -1233,17 +2576,19 @@ static struct ig_net *ig_lib_add_net (struct ig_lib_db *db, const char *name, GL
         if (obj_net_ptr != NULL) {
             *obj_net_ptr = net;
         }
+        ig_lib_module_signal_update (db, obj);
 
         ig_obj_ref (obj);
-        g_queue_push_tail (net->objects, obj);
+        ig_obj_array_add (db->arena, &net->objects, obj);
+        ig_obj_modified (IG_OBJECT (net));
     }
 
-    char *l_name = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (net)->name);
-    char *l_id   = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (net)->id);
+    const char *l_name = IG_OBJECT (net)->name;
 
-    g_hash_table_insert (db->nets_by_name,  l_name, IG_OBJECT (net));
-    g_hash_table_insert (db->nets_by_id,    l_id,   IG_OBJECT (net));
-    g_hash_table_insert (db->objects_by_id, l_id,   IG_OBJECT (net));
+    ig_lib_db_register_object (db, IG_OBJECT (net));
+    g_hash_table_insert (db->nets_by_name, (gpointer)l_name, IG_OBJECT (net));
+    g_hash_table_insert (db->nets_by_id,   GUINT_TO_POINTER (IG_OBJECT (net)->handle), IG_OBJECT (net));
+    g_ptr_array_add (db->nets_ordered, IG_OBJECT (net));
     ig_obj_ref (IG_OBJECT (net));
     ig_obj_ref (IG_OBJECT (net));
     ig_obj_ref (IG_OBJECT (net));
@@ -1256,14 +2601,14 @@ static struct ig_generic *ig_lib_add_generic (struct ig_lib_db *db, const char *
     if (db == NULL) return NULL;
     if (name == NULL) return NULL;
 
-    struct ig_generic *generic = ig_generic_new (name, db->str_chunks);
+    struct ig_generic *generic = ig_generic_new (name, db->str_chunks, db->arena);
     if (generic == NULL) return NULL;
 
     for (GList *li = objs; li != NULL; li = li->next) {
         struct ig_object *obj = PTR_TO_IG_OBJECT (li->data);
         ig_obj_attr_set (obj, "parameter",   name,                    true);
         ig_obj_attr_set (obj, "generic",     name,                    true);
-        ig_obj_attr_set (obj, "genericid",   IG_OBJECT (generic)->id, true);
+        ig_obj_attr_set (obj, "genericid",   ig_obj_id (IG_OBJECT (generic)), true);
 
         struct ig_generic **obj_generic_ptr = NULL;
 
@@ -1280,15 +2625,16 @@ static struct ig_generic *ig_lib_add_generic (struct ig_lib_db *db, const char *
         }
 
         ig_obj_ref (obj);
-        g_queue_push_tail (generic->objects, obj);
+        ig_obj_array_add (db->arena, &generic->objects, obj);
+        ig_obj_modified (IG_OBJECT (generic));
     }
 
-    char *l_name = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (generic)->name);
-    char *l_id   = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (generic)->id);
+    const char *l_name = IG_OBJECT (generic)->name;
 
-    g_hash_table_insert (db->generics_by_name, l_name, IG_OBJECT (generic));
-    g_hash_table_insert (db->generics_by_id,   l_id,   IG_OBJECT (generic));
-    g_hash_table_insert (db->objects_by_id,    l_id,   IG_OBJECT (generic));
+    ig_lib_db_register_object (db, IG_OBJECT (generic));
+    g_hash_table_insert (db->generics_by_name, (gpointer)l_name, IG_OBJECT (generic));
+    g_hash_table_insert (db->generics_by_id,   GUINT_TO_POINTER (IG_OBJECT (generic)->handle), IG_OBJECT (generic));
+    g_ptr_array_add (db->generics_ordered, IG_OBJECT (generic));
     ig_obj_ref (IG_OBJECT (generic));
     ig_obj_ref (IG_OBJECT (generic));
     ig_obj_ref (IG_OBJECT (generic));
@@ -1356,35 +2702,34 @@ static char *ig_lib_gen_name_pinport (struct ig_lib_db *db, const char *basename
     return result;
 }
 
-static char *ig_lib_rm_suffix_pinport (struct ig_lib_db *db, const char *pinportname)
+static const char *ig_lib_rm_suffix_pinport (struct ig_arena *arena, const char *pinportname)
 {
     int len = strlen (pinportname);
 
     if (len < 3) {
-        return g_string_chunk_insert_const (db->str_chunks, pinportname);
+        return pinportname;
     }
 
     if (pinportname[len - 2] != '_') {
-        return g_string_chunk_insert_const (db->str_chunks, pinportname);
+        return pinportname;
     }
 
     if (ig_lib_gen_name_iscaps (pinportname)) {
         if ((pinportname[len - 1] == 'I') &&
             (pinportname[len - 1] == 'O') &&
             (pinportname[len - 1] == 'B')) {
-            return g_string_chunk_insert_const (db->str_chunks, pinportname);
+            return pinportname;
         }
     } else {
         if ((pinportname[len - 1] == 'i') &&
             (pinportname[len - 1] == 'o') &&
             (pinportname[len - 1] == 'b')) {
-            return g_string_chunk_insert_const (db->str_chunks, pinportname);
+            return pinportname;
         }
     }
 
-    GString *tstr   = g_string_new_len (pinportname, len - 2);
-    char    *result = g_string_chunk_insert_const (db->str_chunks, tstr->str);
-    g_string_free (tstr, true);
+    char *result = (char *)ig_arena_alloc (arena, len - 1);
+    memcpy (result, pinportname, len - 2);
 
     return result;
 }
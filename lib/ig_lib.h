@@ -36,26 +36,83 @@ extern "C" {
  * @brief Database struct with all available objects.
  *
  * For memory allocation/free see @ref ig_lib_db_new and @ref ig_lib_db_free.
+ * All objects of the database are allocated in @ref arena and are released at once
+ * by @ref ig_lib_db_clear or @ref ig_lib_db_free.
  */
 struct ig_lib_db {
-    GHashTable *objects_by_id;     /**< @brief Mapping of ID to objects. Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
+    GPtrArray  *objects_by_id;     /**< @brief All objects indexed by object handle (see @ref ig_object::handle), index 0 is unused. */
+    GHashTable *objects_by_parent; /**< @brief Mapping of (type, ID-parent, interned name) to objects with an ID-parent. Key/value: <tt> (struct @ref ig_object *) </tt> */
 
-    GHashTable *modules_by_name;   /**< @brief Mapping of module names to module object. Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
-    GHashTable *modules_by_id;     /**< @brief Mapping of Object-ID to module object. Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
+    GHashTable *modules_by_name;   /**< @brief Mapping of module names to module object. Key: <tt> (const char *) </tt> interned name, see @ref ig_lib_db_name_lookup -> value: <tt> (struct @ref ig_object *) </tt> */
+    GHashTable *modules_by_id;     /**< @brief Mapping of object handle to module object. Key: <tt> (GUINT_TO_POINTER (handle)) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
+    GPtrArray  *modules_ordered;   /**< @brief All module objects in insertion order. Data: <tt> (struct @ref ig_object *) </tt> */
 
-    GHashTable *instances_by_name; /**< @brief Mapping of instance names to instance object. Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
-    GHashTable *instances_by_id;   /**< @brief Mapping of Object-ID to instance object. Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
+    GHashTable *instances_by_name; /**< @brief Mapping of instance names to instance object. Key: <tt> (const char *) </tt> interned name, see @ref ig_lib_db_name_lookup -> value: <tt> (struct @ref ig_object *) </tt> */
+    GHashTable *instances_by_id;   /**< @brief Mapping of object handle to instance object. Key: <tt> (GUINT_TO_POINTER (handle)) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
+    GPtrArray  *instances_ordered; /**< @brief All instance objects in insertion order. Data: <tt> (struct @ref ig_object *) </tt> */
 
-    GHashTable *regfiles_by_name;  /**< @brief Mapping of regfile names to regfile object. Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
-    GHashTable *regfiles_by_id;    /**< @brief Mapping of Object-ID to regfile object. Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
+    GHashTable *regfiles_by_name;  /**< @brief Mapping of regfile names to regfile object. Key: <tt> (const char *) </tt> interned name, see @ref ig_lib_db_name_lookup -> value: <tt> (struct @ref ig_object *) </tt> */
+    GHashTable *regfiles_by_id;    /**< @brief Mapping of object handle to regfile object. Key: <tt> (GUINT_TO_POINTER (handle)) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
+    GPtrArray  *regfiles_ordered;  /**< @brief All regfile objects in insertion order. Data: <tt> (struct @ref ig_object *) </tt> */
 
-    GHashTable *nets_by_name;      /**< @brief Mapping of net names to net object. Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
-    GHashTable *nets_by_id;        /**< @brief Mapping of Object-ID to net object. Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
+    GHashTable *nets_by_name;      /**< @brief Mapping of net names to net object. Key: <tt> (const char *) </tt> interned name, see @ref ig_lib_db_name_lookup -> value: <tt> (struct @ref ig_object *) </tt> */
+    GHashTable *nets_by_id;        /**< @brief Mapping of object handle to net object. Key: <tt> (GUINT_TO_POINTER (handle)) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
+    GPtrArray  *nets_ordered;      /**< @brief All net objects in insertion order. Data: <tt> (struct @ref ig_object *) </tt> */
 
-    GHashTable *generics_by_name;  /**< @brief Mapping of generic names to generic object. Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
-    GHashTable *generics_by_id;    /**< @brief Mapping of Object-ID to generic object. Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
+    GHashTable *generics_by_name;  /**< @brief Mapping of generic names to generic object. Key: <tt> (const char *) </tt> interned name, see @ref ig_lib_db_name_lookup -> value: <tt> (struct @ref ig_object *) </tt> */
+    GHashTable *generics_by_id;    /**< @brief Mapping of object handle to generic object. Key: <tt> (GUINT_TO_POINTER (handle)) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
+    GPtrArray  *generics_ordered;  /**< @brief All generic objects in insertion order. Data: <tt> (struct @ref ig_object *) </tt> */
 
-    GStringChunk *str_chunks;      /**< @brief String container used for all generated objects. */
+    GHashTable      *hier_paths;       /**< @brief Cached signal/parameter paths from hierarchy root to module/instance objects, cleared when the hierarchy changes. */
+    struct ig_arena *hier_paths_arena; /**< @brief Memory container of cached paths in @ref hier_paths. */
+    struct ig_arena *htree_arena;      /**< @brief Scratch memory of hierarchy trees, reset after each connection/parameter. */
+    GHashTable      *module_signals;   /**< @brief Signal index of modules, see @ref ig_lib_module_signal. Key: <tt> (struct @ref ig_module *) </tt> -> value: <tt> (GHashTable *) </tt> of signal name -> port/declaration object. */
+    GHashTable      *param_values;     /**< @brief Memoized parameter values, see @ref ig_eval_parameter. */
+
+    GPtrArray       *conn_deferred;    /**< @brief Queued connections in deferred mode (see @ref ig_lib_connection_defer) or @c NULL if connections are created immediately. */
+    GString         *conn_failed_msg;  /**< @brief Error message of failed deferred connections for the caller (see @ref ig_lib_connection_commit) or @c NULL if not in deferred mode. */
+    guint            conn_failed;      /**< @brief Number of deferred connections that failed since deferred mode began. */
+
+    guint            generation;       /**< @brief Identifies database content: unique among all databases and changed by @ref ig_lib_db_clear. */
+    GStringChunk    *str_chunks;       /**< @brief String container used for all generated objects. */
+    struct ig_arena *arena;            /**< @brief Memory container all objects of the database are allocated in. */
+};
+
+/**
+ * @brief Number of hash tables in @ref ig_lib_db.
+ */
+#define IG_LIB_DB_TABLE_COUNT 11
+
+/**
+ * @brief Memory statistics of all objects of one type in a database.
+ */
+struct ig_lib_db_type_stats {
+    gsize count;        /**< @brief Number of objects. */
+    gsize struct_bytes; /**< @brief Bytes of object structs including their child object arrays. */
+    gsize attr_bytes;   /**< @brief Bytes of attribute tables (buckets and attribute entries). */
+    gsize string_bytes; /**< @brief Bytes of distinct strings, counted for the first object type referencing them. */
+};
+
+/**
+ * @brief Size statistics of one hash table in a database.
+ */
+struct ig_lib_db_table_stats {
+    const char *name;    /**< @brief Name of table in @ref ig_lib_db. */
+    guint       entries; /**< @brief Number of entries. */
+    guint       buckets; /**< @brief Number of buckets, estimated from the resize policy of glib. */
+    gsize       bytes;   /**< @brief Estimated bytes of bucket storage. */
+};
+
+/**
+ * @brief Memory statistics of a database.
+ *
+ * For filling see @ref ig_lib_db_stats.
+ */
+struct ig_lib_db_stats {
+    struct ig_lib_db_type_stats  types[IG_OBJ_TYPE_COUNT];      /**< @brief Object statistics indexed by @ref ig_object_type. */
+    struct ig_lib_db_table_stats tables[IG_LIB_DB_TABLE_COUNT]; /**< @brief Statistics of the lookup tables. */
+    gsize                        arena_used;                    /**< @brief Bytes handed out by the database arena. */
+    gsize                        arena_reserved;                /**< @brief Bytes allocated for the database arena. */
 };
 
 /**
@@ -92,6 +149,10 @@ struct ig_lib_db *ig_lib_db_new  ();
 /**
  * @brief Free icglue database content.
  * @param db Database to clear.
+ *
+ * Releases all objects of the database at once without walking their reference counts.
+ * The @ref ig_lib_db::generation of the database is changed, so references to old objects can be detected.
+ * Interned names (see @ref ig_str_intern) are released as well if no other database (e.g. a fork) exists.
  */
 void ig_lib_db_clear (struct ig_lib_db *db);
 
@@ -101,6 +162,89 @@ void ig_lib_db_clear (struct ig_lib_db *db);
  */
 void ig_lib_db_free (struct ig_lib_db *db);
 
+/**
+ * @brief Create a copy of a database sharing strings with the original.
+ * @param db Database to fork.
+ * @return The newly created database, free with @ref ig_lib_db_free.
+ *
+ * Object structs and lookup tables are copied with unchanged object handles,
+ * strings and attribute entries are shared copy-on-write: modifications of either database
+ * store new strings in its own container. The memory of the original database at fork time
+ * is released when the original and all its forks have been cleared or freed.
+ */
+struct ig_lib_db *ig_lib_db_fork (struct ig_lib_db *db);
+
+/**
+ * @brief Exchange content of two databases.
+ * @param db_a First database.
+ * @param db_b Second database.
+ *
+ * Used for switching the database a user interface works on without changing its database pointer.
+ * The @ref ig_lib_db::generation is exchanged as well, so references to objects of the previous content can be detected.
+ * Deferred mode of connections (see @ref ig_lib_connection_defer_begin) is not exchanged.
+ */
+void ig_lib_db_swap (struct ig_lib_db *db_a, struct ig_lib_db *db_b);
+
+/**
+ * @brief Look up object in a name table of a database.
+ * @param table Name table of database (e.g. @ref ig_lib_db::modules_by_name).
+ * @param name Name to look up, need not be interned.
+ * @return Object of table or @c NULL if not found.
+ *
+ * Name tables are keyed by names interned with @ref ig_str_intern and compared by pointer.
+ */
+gpointer ig_lib_db_name_lookup (GHashTable *table, const char *name);
+
+/**
+ * @brief Get object of database by Object-ID.
+ * @param db Database to search.
+ * @param id Object-ID of object.
+ * @return The object with the given Object-ID or @c NULL if not found.
+ *
+ * The Object-ID is resolved by its name components, so no Object-IDs are materialized for lookup.
+ */
+struct ig_object *ig_lib_db_get_object (struct ig_lib_db *db, const char *id);
+
+/**
+ * @brief Get object of database by handle.
+ * @param db Database to search.
+ * @param handle Handle of object.
+ * @return The object with the given handle or @c NULL if not found.
+ */
+struct ig_object *ig_lib_db_get_object_by_handle (struct ig_lib_db *db, guint32 handle);
+
+/**
+ * @brief Get port or declaration of a module by the signal it belongs to.
+ * @param db Database to search.
+ * @param mod Module to search.
+ * @param signame Signal name as in the "signal" attribute of ports and declarations.
+ * @return Port or declaration of the signal or @c NULL if not found.
+ *
+ * Ports take precedence over declarations, among objects of the same type the first one created is returned.
+ * The index of a module is built on first use and updated when nets are created.
+ */
+struct ig_object *ig_lib_module_signal (struct ig_lib_db *db, struct ig_module *mod, const char *signame);
+
+/**
+ * @brief Add an already initialized object to the database.
+ * @param db Database to modify.
+ * @param obj Object to add, allocated in the arena of the database.
+ *
+ * The object gets the next free handle and is added to the lookup tables of its type.
+ * No consistency checks are done, this is meant for restoring objects of a saved database
+ * in their original handle order (see @ref ig_snapshot_load).
+ */
+void ig_lib_db_restore_object (struct ig_lib_db *db, struct ig_object *obj);
+
+/**
+ * @brief Collect memory statistics of a database.
+ * @param db Database to inspect.
+ * @param stats Statistics struct to fill.
+ *
+ * All objects of the database are visited, so this is meant for occasional diagnostics only.
+ */
+void ig_lib_db_stats (struct ig_lib_db *db, struct ig_lib_db_stats *stats);
+
 /**
  * @brief Add a new module to the database.
  * @param db Database to modify.
@@ -205,6 +349,88 @@ void ig_lib_connection_info_free (struct ig_lib_connection_info *cinfo);
  */
 bool ig_lib_connection (struct ig_lib_db *db, const char *signame, struct ig_lib_connection_info *source, GList *targets, struct ig_net **gen_net);
 
+/**
+ * @brief Create a bundle of hierarchical signals with common endpoints.
+ * @param db Database to use.
+ * @param signames List of signal names. List data: <tt> (const char *) </tt>.
+ * @param source Signal source or @c NULL. Will be freed after usage.
+ * @param targets List of signal endpoints. List data: <tt> (struct @ref ig_lib_connection_info *) </tt>. Will be freed after usage.
+ * @param[out] gen_nets List of newly created nets in order of @c signames. List data: <tt> (struct @ref ig_net *) </tt>.
+ * @return true on success.
+ *
+ * The hierarchy tree is computed once and used for all signals of the bundle,
+ * so endpoints must not specify local signal names.
+ * @c source and @c targets will be freed on return, @c *gen_nets must be freed by caller.
+ */
+bool ig_lib_connection_bundle (struct ig_lib_db *db, GList *signames, struct ig_lib_connection_info *source, GList *targets, GList **gen_nets);
+
+/**
+ * @brief Callback for committed deferred connections.
+ * @param db Database the connection was created in.
+ * @param nets List of created nets in order of signal names or @c NULL if the connection failed. List data: <tt> (struct @ref ig_net *) </tt>.
+ * @param data User data of the connection given to @ref ig_lib_connection_defer.
+ * @param commit_data User data given to @ref ig_lib_connection_commit.
+ *
+ * @c nets is freed after the callback returns.
+ */
+typedef void (*ig_lib_connection_commit_func) (struct ig_lib_db *db, GList *nets, gpointer data, gpointer commit_data);
+
+/**
+ * @brief Enable deferred mode for connections.
+ * @param db Database to use.
+ *
+ * In deferred mode connections are queued by @ref ig_lib_connection_defer and created by @ref ig_lib_connection_commit.
+ * The caller has to commit queued connections before the database is accessed otherwise.
+ */
+void ig_lib_connection_defer_begin (struct ig_lib_db *db);
+
+/**
+ * @brief Disable deferred mode for connections.
+ * @param db Database to use.
+ *
+ * Connections still queued are discarded, so @ref ig_lib_connection_commit should be called before.
+ * Failures of committed connections (@ref ig_lib_db::conn_failed) are reset.
+ */
+void ig_lib_connection_defer_end (struct ig_lib_db *db);
+
+/**
+ * @brief Keep log messages in order with queued connections of deferred mode.
+ * @param db Database to use.
+ * @param captured Log messages captured by @ref log_capture_end, freed by this function.
+ *
+ * If connections are queued, the messages are printed by @ref ig_lib_connection_commit
+ * after the messages of the connections queued before, otherwise they are printed immediately.
+ */
+void ig_lib_connection_defer_log (struct ig_lib_db *db, GPtrArray *captured);
+
+/**
+ * @brief Queue a hierarchical signal (bundle) in deferred mode.
+ * @param db Database to use.
+ * @param signames List of signal names as for @ref ig_lib_connection_bundle, names are copied.
+ * @param source Signal source or @c NULL. Will be freed after usage.
+ * @param targets List of signal endpoints. List data: <tt> (struct @ref ig_lib_connection_info *) </tt>. Will be freed after usage.
+ * @param data User data passed to the commit callback.
+ * @param data_destroy Function to free @c data after commit or discard or @c NULL.
+ * @return @c false if @c db is not in deferred mode - nothing is queued then and all data is freed.
+ *
+ * A single signal name creates the signal like @ref ig_lib_connection, more names like @ref ig_lib_connection_bundle.
+ */
+bool ig_lib_connection_defer (struct ig_lib_db *db, GList *signames, struct ig_lib_connection_info *source, GList *targets, gpointer data, GDestroyNotify data_destroy);
+
+/**
+ * @brief Create all queued connections of deferred mode.
+ * @param db Database to use.
+ * @param n_threads Maximum number of worker threads for routing.
+ * @param commit_func Function called for each connection in queue order after its creation or @c NULL.
+ * @param commit_data User data passed to @c commit_func.
+ * @return Number of connections that could not be created.
+ *
+ * Hierarchy trees are computed in parallel, all objects are created in queue order,
+ * so object names and log messages are the same as in immediate mode.
+ * Failed connections are added to @ref ig_lib_db::conn_failed until deferred mode ends.
+ */
+guint ig_lib_connection_commit (struct ig_lib_db *db, guint n_threads, ig_lib_connection_commit_func commit_func, gpointer commit_data);
+
 /**
  * @brief Create hierarchical parameter.
  * @param db Database to use.
@@ -218,6 +444,19 @@ bool ig_lib_connection (struct ig_lib_db *db, const char *signame, struct ig_lib
  */
 bool ig_lib_parameter  (struct ig_lib_db *db, const char *parname, const char *defvalue, GList *targets, struct ig_generic **gen_generic);
 
+/**
+ * @brief Compute content fingerprint of an object for output generation.
+ * @param obj Object to compute fingerprint of.
+ * @param data Additional data to include (e.g. template content) or @c NULL.
+ * @return Newly allocated hex string of the fingerprint, must be freed by caller with @c g_free.
+ *
+ * The fingerprint covers the attributes of the object and of all objects output generated
+ * for it can depend on: children (for modules including child instances and the interface
+ * of the instanciated modules), nets/generics connected to the children and the Object-IDs
+ * of all objects on these nets/generics.
+ */
+char *ig_lib_obj_fingerprint (struct ig_object *obj, const char *data);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,790 @@
+/*
+ *  ICGlue is a Tcl-Library for scripted HDL generation
+ *  Copyright (C) 2017-2019  Andreas Dixius, Felix Neumärker
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "ig_snapshot.h"
+#include "logger.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+/*
+ * file layout (host byte order, sections aligned to IG_SNAPSHOT_ALIGN):
+ *   header
+ *   object records    (struct ig_snapshot_obj [obj_count], record index == object handle)
+ *   attribute records (struct ig_snapshot_attr [attr_count])
+ *   reference table   (guint32 [ref_count], object arrays as length followed by record indices)
+ *   string table      (NUL-terminated strings, referenced by offset)
+ *
+ * Records 1 ... db_obj_count-1 are the objects of the database in handle order,
+ * records behind are objects not registered in the database (default instances
+ * of modules not instantiated yet).
+ */
+#define IG_SNAPSHOT_MAGIC      "ICGLSNAP"
+#define IG_SNAPSHOT_VERSION    1
+#define IG_SNAPSHOT_BYTE_ORDER 0x01020304
+#define IG_SNAPSHOT_ALIGN      8
+#define IG_SNAPSHOT_NONE       G_MAXUINT32
+
+#define IG_SNAPSHOT_FLAG_ILM      (1 << 0)
+#define IG_SNAPSHOT_FLAG_RESOURCE (1 << 1)
+
+struct ig_snapshot_header {
+    char    magic[8];
+    guint32 version;
+    guint32 byte_order;
+    guint32 slot_count;
+    guint32 obj_count;
+    guint32 db_obj_count;
+    guint32 attr_count;
+    guint32 ref_count;
+    guint32 str_size;
+    guint64 obj_offset;
+    guint64 attr_offset;
+    guint64 ref_offset;
+    guint64 str_offset;
+};
+
+struct ig_snapshot_obj {
+    guint32 type;
+    guint32 name;
+    guint32 id_parent;
+    guint32 id_depth;
+    guint32 slots[IG_ATTR_SLOT_COUNT];
+    guint32 slots_constant;
+    guint32 attr_first;
+    guint32 attr_count;
+    guint32 parent;   /* parent object of inheriting struct */
+    guint32 ref;      /* module: default instance, instance: module, port/pin/decl: net, param/adjustment: generic */
+    guint32 value;    /* pin: connection, param/adjustment: value, decl: default assignment, codesection: code */
+    guint32 flags;    /* module: ilm/resource, port: direction, param: local, decl: default type */
+    guint32 arrays;   /* first reference table entry of object arrays */
+};
+
+struct ig_snapshot_attr {
+    guint32 name;
+    guint32 value;
+    guint32 constant;
+};
+
+struct ig_snapshot_writer {
+    GHashTable *obj_index; /* objects without handle -> record index */
+    GHashTable *str_index; /* string -> offset in string table */
+    GString    *strings;
+    GArray     *objs;
+    GArray     *attrs;
+    GArray     *refs;
+};
+
+/* number of object arrays stored for object type */
+static guint ig_snapshot_array_count (enum ig_object_type type)
+{
+    switch (type) {
+        case IG_OBJ_MODULE:        return 7;
+        case IG_OBJ_INSTANCE:      return 2;
+        case IG_OBJ_REGFILE:       return 1;
+        case IG_OBJ_REGFILE_ENTRY: return 1;
+        case IG_OBJ_NET:           return 1;
+        case IG_OBJ_GENERIC:       return 1;
+        default:                   return 0;
+    }
+}
+
+/* object arrays of object in storage order */
+static guint ig_snapshot_obj_arrays (struct ig_object *obj, struct ig_obj_array *arrays[])
+{
+    switch (obj->type) {
+        case IG_OBJ_MODULE: {
+            struct ig_module *mod = IG_MODULE (obj);
+            arrays[0] = &mod->params;
+            arrays[1] = &mod->ports;
+            arrays[2] = &mod->decls;
+            arrays[3] = &mod->code;
+            arrays[4] = &mod->regfiles;
+            arrays[5] = &mod->child_instances;
+            arrays[6] = &mod->mod_instances;
+            break;
+        }
+        case IG_OBJ_INSTANCE:
+            arrays[0] = &IG_INSTANCE (obj)->adjustments;
+            arrays[1] = &IG_INSTANCE (obj)->pins;
+            break;
+        case IG_OBJ_REGFILE:       arrays[0] = &IG_RF_REGFILE (obj)->entries; break;
+        case IG_OBJ_REGFILE_ENTRY: arrays[0] = &IG_RF_ENTRY (obj)->regs;      break;
+        case IG_OBJ_NET:           arrays[0] = &IG_NET (obj)->objects;        break;
+        case IG_OBJ_GENERIC:       arrays[0] = &IG_GENERIC (obj)->objects;    break;
+        default:
+            break;
+    }
+
+    return ig_snapshot_array_count (obj->type);
+}
+
+#define IG_SNAPSHOT_TYPE(type) (1u << (type))
+
+/* types of parent and ID-parent of object type, 0 if it has no parent */
+static guint32 ig_snapshot_parent_types (enum ig_object_type type)
+{
+    switch (type) {
+        case IG_OBJ_PORT:          return IG_SNAPSHOT_TYPE (IG_OBJ_MODULE);
+        case IG_OBJ_PARAMETER:     return IG_SNAPSHOT_TYPE (IG_OBJ_MODULE);
+        case IG_OBJ_DECLARATION:   return IG_SNAPSHOT_TYPE (IG_OBJ_MODULE);
+        case IG_OBJ_CODESECTION:   return IG_SNAPSHOT_TYPE (IG_OBJ_MODULE);
+        case IG_OBJ_REGFILE:       return IG_SNAPSHOT_TYPE (IG_OBJ_MODULE);
+        case IG_OBJ_INSTANCE:      return IG_SNAPSHOT_TYPE (IG_OBJ_MODULE);
+        case IG_OBJ_PIN:           return IG_SNAPSHOT_TYPE (IG_OBJ_INSTANCE);
+        case IG_OBJ_ADJUSTMENT:    return IG_SNAPSHOT_TYPE (IG_OBJ_INSTANCE);
+        case IG_OBJ_REGFILE_ENTRY: return IG_SNAPSHOT_TYPE (IG_OBJ_REGFILE);
+        case IG_OBJ_REGFILE_REG:   return IG_SNAPSHOT_TYPE (IG_OBJ_REGFILE_ENTRY);
+        default:                   return 0;
+    }
+}
+
+/* types of ref field of object type (see struct ig_snapshot_obj), 0 if unused */
+static guint32 ig_snapshot_ref_types (enum ig_object_type type)
+{
+    switch (type) {
+        case IG_OBJ_MODULE:      return IG_SNAPSHOT_TYPE (IG_OBJ_INSTANCE);
+        case IG_OBJ_INSTANCE:    return IG_SNAPSHOT_TYPE (IG_OBJ_MODULE);
+        case IG_OBJ_PORT:        return IG_SNAPSHOT_TYPE (IG_OBJ_NET);
+        case IG_OBJ_PIN:         return IG_SNAPSHOT_TYPE (IG_OBJ_NET);
+        case IG_OBJ_DECLARATION: return IG_SNAPSHOT_TYPE (IG_OBJ_NET);
+        case IG_OBJ_PARAMETER:   return IG_SNAPSHOT_TYPE (IG_OBJ_GENERIC);
+        case IG_OBJ_ADJUSTMENT:  return IG_SNAPSHOT_TYPE (IG_OBJ_GENERIC);
+        default:                 return 0;
+    }
+}
+
+/* element types of object array of object type in storage order (see ig_snapshot_obj_arrays) */
+static guint32 ig_snapshot_array_types (enum ig_object_type type, guint array)
+{
+    static const guint32 module_arrays[7] = {
+        IG_SNAPSHOT_TYPE (IG_OBJ_PARAMETER), IG_SNAPSHOT_TYPE (IG_OBJ_PORT), IG_SNAPSHOT_TYPE (IG_OBJ_DECLARATION),
+        IG_SNAPSHOT_TYPE (IG_OBJ_CODESECTION), IG_SNAPSHOT_TYPE (IG_OBJ_REGFILE),
+        IG_SNAPSHOT_TYPE (IG_OBJ_INSTANCE), IG_SNAPSHOT_TYPE (IG_OBJ_INSTANCE)
+    };
+
+    switch (type) {
+        case IG_OBJ_MODULE:        return module_arrays[array];
+        case IG_OBJ_INSTANCE:      return (array == 0 ? IG_SNAPSHOT_TYPE (IG_OBJ_ADJUSTMENT) : IG_SNAPSHOT_TYPE (IG_OBJ_PIN));
+        case IG_OBJ_REGFILE:       return IG_SNAPSHOT_TYPE (IG_OBJ_REGFILE_ENTRY);
+        case IG_OBJ_REGFILE_ENTRY: return IG_SNAPSHOT_TYPE (IG_OBJ_REGFILE_REG);
+        case IG_OBJ_NET:           return IG_SNAPSHOT_TYPE (IG_OBJ_PORT) | IG_SNAPSHOT_TYPE (IG_OBJ_PIN) | IG_SNAPSHOT_TYPE (IG_OBJ_DECLARATION);
+        case IG_OBJ_GENERIC:       return IG_SNAPSHOT_TYPE (IG_OBJ_PARAMETER) | IG_SNAPSHOT_TYPE (IG_OBJ_ADJUSTMENT);
+        default:                   return 0;
+    }
+}
+
+static gsize ig_snapshot_obj_size (enum ig_object_type type)
+{
+    switch (type) {
+        case IG_OBJ_PORT:          return sizeof (struct ig_port);
+        case IG_OBJ_PIN:           return sizeof (struct ig_pin);
+        case IG_OBJ_PARAMETER:     return sizeof (struct ig_param);
+        case IG_OBJ_ADJUSTMENT:    return sizeof (struct ig_adjustment);
+        case IG_OBJ_DECLARATION:   return sizeof (struct ig_decl);
+        case IG_OBJ_CODESECTION:   return sizeof (struct ig_code);
+        case IG_OBJ_MODULE:        return sizeof (struct ig_module);
+        case IG_OBJ_INSTANCE:      return sizeof (struct ig_instance);
+        case IG_OBJ_REGFILE_REG:   return sizeof (struct ig_rf_reg);
+        case IG_OBJ_REGFILE_ENTRY: return sizeof (struct ig_rf_entry);
+        case IG_OBJ_REGFILE:       return sizeof (struct ig_rf_regfile);
+        case IG_OBJ_NET:           return sizeof (struct ig_net);
+        case IG_OBJ_GENERIC:       return sizeof (struct ig_generic);
+    }
+
+    return 0;
+}
+
+/*******************************************************
+ * save
+ *******************************************************/
+
+static inline guint64 ig_snapshot_align (guint64 offset)
+{
+    return (offset + IG_SNAPSHOT_ALIGN - 1) & ~((guint64)IG_SNAPSHOT_ALIGN - 1);
+}
+
+static guint32 ig_snapshot_str (struct ig_snapshot_writer *w, const char *str)
+{
+    if (str == NULL) return IG_SNAPSHOT_NONE;
+
+    gpointer offset = NULL;
+    if (g_hash_table_lookup_extended (w->str_index, str, NULL, &offset)) {
+        return GPOINTER_TO_UINT (offset);
+    }
+
+    guint32 result = w->strings->len;
+    g_string_append_len (w->strings, str, strlen (str) + 1);
+    g_hash_table_insert (w->str_index, (gpointer)str, GUINT_TO_POINTER (result));
+
+    return result;
+}
+
+static guint32 ig_snapshot_index (struct ig_snapshot_writer *w, gconstpointer data)
+{
+    const struct ig_object *obj = (const struct ig_object *)data;
+
+    if (obj == NULL) return IG_SNAPSHOT_NONE;
+    if (obj->handle != 0) return obj->handle;
+
+    gpointer index = NULL;
+    if (g_hash_table_lookup_extended (w->obj_index, obj, NULL, &index)) {
+        return GPOINTER_TO_UINT (index);
+    }
+
+    return IG_SNAPSHOT_NONE;
+}
+
+static void ig_snapshot_save_obj (struct ig_snapshot_writer *w, struct ig_object *obj)
+{
+    struct ig_snapshot_obj rec;
+
+    rec.type      = obj->type;
+    rec.name      = ig_snapshot_str (w, obj->name);
+    rec.id_parent = ig_snapshot_index (w, obj->id_parent);
+    rec.id_depth  = obj->id_depth;
+    rec.parent    = IG_SNAPSHOT_NONE;
+    rec.ref       = IG_SNAPSHOT_NONE;
+    rec.value     = IG_SNAPSHOT_NONE;
+    rec.flags     = 0;
+
+    /* Object-ID is materialized again on request */
+    for (int i = 0; i < IG_ATTR_SLOT_COUNT; i++) {
+        rec.slots[i] = (i == IG_ATTR_SLOT_ID ? IG_SNAPSHOT_NONE : ig_snapshot_str (w, obj->attr_slots[i]));
+    }
+    rec.slots_constant = obj->attr_slots_constant;
+
+    rec.attr_first = w->attrs->len;
+    rec.attr_count = 0;
+    if (obj->attributes != NULL) {
+        GHashTableIter iter;
+        gpointer       key, value;
+
+        g_hash_table_iter_init (&iter, obj->attributes);
+        while (g_hash_table_iter_next (&iter, &key, &value)) {
+            struct ig_attribute    *attr = (struct ig_attribute *)value;
+            struct ig_snapshot_attr arec;
+
+            arec.name     = ig_snapshot_str (w, (const char *)key);
+            arec.value    = ig_snapshot_str (w, attr->value);
+            arec.constant = attr->constant;
+            g_array_append_val (w->attrs, arec);
+            rec.attr_count++;
+        }
+    }
+
+    switch (obj->type) {
+        case IG_OBJ_PORT:
+            rec.parent = ig_snapshot_index (w, IG_PORT (obj)->parent);
+            rec.ref    = ig_snapshot_index (w, IG_PORT (obj)->net);
+            rec.flags  = IG_PORT (obj)->dir;
+            break;
+        case IG_OBJ_PIN:
+            rec.parent = ig_snapshot_index (w, IG_PIN (obj)->parent);
+            rec.ref    = ig_snapshot_index (w, IG_PIN (obj)->net);
+            rec.value  = ig_snapshot_str (w, IG_PIN (obj)->connection);
+            break;
+        case IG_OBJ_PARAMETER:
+            rec.parent = ig_snapshot_index (w, IG_PARAM (obj)->parent);
+            rec.ref    = ig_snapshot_index (w, IG_PARAM (obj)->generic);
+            rec.value  = ig_snapshot_str (w, IG_PARAM (obj)->value);
+            rec.flags  = IG_PARAM (obj)->local;
+            break;
+        case IG_OBJ_ADJUSTMENT:
+            rec.parent = ig_snapshot_index (w, IG_ADJUSTMENT (obj)->parent);
+            rec.ref    = ig_snapshot_index (w, IG_ADJUSTMENT (obj)->generic);
+            rec.value  = ig_snapshot_str (w, IG_ADJUSTMENT (obj)->value);
+            break;
+        case IG_OBJ_DECLARATION:
+            rec.parent = ig_snapshot_index (w, IG_DECL (obj)->parent);
+            rec.ref    = ig_snapshot_index (w, IG_DECL (obj)->net);
+            rec.value  = ig_snapshot_str (w, IG_DECL (obj)->default_assignment);
+            rec.flags  = IG_DECL (obj)->default_type;
+            break;
+        case IG_OBJ_CODESECTION:
+            rec.parent = ig_snapshot_index (w, IG_CODE (obj)->parent);
+            rec.value  = ig_snapshot_str (w, IG_CODE (obj)->code);
+            break;
+        case IG_OBJ_MODULE:
+            rec.ref   = ig_snapshot_index (w, IG_MODULE (obj)->default_instance);
+            rec.flags = (IG_MODULE (obj)->ilm ? IG_SNAPSHOT_FLAG_ILM : 0) | (IG_MODULE (obj)->resource ? IG_SNAPSHOT_FLAG_RESOURCE : 0);
+            break;
+        case IG_OBJ_INSTANCE:
+            rec.parent = ig_snapshot_index (w, IG_INSTANCE (obj)->parent);
+            rec.ref    = ig_snapshot_index (w, IG_INSTANCE (obj)->module);
+            break;
+        case IG_OBJ_REGFILE_REG:
+            rec.parent = ig_snapshot_index (w, IG_RF_REG (obj)->parent);
+            break;
+        case IG_OBJ_REGFILE_ENTRY:
+            rec.parent = ig_snapshot_index (w, IG_RF_ENTRY (obj)->parent);
+            break;
+        case IG_OBJ_REGFILE:
+            rec.parent = ig_snapshot_index (w, IG_RF_REGFILE (obj)->parent);
+            break;
+        case IG_OBJ_NET:
+        case IG_OBJ_GENERIC:
+            break;
+    }
+
+    struct ig_obj_array *arrays[7];
+    guint                n_arrays = ig_snapshot_obj_arrays (obj, arrays);
+
+    rec.arrays = w->refs->len;
+    for (guint i = 0; i < n_arrays; i++) {
+        /* length is updated after elements: objects not stored in the snapshot are skipped */
+        guint   len_pos = w->refs->len;
+        guint32 len     = 0;
+        g_array_append_val (w->refs, len);
+        for (guint j = 0; j < ig_obj_array_len (arrays[i]); j++) {
+            guint32 index = ig_snapshot_index (w, ig_obj_array_index (arrays[i], j));
+            if (index == IG_SNAPSHOT_NONE) continue;
+            g_array_append_val (w->refs, index);
+            len++;
+        }
+        g_array_index (w->refs, guint32, len_pos) = len;
+    }
+
+    g_array_append_val (w->objs, rec);
+}
+
+static bool ig_snapshot_write_section (FILE *file, guint64 *offset, gconstpointer data, gsize size)
+{
+    static const char padding[IG_SNAPSHOT_ALIGN] = {0};
+
+    gsize pad = (IG_SNAPSHOT_ALIGN - (*offset % IG_SNAPSHOT_ALIGN)) % IG_SNAPSHOT_ALIGN;
+    if ((pad > 0) && (fwrite (padding, 1, pad, file) != pad)) return false;
+    *offset += pad;
+
+    if ((size > 0) && (fwrite (data, 1, size, file) != size)) return false;
+    *offset += size;
+
+    return true;
+}
+
+bool ig_snapshot_save (struct ig_lib_db *db, const char *filename)
+{
+    if (db == NULL) return false;
+    if (filename == NULL) return false;
+
+    struct ig_snapshot_writer w;
+
+    w.obj_index = g_hash_table_new (g_direct_hash, g_direct_equal);
+    w.str_index = g_hash_table_new (g_str_hash, g_str_equal);
+    w.strings   = g_string_new (NULL);
+    w.objs      = g_array_new (false, false, sizeof (struct ig_snapshot_obj));
+    w.attrs     = g_array_new (false, false, sizeof (struct ig_snapshot_attr));
+    w.refs      = g_array_new (false, false, sizeof (guint32));
+
+    /* default instances of modules not instantiated yet have no handle */
+    GList  *extra_objs = NULL;
+    guint32 obj_count  = db->objects_by_id->len;
+    for (guint32 i = 1; i < db->objects_by_id->len; i++) {
+        struct ig_object *obj = PTR_TO_IG_OBJECT (g_ptr_array_index (db->objects_by_id, i));
+        if (obj->type != IG_OBJ_MODULE) continue;
+
+        struct ig_instance *inst = IG_MODULE (obj)->default_instance;
+        if ((inst == NULL) || (IG_OBJECT (inst)->handle != 0)) continue;
+
+        g_hash_table_insert (w.obj_index, inst, GUINT_TO_POINTER (obj_count));
+        extra_objs = g_list_prepend (extra_objs, inst);
+        obj_count++;
+    }
+    extra_objs = g_list_reverse (extra_objs);
+
+    /* record 0: no object */
+    struct ig_snapshot_obj null_rec;
+    memset (&null_rec, 0, sizeof (null_rec));
+    g_array_append_val (w.objs, null_rec);
+
+    for (guint32 i = 1; i < db->objects_by_id->len; i++) {
+        ig_snapshot_save_obj (&w, PTR_TO_IG_OBJECT (g_ptr_array_index (db->objects_by_id, i)));
+    }
+    for (GList *li = extra_objs; li != NULL; li = li->next) {
+        ig_snapshot_save_obj (&w, PTR_TO_IG_OBJECT (li->data));
+    }
+    g_list_free (extra_objs);
+
+    /* keep string table non-empty and terminated */
+    g_string_append_c (w.strings, '\0');
+
+    struct ig_snapshot_header header;
+    memset (&header, 0, sizeof (header));
+    memcpy (header.magic, IG_SNAPSHOT_MAGIC, sizeof (header.magic));
+    header.version      = IG_SNAPSHOT_VERSION;
+    header.byte_order   = IG_SNAPSHOT_BYTE_ORDER;
+    header.slot_count   = IG_ATTR_SLOT_COUNT;
+    header.obj_count    = w.objs->len;
+    header.db_obj_count = db->objects_by_id->len;
+    header.attr_count   = w.attrs->len;
+    header.ref_count    = w.refs->len;
+    header.str_size     = w.strings->len;
+
+    gsize obj_size  = (gsize)w.objs->len  * sizeof (struct ig_snapshot_obj);
+    gsize attr_size = (gsize)w.attrs->len * sizeof (struct ig_snapshot_attr);
+    gsize ref_size  = (gsize)w.refs->len  * sizeof (guint32);
+
+    header.obj_offset  = ig_snapshot_align (sizeof (header));
+    header.attr_offset = ig_snapshot_align (header.obj_offset  + obj_size);
+    header.ref_offset  = ig_snapshot_align (header.attr_offset + attr_size);
+    header.str_offset  = ig_snapshot_align (header.ref_offset  + ref_size);
+
+    bool result = true;
+    FILE *file  = fopen (filename, "wb");
+    if (file == NULL) {
+        log_error ("SnpSv", "could not open snapshot file %s for writing: %s", filename, strerror (errno));
+        result = false;
+    } else {
+        guint64 offset = 0;
+        result = ig_snapshot_write_section (file, &offset, &header,         sizeof (header))
+                 && ig_snapshot_write_section (file, &offset, w.objs->data,  obj_size)
+                 && ig_snapshot_write_section (file, &offset, w.attrs->data, attr_size)
+                 && ig_snapshot_write_section (file, &offset, w.refs->data,  ref_size)
+                 && ig_snapshot_write_section (file, &offset, w.strings->str, w.strings->len);
+
+        if (fclose (file) != 0) result = false;
+        if (!result) {
+            log_error ("SnpSv", "could not write snapshot file %s: %s", filename, strerror (errno));
+        } else {
+            log_debug ("SnpSv", "saved %u objects to snapshot %s", header.obj_count - 1, filename);
+        }
+    }
+
+    g_array_free (w.refs,  true);
+    g_array_free (w.attrs, true);
+    g_array_free (w.objs,  true);
+    g_string_free (w.strings, true);
+    g_hash_table_destroy (w.str_index);
+    g_hash_table_destroy (w.obj_index);
+
+    return result;
+}
+
+/*******************************************************
+ * load
+ *******************************************************/
+
+struct ig_snapshot_reader {
+    const struct ig_snapshot_header *header;
+    const struct ig_snapshot_obj    *objs;
+    const struct ig_snapshot_attr   *attrs;
+    const guint32                   *refs;
+    const char                      *strings;
+};
+
+static inline const char *ig_snapshot_str_at (const struct ig_snapshot_reader *r, guint32 offset)
+{
+    if (offset == IG_SNAPSHOT_NONE) return NULL;
+    return r->strings + offset;
+}
+
+static inline bool ig_snapshot_valid_str (const struct ig_snapshot_reader *r, guint32 offset)
+{
+    return (offset == IG_SNAPSHOT_NONE) || (offset < r->header->str_size);
+}
+
+static inline bool ig_snapshot_valid_index (const struct ig_snapshot_reader *r, guint32 index)
+{
+    return (index == IG_SNAPSHOT_NONE) || ((index > 0) && (index < r->header->obj_count));
+}
+
+/* reference is unset or refers to an object of one of the given types */
+static inline bool ig_snapshot_valid_ref (const struct ig_snapshot_reader *r, guint32 index, guint32 types)
+{
+    if (index == IG_SNAPSHOT_NONE) return true;
+    if (!ig_snapshot_valid_index (r, index)) return false;
+
+    guint32 type = r->objs[index].type;
+
+    return (type <= IG_OBJ_GENERIC) && ((types & IG_SNAPSHOT_TYPE (type)) != 0);
+}
+
+static bool ig_snapshot_valid_section (gsize file_size, guint64 offset, guint64 count, gsize elem_size)
+{
+    if (offset % IG_SNAPSHOT_ALIGN != 0) return false;
+    if (offset > file_size) return false;
+
+    return (count <= (file_size - offset) / elem_size);
+}
+
+/*
+ * check all offsets, indices and types of referenced objects,
+ * so objects can be built without further checks
+ */
+static bool ig_snapshot_validate (const struct ig_snapshot_reader *r)
+{
+    const struct ig_snapshot_header *h = r->header;
+
+    if (r->strings[h->str_size - 1] != '\0') return false;
+
+    for (guint32 i = 1; i < h->obj_count; i++) {
+        const struct ig_snapshot_obj *rec = &r->objs[i];
+
+        if (rec->type > IG_OBJ_GENERIC) return false;
+
+        guint32 parent_types = ig_snapshot_parent_types ((enum ig_object_type)rec->type);
+        guint32 ref_types    = ig_snapshot_ref_types ((enum ig_object_type)rec->type);
+
+        if ((rec->name == IG_SNAPSHOT_NONE) || !ig_snapshot_valid_str (r, rec->name)) return false;
+        if (!ig_snapshot_valid_ref (r, rec->id_parent, parent_types)) return false;
+        if (!ig_snapshot_valid_ref (r, rec->parent, parent_types)) return false;
+        if (!ig_snapshot_valid_ref (r, rec->ref, ref_types)) return false;
+        if (!ig_snapshot_valid_str (r, rec->value)) return false;
+
+        /* only default instances have no parent, instances always refer to their module */
+        if ((rec->type != IG_OBJ_INSTANCE) && (parent_types != 0) && (rec->parent == IG_SNAPSHOT_NONE)) return false;
+        if ((rec->type == IG_OBJ_INSTANCE) && (rec->ref == IG_SNAPSHOT_NONE)) return false;
+        if ((rec->id_parent == IG_SNAPSHOT_NONE) != (rec->id_depth == 0)) return false;
+
+        for (int j = 0; j < IG_ATTR_SLOT_COUNT; j++) {
+            if (!ig_snapshot_valid_str (r, rec->slots[j])) return false;
+        }
+        if (rec->slots[IG_ATTR_SLOT_NAME] != rec->name) return false;
+
+        if (rec->attr_first > h->attr_count) return false;
+        if (rec->attr_count > h->attr_count - rec->attr_first) return false;
+        for (guint32 j = rec->attr_first; j < rec->attr_first + rec->attr_count; j++) {
+            if ((r->attrs[j].name == IG_SNAPSHOT_NONE) || !ig_snapshot_valid_str (r, r->attrs[j].name)) return false;
+            if ((r->attrs[j].value == IG_SNAPSHOT_NONE) || !ig_snapshot_valid_str (r, r->attrs[j].value)) return false;
+        }
+
+        guint32 ref = rec->arrays;
+        for (guint j = 0; j < ig_snapshot_array_count (rec->type); j++) {
+            guint32 elem_types = ig_snapshot_array_types ((enum ig_object_type)rec->type, j);
+
+            if (ref >= h->ref_count) return false;
+            guint32 len = r->refs[ref++];
+            if (len > h->ref_count - ref) return false;
+            for (guint32 k = 0; k < len; k++) {
+                guint32 index = r->refs[ref++];
+                if ((index == IG_SNAPSHOT_NONE) || !ig_snapshot_valid_ref (r, index, elem_types)) return false;
+            }
+        }
+    }
+
+    /* ID-parent chains are bounded by the type hierarchy, longer chains are cycles */
+    for (guint32 i = 1; i < h->obj_count; i++) {
+        guint32 index = r->objs[i].id_parent;
+        for (guint depth = 0; index != IG_SNAPSHOT_NONE; depth++) {
+            if (depth >= IG_OBJ_TYPE_COUNT) return false;
+            index = r->objs[index].id_parent;
+        }
+    }
+
+    return true;
+}
+
+static void ig_snapshot_load_array (struct ig_lib_db *db, const struct ig_snapshot_reader *r, struct ig_object **objs, guint32 *ref, struct ig_obj_array *array)
+{
+    guint32 len = r->refs[(*ref)++];
+
+    array->pdata = NULL;
+    array->len   = len;
+    array->alloc = len;
+
+    if (len == 0) return;
+
+    array->pdata = (gpointer *)ig_arena_alloc (db->arena, len * sizeof (gpointer));
+    for (guint32 i = 0; i < len; i++) {
+        array->pdata[i] = objs[r->refs[(*ref)++]];
+    }
+}
+
+/* fill struct of object from record: all objects must be allocated already */
+static void ig_snapshot_load_obj (struct ig_lib_db *db, const struct ig_snapshot_reader *r, struct ig_object **objs, guint32 index)
+{
+    const struct ig_snapshot_obj *rec = &r->objs[index];
+    struct ig_object             *obj = objs[index];
+
+#define IG_SNAPSHOT_REF(IDX) ((IDX) == IG_SNAPSHOT_NONE ? NULL : objs[(IDX)])
+
+    obj->id        = NULL;
+    /* names are interned, lookup tables compare them by pointer */
+    obj->name      = ig_str_intern (ig_snapshot_str_at (r, rec->name));
+    obj->id_parent = IG_SNAPSHOT_REF (rec->id_parent);
+    obj->id_depth  = rec->id_depth;
+    obj->refcount  = 0;
+    obj->arena     = db->arena;
+
+    obj->string_storage      = db->str_chunks;
+    obj->string_storage_free = false;
+
+    for (int i = 0; i < IG_ATTR_SLOT_COUNT; i++) {
+        obj->attr_slots[i] = ig_snapshot_str_at (r, rec->slots[i]);
+    }
+    obj->attr_slots[IG_ATTR_SLOT_NAME] = obj->name;
+    obj->attr_slots_constant = rec->slots_constant;
+    obj->attributes          = NULL;
+
+    for (guint32 i = rec->attr_first; i < rec->attr_first + rec->attr_count; i++) {
+        ig_obj_attr_set_static (obj, ig_snapshot_str_at (r, r->attrs[i].name), ig_snapshot_str_at (r, r->attrs[i].value), r->attrs[i].constant);
+    }
+
+    switch (obj->type) {
+        case IG_OBJ_PORT:
+            IG_PORT (obj)->parent = IG_MODULE (IG_SNAPSHOT_REF (rec->parent));
+            IG_PORT (obj)->net    = IG_NET (IG_SNAPSHOT_REF (rec->ref));
+            IG_PORT (obj)->dir    = (enum ig_port_dir)rec->flags;
+            break;
+        case IG_OBJ_PIN:
+            IG_PIN (obj)->parent     = IG_INSTANCE (IG_SNAPSHOT_REF (rec->parent));
+            IG_PIN (obj)->net        = IG_NET (IG_SNAPSHOT_REF (rec->ref));
+            IG_PIN (obj)->connection = ig_snapshot_str_at (r, rec->value);
+            break;
+        case IG_OBJ_PARAMETER:
+            IG_PARAM (obj)->parent  = IG_MODULE (IG_SNAPSHOT_REF (rec->parent));
+            IG_PARAM (obj)->generic = IG_GENERIC (IG_SNAPSHOT_REF (rec->ref));
+            IG_PARAM (obj)->value   = ig_snapshot_str_at (r, rec->value);
+            IG_PARAM (obj)->local   = rec->flags;
+            break;
+        case IG_OBJ_ADJUSTMENT:
+            IG_ADJUSTMENT (obj)->parent  = IG_INSTANCE (IG_SNAPSHOT_REF (rec->parent));
+            IG_ADJUSTMENT (obj)->generic = IG_GENERIC (IG_SNAPSHOT_REF (rec->ref));
+            IG_ADJUSTMENT (obj)->value   = ig_snapshot_str_at (r, rec->value);
+            break;
+        case IG_OBJ_DECLARATION:
+            IG_DECL (obj)->parent             = IG_MODULE (IG_SNAPSHOT_REF (rec->parent));
+            IG_DECL (obj)->net                = IG_NET (IG_SNAPSHOT_REF (rec->ref));
+            IG_DECL (obj)->default_assignment = ig_snapshot_str_at (r, rec->value);
+            IG_DECL (obj)->default_type       = rec->flags;
+            break;
+        case IG_OBJ_CODESECTION:
+            IG_CODE (obj)->parent = IG_MODULE (IG_SNAPSHOT_REF (rec->parent));
+            IG_CODE (obj)->code   = ig_snapshot_str_at (r, rec->value);
+            break;
+        case IG_OBJ_MODULE:
+            IG_MODULE (obj)->default_instance = IG_INSTANCE (IG_SNAPSHOT_REF (rec->ref));
+            IG_MODULE (obj)->ilm              = (rec->flags & IG_SNAPSHOT_FLAG_ILM);
+            IG_MODULE (obj)->resource         = (rec->flags & IG_SNAPSHOT_FLAG_RESOURCE);
+            /* loaded tables are not shared, but never modified once prototypes are in use */
+            IG_MODULE (obj)->attr_protos      = (IG_MODULE (obj)->resource ? ig_attr_protos_new (db->arena) : NULL);
+            break;
+        case IG_OBJ_INSTANCE:
+            IG_INSTANCE (obj)->parent = IG_MODULE (IG_SNAPSHOT_REF (rec->parent));
+            IG_INSTANCE (obj)->module = IG_MODULE (IG_SNAPSHOT_REF (rec->ref));
+            break;
+        case IG_OBJ_REGFILE_REG:
+            IG_RF_REG (obj)->parent = IG_RF_ENTRY (IG_SNAPSHOT_REF (rec->parent));
+            break;
+        case IG_OBJ_REGFILE_ENTRY:
+            IG_RF_ENTRY (obj)->parent = IG_RF_REGFILE (IG_SNAPSHOT_REF (rec->parent));
+            break;
+        case IG_OBJ_REGFILE:
+            IG_RF_REGFILE (obj)->parent = IG_MODULE (IG_SNAPSHOT_REF (rec->parent));
+            break;
+        case IG_OBJ_NET:
+        case IG_OBJ_GENERIC:
+            break;
+    }
+
+#undef IG_SNAPSHOT_REF
+
+    struct ig_obj_array *arrays[7];
+    guint                n_arrays = ig_snapshot_obj_arrays (obj, arrays);
+    guint32              ref      = rec->arrays;
+
+    for (guint i = 0; i < n_arrays; i++) {
+        ig_snapshot_load_array (db, r, objs, &ref, arrays[i]);
+    }
+}
+
+bool ig_snapshot_load (struct ig_lib_db *db, const char *filename)
+{
+    if (db == NULL) return false;
+    if (filename == NULL) return false;
+
+    GError      *error = NULL;
+    GMappedFile *file  = g_mapped_file_new (filename, false, &error);
+    if (file == NULL) {
+        log_error ("SnpLd", "could not open snapshot file %s: %s", filename, error->message);
+        g_error_free (error);
+        return false;
+    }
+
+    const char *data = g_mapped_file_get_contents (file);
+    gsize       size = g_mapped_file_get_length (file);
+
+    struct ig_snapshot_reader r;
+    r.header = (const struct ig_snapshot_header *)data;
+
+    if ((size < sizeof (struct ig_snapshot_header)) || (memcmp (r.header->magic, IG_SNAPSHOT_MAGIC, sizeof (r.header->magic)) != 0)) {
+        log_error ("SnpLd", "%s is no icglue snapshot file", filename);
+        g_mapped_file_unref (file);
+        return false;
+    }
+    if ((r.header->version != IG_SNAPSHOT_VERSION) || (r.header->byte_order != IG_SNAPSHOT_BYTE_ORDER)
+        || (r.header->slot_count != IG_ATTR_SLOT_COUNT)) {
+        log_error ("SnpLd", "snapshot file %s was written by an incompatible icglue version or machine", filename);
+        g_mapped_file_unref (file);
+        return false;
+    }
+
+    const struct ig_snapshot_header *h = r.header;
+    if ((h->obj_count == 0) || (h->db_obj_count == 0) || (h->db_obj_count > h->obj_count) || (h->str_size == 0)
+        || !ig_snapshot_valid_section (size, h->obj_offset,  h->obj_count,  sizeof (struct ig_snapshot_obj))
+        || !ig_snapshot_valid_section (size, h->attr_offset, h->attr_count, sizeof (struct ig_snapshot_attr))
+        || !ig_snapshot_valid_section (size, h->ref_offset,  h->ref_count,  sizeof (guint32))
+        || !ig_snapshot_valid_section (size, h->str_offset,  h->str_size,   1)) {
+        log_error ("SnpLd", "snapshot file %s is truncated or corrupt", filename);
+        g_mapped_file_unref (file);
+        return false;
+    }
+
+    r.objs    = (const struct ig_snapshot_obj *)(data + h->obj_offset);
+    r.attrs   = (const struct ig_snapshot_attr *)(data + h->attr_offset);
+    r.refs    = (const guint32 *)(data + h->ref_offset);
+    r.strings = data + h->str_offset;
+
+    if (!ig_snapshot_validate (&r)) {
+        log_error ("SnpLd", "snapshot file %s is corrupt", filename);
+        g_mapped_file_unref (file);
+        return false;
+    }
+
+    ig_lib_db_clear (db);
+
+    /* strings are used directly from the mapped file */
+    ig_arena_add_cleanup (db->arena, (GDestroyNotify)g_mapped_file_unref, file);
+
+    struct ig_object **objs = g_new0 (struct ig_object *, h->obj_count);
+    for (guint32 i = 1; i < h->obj_count; i++) {
+        objs[i] = (struct ig_object *)ig_arena_alloc (db->arena, ig_snapshot_obj_size ((enum ig_object_type)r.objs[i].type));
+        /* types of references are checked by validation */
+        objs[i]->type = (enum ig_object_type)r.objs[i].type;
+    }
+    for (guint32 i = 1; i < h->obj_count; i++) {
+        ig_snapshot_load_obj (db, &r, objs, i);
+    }
+
+    /* lookup by (type, ID-parent, name) needs final handles of ID-parents */
+    for (guint32 i = 1; i < h->db_obj_count; i++) {
+        objs[i]->handle = i;
+    }
+    for (guint32 i = 1; i < h->db_obj_count; i++) {
+        ig_lib_db_restore_object (db, objs[i]);
+    }
+
+    g_free (objs);
+
+    log_debug ("SnpLd", "loaded %u objects from snapshot %s", h->obj_count - 1, filename);
+
+    return true;
+}
+
@@ -0,0 +1,69 @@
+/*
+ *  ICGlue is a Tcl-Library for scripted HDL generation
+ *  Copyright (C) 2017-2019  Andreas Dixius, Felix Neumärker
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file
+ * @brief Binary database snapshots.
+ *
+ * A snapshot contains all objects of a database with their attributes as fixed-size records.
+ * References between objects are stored as object handles and strings as offsets into a
+ * string table, so the file is independent of its load address.
+ * Snapshots are loaded via mmap: strings are used directly from the mapped file,
+ * only the object structs and lookup tables are rebuilt.
+ * Attribute values are stored as strings: integer and boolean attributes are typed again
+ * on load, list attributes keep only their string representation.
+ */
+#ifndef __IG_SNAPSHOT_H__
+#define __IG_SNAPSHOT_H__
+
+#include "ig_lib.h"
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Save database content to a snapshot file.
+ * @param db Database to save.
+ * @param filename Name of snapshot file to write.
+ * @return @c true on success, @c false in case of an error.
+ */
+bool ig_snapshot_save (struct ig_lib_db *db, const char *filename);
+
+/**
+ * @brief Replace database content by content of a snapshot file.
+ * @param db Database to load into.
+ * @param filename Name of snapshot file to read.
+ * @return @c true on success, @c false in case of an error.
+ *
+ * The snapshot is validated before the database is modified, so on error the
+ * database keeps its previous content.
+ * On success all previous objects are released like with @ref ig_lib_db_clear
+ * and the file stays mapped until the database is cleared or freed.
+ */
+bool ig_snapshot_load (struct ig_lib_db *db, const char *filename);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
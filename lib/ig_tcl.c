@@ -19,6 +19,8 @@
 
 #include "ig_data.h"
 #include "ig_lib.h"
+#include "ig_eval.h"
+#include "ig_snapshot.h"
 #include "ig_tcl.h"
 #include "logger.h"
 #include "ig_logo.h"
@@ -46,10 +48,108 @@
 
 /* Tcl helper function for parsing lists in GLists of char * */
 static int ig_tclc_tcl_string_list_parse (ClientData client_data, Tcl_Obj *obj, void *dest_ptr);
+/* attribute value as Tcl object with internal representation of its type */
+static Tcl_Obj *ig_tclc_attr_value_obj (const struct ig_attribute *attr)
+{
+    switch (attr->type) {
+        case IG_ATTR_TYPE_INT:
+            /* string representation of integer attributes is canonical */
+            return Tcl_NewWideIntObj (attr->typed.int_value);
+        case IG_ATTR_TYPE_BOOL: {
+            /* keep "true"/"false" as string representation */
+            Tcl_Obj *result = Tcl_NewStringObj (attr->value, -1);
+            int      bool_value;
+            Tcl_GetBooleanFromObj (NULL, result, &bool_value);
+            return result;
+        }
+        case IG_ATTR_TYPE_LIST: {
+            Tcl_Obj *result = Tcl_NewListObj (0, NULL);
+            for (guint i = 0; i < attr->typed.list.len; i++) {
+                Tcl_ListObjAppendElement (NULL, result, Tcl_NewStringObj (attr->typed.list.items[i], -1));
+            }
+            return result;
+        }
+        case IG_ATTR_TYPE_STRING:
+            break;
+    }
+
+    return Tcl_NewStringObj (attr->value, -1);
+}
+
+/* set attribute from Tcl object: pure lists are stored with their elements */
+static bool ig_tclc_attr_set_obj (struct ig_object *obj, const char *name, Tcl_Obj *value_obj)
+{
+    static const Tcl_ObjType *list_type = NULL;
+    if (list_type == NULL) {
+        list_type = Tcl_GetObjType ("list");
+    }
+
+    int       len   = 0;
+    Tcl_Obj **elems = NULL;
+    if ((value_obj->typePtr == list_type) && (value_obj->bytes == NULL)
+        && (Tcl_ListObjGetElements (NULL, value_obj, &len, &elems) == TCL_OK)) {
+        const char **items = g_new (const char *, len);
+        for (int i = 0; i < len; i++) {
+            items[i] = Tcl_GetString (elems[i]);
+        }
+        /* string representation of pure lists is canonical */
+        bool result = ig_obj_attr_set_list (obj, name, Tcl_GetString (value_obj), items, len, false);
+        g_free (items);
+        return result;
+    }
+
+    return ig_obj_attr_set (obj, name, Tcl_GetString (value_obj), false);
+}
+
+/* Tcl helper function for keeping arguments as Tcl_Obj * */
+static int ig_tclc_tcl_obj_parse (ClientData client_data, Tcl_Obj *obj, void *dest_ptr);
+
+/* Tcl object type caching the database object of an Object-ID */
+static void ig_tclc_obj_type_dup (Tcl_Obj *src, Tcl_Obj *dup);
+static void ig_tclc_obj_type_update_string (Tcl_Obj *obj);
+
+static Tcl_ObjType ig_tclc_obj_type = {
+    "ig_object",
+    NULL,
+    ig_tclc_obj_type_dup,
+    ig_tclc_obj_type_update_string,
+    NULL
+};
+
+static struct ig_object *ig_tclc_get_object (struct ig_lib_db *db, Tcl_Obj *id_obj);
+static Tcl_Obj          *ig_tclc_new_object (struct ig_lib_db *db, struct ig_object *obj);
+
+/* per-interpreter data, released when the interpreter is deleted */
+struct ig_tclc_obj_cache;
+static void                      ig_tclc_interp_init (Tcl_Interp *interp);
+static struct ig_tclc_obj_cache *ig_tclc_interp_cache (Tcl_Interp *interp);
+static GHashTable               *ig_tclc_interp_key_objs (Tcl_Interp *interp);
+
+/* shared Object-IDs and child lists of the current database generation */
+static Tcl_Obj          *ig_tclc_shared_object (struct ig_tclc_obj_cache *cache, struct ig_lib_db *db, struct ig_object *obj);
+static Tcl_Obj          *ig_tclc_child_list (struct ig_tclc_obj_cache *cache, struct ig_lib_db *db, struct ig_object *parent, struct ig_obj_array *children);
 
 static void ig_tclc_connection_parse (const char *input, GString *id, GString *net, bool *adapt, bool *inv);
 static void ig_tclc_check_name_and_warn (const char *name);
 
+/* attributes of nets created by ig::db::connect, set on creation or on commit in deferred mode */
+struct ig_tclc_connect_attrs {
+    char      *name;      /* (first) signal name for error messages */
+    bool       bundle;    /* signals created by -signal-names */
+    char      *size;      /* size of all signals */
+    GPtrArray *sizes;     /* size of each signal or NULL */
+    Tcl_Obj   *attrs;     /* attribute list for nets and all their objects or NULL */
+    Tcl_Obj   *net_attrs; /* attribute list for nets only or NULL */
+};
+
+static struct ig_tclc_connect_attrs *ig_tclc_connect_attrs_new (const char *name, bool bundle, const char *size, GList *size_list, Tcl_Obj *attrs, Tcl_Obj *net_attrs);
+static void ig_tclc_connect_attrs_free  (struct ig_tclc_connect_attrs *cattrs);
+static void ig_tclc_connect_attrs_apply (struct ig_tclc_connect_attrs *cattrs, GList *nets, GString *error_msg);
+static void ig_tclc_connect_commit_nets (struct ig_lib_db *db, GList *nets, gpointer data, gpointer commit_data);
+static void ig_tclc_connect_commit      (struct ig_lib_db *db, guint n_threads);
+static struct ig_object *ig_tclc_get_object_commit (struct ig_lib_db *db, Tcl_Obj *id_obj);
+static struct ig_object *ig_tclc_db_get_object_of_type (struct ig_lib_db *db, Tcl_Obj *id_obj, enum ig_object_type type);
+
 /* tcl proc declarations */
 static int ig_tclc_create_module      (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_create_instance    (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
@@ -57,12 +157,25 @@ static int ig_tclc_add_codesection    (ClientData clientdata, Tcl_Interp *interp
 static int ig_tclc_add_regfile        (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_set_attribute      (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_get_attribute      (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_get_attributes     (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_object_data        (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_get_objs_of_obj    (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_attr               (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_children           (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_get_netgen_objects (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_get_signal         (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_eval_parameter     (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_connect            (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_parameter          (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_create_pin         (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_reset              (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_save               (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_load               (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_fingerprint        (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_stats              (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_fork               (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_switch             (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_deferred           (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_logger             (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_log                (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_log_stat           (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
@@ -74,12 +187,27 @@ static int tcl_verror_msg (Tcl_Interp *interp, const char *format, va_list args)
 static int tcl_dict_get_str (Tcl_Interp *interp, Tcl_Obj *tcl_dict, char *key, char **value);
 static int tcl_dict_get_int (Tcl_Interp *interp, Tcl_Obj *tcl_dict, char *key, int *value);
 
+/* databases of an interpreter created by ig::db::fork */
+struct ig_tclc_forks {
+    struct ig_lib_db *db;       /* database all commands work on, content exchanged on switch */
+    char             *active;   /* name of current content of db */
+    GHashTable       *inactive; /* name -> (struct ig_lib_db *) of inactive databases */
+};
+
 void ig_add_tcl_commands (Tcl_Interp *interp)
 {
     if (interp == NULL) return;
 
     struct ig_lib_db *lib_db = ig_lib_db_new ();
 
+    struct ig_tclc_forks *forks = g_slice_new (struct ig_tclc_forks);
+    forks->db       = lib_db;
+    forks->active   = g_strdup ("default");
+    forks->inactive = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify)ig_lib_db_free);
+
+    Tcl_RegisterObjType (&ig_tclc_obj_type);
+    ig_tclc_interp_init (interp);
+
     Tcl_Namespace *db_ns = Tcl_CreateNamespace (interp, ICGLUE_LIB_NAMESPACE, NULL, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "create_module",       ig_tclc_create_module,      lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "create_instance",     ig_tclc_create_instance,    lib_db, NULL);
@@ -87,6 +215,10 @@ void ig_add_tcl_commands (Tcl_Interp *interp)
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "add_regfile",         ig_tclc_add_regfile,        lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "set_attribute",       ig_tclc_set_attribute,      lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_attribute",       ig_tclc_get_attribute,      lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_attributes",      ig_tclc_get_attributes,     lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "module_data",         ig_tclc_object_data,        lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "instance_data",       ig_tclc_object_data,        lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "regfile_data",        ig_tclc_object_data,        lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_modules",         ig_tclc_get_objs_of_obj,    lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_instances",       ig_tclc_get_objs_of_obj,    lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_ports",           ig_tclc_get_objs_of_obj,    lib_db, NULL);
@@ -100,12 +232,23 @@ void ig_add_tcl_commands (Tcl_Interp *interp)
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_regfile_regs",    ig_tclc_get_objs_of_obj,    lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_nets",            ig_tclc_get_objs_of_obj,    lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_generics",        ig_tclc_get_objs_of_obj,    lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "attr",                ig_tclc_attr,               lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "children",            ig_tclc_children,           lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_net_objects",     ig_tclc_get_netgen_objects, lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_generic_objects", ig_tclc_get_netgen_objects, lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_signal",          ig_tclc_get_signal,         lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "eval_parameter",      ig_tclc_eval_parameter,     lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "connect",             ig_tclc_connect,            lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "parameter",           ig_tclc_parameter,          lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "create_pin",          ig_tclc_create_pin,         lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "reset",               ig_tclc_reset,              lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "save",                ig_tclc_save,               lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "load",                ig_tclc_load,               lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "fingerprint",         ig_tclc_fingerprint,        lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "stats",               ig_tclc_stats,              lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "fork",                ig_tclc_fork,               forks,  NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "switch",              ig_tclc_switch,             forks,  NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "deferred",            ig_tclc_deferred,           lib_db, NULL);
     Tcl_Export (interp, db_ns, "*", true);
 
     Tcl_Namespace *log_ns = Tcl_CreateNamespace (interp, ICGLUE_LOG_NAMESPACE, NULL, NULL);
@@ -116,6 +259,234 @@ void ig_add_tcl_commands (Tcl_Interp *interp)
     Tcl_Export (interp, log_ns, "*", true);
 }
 
+/*
+ * Object-IDs returned to Tcl carry the database object as internal representation,
+ * valid as long as the database generation they were created in is current.
+ */
+static inline void ig_tclc_obj_set_intrep (struct ig_lib_db *db, Tcl_Obj *id_obj, struct ig_object *obj)
+{
+    if ((id_obj->typePtr != NULL) && (id_obj->typePtr->freeIntRepProc != NULL)) {
+        id_obj->typePtr->freeIntRepProc (id_obj);
+    }
+
+    id_obj->internalRep.twoPtrValue.ptr1 = obj;
+    id_obj->internalRep.twoPtrValue.ptr2 = GUINT_TO_POINTER (db->generation);
+    id_obj->typePtr                      = &ig_tclc_obj_type;
+}
+
+static void ig_tclc_obj_type_dup (Tcl_Obj *src, Tcl_Obj *dup)
+{
+    dup->internalRep.twoPtrValue.ptr1 = src->internalRep.twoPtrValue.ptr1;
+    dup->internalRep.twoPtrValue.ptr2 = src->internalRep.twoPtrValue.ptr2;
+    dup->typePtr                      = &ig_tclc_obj_type;
+}
+
+static void ig_tclc_obj_type_update_string (Tcl_Obj *obj)
+{
+    const char *id  = ig_obj_id (PTR_TO_IG_OBJECT (obj->internalRep.twoPtrValue.ptr1));
+    size_t      len = strlen (id);
+
+    obj->bytes = Tcl_Alloc (len + 1);
+    memcpy (obj->bytes, id, len + 1);
+    obj->length = len;
+}
+
+static struct ig_object *ig_tclc_get_object (struct ig_lib_db *db, Tcl_Obj *id_obj)
+{
+    if (id_obj == NULL) return NULL;
+
+    if ((id_obj->typePtr == &ig_tclc_obj_type)
+        && (GPOINTER_TO_UINT (id_obj->internalRep.twoPtrValue.ptr2) == db->generation)) {
+        return PTR_TO_IG_OBJECT (id_obj->internalRep.twoPtrValue.ptr1);
+    }
+
+    struct ig_object *obj = ig_lib_db_get_object (db, Tcl_GetString (id_obj));
+    if (obj != NULL) {
+        ig_tclc_obj_set_intrep (db, id_obj, obj);
+    }
+
+    return obj;
+}
+
+static Tcl_Obj *ig_tclc_new_object (struct ig_lib_db *db, struct ig_object *obj)
+{
+    Tcl_Obj *result = Tcl_NewStringObj (ig_obj_id (obj), -1);
+
+    ig_tclc_obj_set_intrep (db, result, obj);
+
+    return result;
+}
+
+/*
+ * Results of child queries are shared Tcl objects: one Object-ID per database object (by handle)
+ * and one list per child array (by array address), which is rebuilt when the epoch of its parent changed.
+ * Objects are not removed from a database, so the cache only needs to be dropped when the generation changes.
+ * Tcl objects must not be shared across interpreters, so each interpreter has its own cache.
+ */
+struct ig_tclc_child_list {
+    guint32  epoch; /* epoch of parent object when list was created */
+    Tcl_Obj *list;  /* list of shared Object-IDs */
+};
+
+struct ig_tclc_obj_cache {
+    guint       generation; /* database generation of cached objects */
+    GPtrArray  *ids;        /* handle -> (Tcl_Obj *) Object-ID or NULL */
+    GHashTable *lists;      /* (struct ig_obj_array *) -> (struct ig_tclc_child_list *) */
+};
+
+static void ig_tclc_cache_obj_free (gpointer data)
+{
+    Tcl_Obj *obj = (Tcl_Obj *)data;
+
+    if (obj != NULL) Tcl_DecrRefCount (obj);
+}
+
+static void ig_tclc_child_list_free (gpointer data)
+{
+    struct ig_tclc_child_list *child_list = (struct ig_tclc_child_list *)data;
+
+    Tcl_DecrRefCount (child_list->list);
+    g_slice_free (struct ig_tclc_child_list, child_list);
+}
+
+/* data of an interpreter stored via Tcl_SetAssocData */
+struct ig_tclc_interp {
+    struct ig_tclc_obj_cache cache;    /* shared Object-IDs and child lists */
+    GHashTable              *key_objs; /* key string -> shared (Tcl_Obj *) key of object data lists */
+};
+
+#define IG_TCLC_INTERP_KEY "ICGlue"
+
+static void ig_tclc_interp_free (ClientData clientdata, Tcl_Interp *interp)
+{
+    struct ig_tclc_interp *idata = (struct ig_tclc_interp *)clientdata;
+
+    if (idata->cache.ids != NULL)   g_ptr_array_free (idata->cache.ids, true);
+    if (idata->cache.lists != NULL) g_hash_table_destroy (idata->cache.lists);
+    g_hash_table_destroy (idata->key_objs);
+
+    g_slice_free (struct ig_tclc_interp, idata);
+}
+
+static void ig_tclc_interp_init (Tcl_Interp *interp)
+{
+    struct ig_tclc_interp *idata = g_slice_new0 (struct ig_tclc_interp);
+    idata->key_objs = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, ig_tclc_cache_obj_free);
+
+    Tcl_SetAssocData (interp, IG_TCLC_INTERP_KEY, ig_tclc_interp_free, idata);
+}
+
+static struct ig_tclc_obj_cache *ig_tclc_interp_cache (Tcl_Interp *interp)
+{
+    struct ig_tclc_interp *idata = (struct ig_tclc_interp *)Tcl_GetAssocData (interp, IG_TCLC_INTERP_KEY, NULL);
+
+    return &idata->cache;
+}
+
+static GHashTable *ig_tclc_interp_key_objs (Tcl_Interp *interp)
+{
+    struct ig_tclc_interp *idata = (struct ig_tclc_interp *)Tcl_GetAssocData (interp, IG_TCLC_INTERP_KEY, NULL);
+
+    return idata->key_objs;
+}
+
+static void ig_tclc_cache_sync (struct ig_tclc_obj_cache *cache, struct ig_lib_db *db)
+{
+    if (cache->ids == NULL) {
+        cache->ids   = g_ptr_array_new_with_free_func (ig_tclc_cache_obj_free);
+        cache->lists = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL, ig_tclc_child_list_free);
+    } else if (cache->generation == db->generation) {
+        return;
+    }
+
+    g_ptr_array_set_size (cache->ids, 0);
+    g_hash_table_remove_all (cache->lists);
+    cache->generation = db->generation;
+}
+
+static Tcl_Obj *ig_tclc_shared_object (struct ig_tclc_obj_cache *cache, struct ig_lib_db *db, struct ig_object *obj)
+{
+    guint32 handle = obj->handle;
+    if (handle == 0) return ig_tclc_new_object (db, obj);
+
+    ig_tclc_cache_sync (cache, db);
+
+    GPtrArray *ids = cache->ids;
+    if (handle >= ids->len) {
+        g_ptr_array_set_size (ids, MAX (db->objects_by_id->len, handle + 1));
+    }
+
+    Tcl_Obj *result = (Tcl_Obj *)g_ptr_array_index (ids, handle);
+    if (result == NULL) {
+        result = ig_tclc_new_object (db, obj);
+        Tcl_IncrRefCount (result);
+        g_ptr_array_index (ids, handle) = result;
+    }
+
+    return result;
+}
+
+static Tcl_Obj *ig_tclc_child_list (struct ig_tclc_obj_cache *cache, struct ig_lib_db *db, struct ig_object *parent, struct ig_obj_array *children)
+{
+    ig_tclc_cache_sync (cache, db);
+
+    struct ig_tclc_child_list *child_list = (struct ig_tclc_child_list *)g_hash_table_lookup (cache->lists, children);
+    if (child_list != NULL) {
+        if (child_list->epoch == parent->epoch) return child_list->list;
+        Tcl_DecrRefCount (child_list->list);
+    } else {
+        child_list = g_slice_new (struct ig_tclc_child_list);
+        g_hash_table_insert (cache->lists, children, child_list);
+    }
+
+    guint     n_children = ig_obj_array_len (children);
+    Tcl_Obj **ids        = g_new (Tcl_Obj *, MAX (n_children, 1));
+    for (guint i = 0; i < n_children; i++) {
+        ids[i] = ig_tclc_shared_object (cache, db, PTR_TO_IG_OBJECT (ig_obj_array_index (children, i)));
+    }
+
+    child_list->epoch = parent->epoch;
+    child_list->list  = Tcl_NewListObj (n_children, ids);
+    Tcl_IncrRefCount (child_list->list);
+
+    g_free (ids);
+
+    return child_list->list;
+}
+
+/* read-only array view of an ordered database index, no data is copied */
+static struct ig_obj_array *ig_tclc_obj_array_view (struct ig_obj_array *view, GPtrArray *index)
+{
+    view->pdata = index->pdata;
+    view->len   = index->len;
+    view->alloc = index->len;
+
+    return view;
+}
+
+/* database lookup of Object-ID restricted to given object type */
+static struct ig_object *ig_tclc_db_get_object_of_type (struct ig_lib_db *db, Tcl_Obj *id_obj, enum ig_object_type type)
+{
+    struct ig_object *obj = ig_tclc_get_object (db, id_obj);
+
+    if ((obj == NULL) || (obj->type != type)) return NULL;
+
+    return obj;
+}
+
+/* Tcl helper function for keeping arguments as Tcl_Obj * */
+static int ig_tclc_tcl_obj_parse (ClientData client_data, Tcl_Obj *obj, void *dest_ptr)
+{
+    Tcl_Obj **obj_dest = (Tcl_Obj **)dest_ptr;
+
+    if (dest_ptr == NULL) {
+        return 1;
+    }
+
+    *obj_dest = obj;
+    return 1;
+}
+
 /* Tcl helper function for parsing lists in GLists */
 static int ig_tclc_tcl_string_list_parse (ClientData client_data, Tcl_Obj *obj, void *dest_ptr)
 {
@@ -209,7 +580,7 @@ static int ig_tclc_create_module (ClientData clientdata, Tcl_Interp *interp, int
         return tcl_error_msg (interp, "Unable to create module \"%s\"", name);
     }
 
-    Tcl_SetObjResult (interp, Tcl_NewStringObj (IG_OBJECT (module)->id, -1));
+    Tcl_SetObjResult (interp, ig_tclc_new_object (db, IG_OBJECT (module)));
 
     return TCL_OK;
 }
@@ -230,15 +601,16 @@ static int ig_tclc_create_instance (ClientData clientdata, Tcl_Interp *interp, i
     struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
 
     if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+    ig_tclc_connect_commit (db, 0);
 
-    char *name          = NULL;
-    char *of_module     = NULL;
-    char *parent_module = NULL;
+    char    *name          = NULL;
+    Tcl_Obj *of_module     = NULL;
+    Tcl_Obj *parent_module = NULL;
 
     Tcl_ArgvInfo arg_table [] = {
         {TCL_ARGV_STRING, "-name",          NULL, (void *)&name,          "the name of the instance to be created", NULL},
-        {TCL_ARGV_STRING, "-of-module",     NULL, (void *)&of_module,     "module of this instance", NULL},
-        {TCL_ARGV_STRING, "-parent-module", NULL, (void *)&parent_module, "parent module containing this instance", NULL},
+        {TCL_ARGV_FUNC,   "-of-module",     (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&of_module,     "module of this instance", NULL},
+        {TCL_ARGV_FUNC,   "-parent-module", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&parent_module, "parent module containing this instance", NULL},
 
         TCL_ARGV_AUTO_HELP,
         TCL_ARGV_TABLE_END
@@ -253,19 +625,19 @@ static int ig_tclc_create_instance (ClientData clientdata, Tcl_Interp *interp, i
     if (of_module == NULL) return tcl_error_msg (interp, "No module specified for instance \"%s\"", name);
     if (parent_module == NULL) return tcl_error_msg (interp, " No parent module specified for instance \"%s\"", name);
 
-    struct ig_module *of_mod = IG_MODULE (PTR_TO_IG_OBJECT (g_hash_table_lookup (db->modules_by_id, of_module)));
-    if (of_mod == NULL) of_mod = IG_MODULE (PTR_TO_IG_OBJECT (g_hash_table_lookup (db->modules_by_name, of_module)));
-    struct ig_module *pa_mod = IG_MODULE (PTR_TO_IG_OBJECT (g_hash_table_lookup (db->modules_by_id, parent_module)));
-    if (pa_mod == NULL) pa_mod = IG_MODULE (PTR_TO_IG_OBJECT (g_hash_table_lookup (db->modules_by_name, parent_module)));
+    struct ig_module *of_mod = IG_MODULE (ig_tclc_db_get_object_of_type (db, of_module, IG_OBJ_MODULE));
+    if (of_mod == NULL) of_mod = IG_MODULE (PTR_TO_IG_OBJECT (ig_lib_db_name_lookup (db->modules_by_name, Tcl_GetString (of_module))));
+    struct ig_module *pa_mod = IG_MODULE (ig_tclc_db_get_object_of_type (db, parent_module, IG_OBJ_MODULE));
+    if (pa_mod == NULL) pa_mod = IG_MODULE (PTR_TO_IG_OBJECT (ig_lib_db_name_lookup (db->modules_by_name, Tcl_GetString (parent_module))));
 
-    if (of_module == NULL) return tcl_error_msg (interp, "Unable to find module \"%s\" in database", of_module);
-    if (parent_module == NULL) return tcl_error_msg (interp, "Unable to find parent-module \"%s\" in database", parent_module);
+    if (of_module == NULL) return tcl_error_msg (interp, "Unable to find module \"%s\" in database", Tcl_GetString (of_module));
+    if (parent_module == NULL) return tcl_error_msg (interp, "Unable to find parent-module \"%s\" in database", Tcl_GetString (parent_module));
 
     struct ig_instance *inst = ig_lib_add_instance (db, name, of_mod, pa_mod);
 
     if (inst == NULL) return tcl_error_msg (interp, "Unable to create instance \"%s\"", name);
 
-    Tcl_SetObjResult (interp, Tcl_NewStringObj (IG_OBJECT (inst)->id, -1));
+    Tcl_SetObjResult (interp, ig_tclc_new_object (db, IG_OBJECT (inst)));
 
     return TCL_OK;
 }
@@ -287,14 +659,14 @@ static int ig_tclc_add_codesection (ClientData clientdata, Tcl_Interp *interp, i
 
     if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
 
-    char *name          = NULL;
-    char *code          = NULL;
-    char *parent_module = NULL;
+    char    *name          = NULL;
+    char    *code          = NULL;
+    Tcl_Obj *parent_module = NULL;
 
     Tcl_ArgvInfo arg_table [] = {
         {TCL_ARGV_STRING, "-name",          NULL, (void *)&name,          "the name of the codesection to be created", NULL},
         {TCL_ARGV_STRING, "-code",          NULL, (void *)&code,          "code to add", NULL},
-        {TCL_ARGV_STRING, "-parent-module", NULL, (void *)&parent_module, "parent module containing this codesection", NULL},
+        {TCL_ARGV_FUNC,   "-parent-module", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&parent_module, "parent module containing this codesection", NULL},
 
         TCL_ARGV_AUTO_HELP,
         TCL_ARGV_TABLE_END
@@ -306,14 +678,14 @@ static int ig_tclc_add_codesection (ClientData clientdata, Tcl_Interp *interp, i
     if (code == NULL) return tcl_error_msg (interp, "No code specified for codesection");
     if (parent_module == NULL) return tcl_error_msg (interp,  "No parent module specified for codesection");
 
-    struct ig_module *pa_mod = IG_MODULE (PTR_TO_IG_OBJECT (g_hash_table_lookup (db->modules_by_id, parent_module)));
-    if (pa_mod == NULL) pa_mod = IG_MODULE (PTR_TO_IG_OBJECT (g_hash_table_lookup (db->modules_by_name, parent_module)));
+    struct ig_module *pa_mod = IG_MODULE (ig_tclc_db_get_object_of_type (db, parent_module, IG_OBJ_MODULE));
+    if (pa_mod == NULL) pa_mod = IG_MODULE (PTR_TO_IG_OBJECT (ig_lib_db_name_lookup (db->modules_by_name, Tcl_GetString (parent_module))));
 
-    if (pa_mod == NULL) return tcl_error_msg (interp, "Unable to find parent module \"%s\" in database", parent_module);
+    if (pa_mod == NULL) return tcl_error_msg (interp, "Unable to find parent module \"%s\" in database", Tcl_GetString (parent_module));
     struct ig_code *cs = ig_lib_add_codesection (db, name, code, pa_mod);
 
     if (cs == NULL) return tcl_error_msg (interp, "Unable to create codesection for module \"%s\"", IG_OBJECT (pa_mod)->name);
-    Tcl_SetObjResult (interp, Tcl_NewStringObj (IG_OBJECT (cs)->id, -1));
+    Tcl_SetObjResult (interp, ig_tclc_new_object (db, IG_OBJECT (cs)));
 
     return TCL_OK;
 }
@@ -343,13 +715,13 @@ static int ig_tclc_add_regfile (ClientData clientdata, Tcl_Interp *interp, int o
     char *regfile_name = NULL;
     char *entry_name   = NULL;
     char *reg_name     = NULL;
-    char *to_id        = NULL;
+    Tcl_Obj *to_id     = NULL;
 
     Tcl_ArgvInfo arg_table [] = {
         {TCL_ARGV_STRING,   "-regfile", NULL, (void *)&regfile_name, "name of new regfile",          NULL},
         {TCL_ARGV_STRING,   "-entry",   NULL, (void *)&entry_name,   "name of new regfile-entry",    NULL},
         {TCL_ARGV_STRING,   "-reg",     NULL, (void *)&reg_name,     "name of new regfile-register", NULL},
-        {TCL_ARGV_STRING,   "-to",      NULL, (void *)&to_id,        "object id to add to",          NULL},
+        {TCL_ARGV_FUNC,     "-to",      (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&to_id, "object id to add to", NULL},
 
         TCL_ARGV_AUTO_HELP,
         TCL_ARGV_TABLE_END
@@ -368,31 +740,31 @@ static int ig_tclc_add_regfile (ClientData clientdata, Tcl_Interp *interp, int o
     ig_tclc_check_name_and_warn (entry_name);
     ig_tclc_check_name_and_warn (reg_name);
 
-    struct ig_object *to_obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, to_id));
+    struct ig_object *to_obj = ig_tclc_get_object (db, to_id);
     if ((to_obj == NULL)
         || ((regfile_name != NULL) && ((to_obj->type != IG_OBJ_MODULE) || (IG_MODULE (to_obj)->resource)))
         || ((entry_name != NULL) && (to_obj->type != IG_OBJ_REGFILE))
         || ((reg_name != NULL) && (to_obj->type != IG_OBJ_REGFILE_ENTRY))) {
-        return tcl_error_msg (interp, "Error: invalid -to object (%s) specified", to_id);
+        return tcl_error_msg (interp, "Error: invalid -to object (%s) specified", Tcl_GetString (to_id));
     }
 
-    const char *result_str = "";
+    struct ig_object *result_obj = NULL;
     if (regfile_name != NULL) {
         struct ig_rf_regfile *regfile = ig_lib_add_regfile (db, regfile_name, IG_MODULE (to_obj));
         if (regfile == NULL) return tcl_error_msg (interp, "Unable to create regfile \"%s\"", regfile_name);
 
-        result_str = IG_OBJECT (regfile)->id;
+        result_obj = IG_OBJECT (regfile);
     } else if (entry_name != NULL) {
         struct ig_rf_entry *entry = ig_lib_add_regfile_entry (db, entry_name, IG_RF_REGFILE (to_obj));
         if (entry == NULL) return tcl_error_msg (interp, "Unable to create entry \"%s\" in regfile \"%s\"",  entry_name, regfile_name);
-        result_str = IG_OBJECT (entry)->id;
+        result_obj = IG_OBJECT (entry);
     } else {
         struct ig_rf_reg *reg = ig_lib_add_regfile_reg (db, reg_name, IG_RF_ENTRY (to_obj));
         if (reg == NULL) return tcl_error_msg (interp, "Unable to create register \"%s\" in regfile \"%s\"",  reg_name, regfile_name);
-        result_str = IG_OBJECT (reg)->id;
+        result_obj = IG_OBJECT (reg);
     }
 
-    Tcl_SetObjResult (interp, Tcl_NewStringObj (result_str, -1));
+    Tcl_SetObjResult (interp, ig_tclc_new_object (db, result_obj));
 
     return TCL_OK;
 }
@@ -414,15 +786,15 @@ static int ig_tclc_set_attribute (ClientData clientdata, Tcl_Interp *interp, int
 
     if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
 
-    char  *obj_name   = NULL;
-    char  *attr_name  = NULL;
-    char  *attr_value = NULL;
-    GList *attr_list  = NULL;
+    Tcl_Obj *obj_arg   = NULL;
+    char    *attr_name = NULL;
+    Tcl_Obj *value_arg = NULL;
+    GList   *attr_list = NULL;
 
     Tcl_ArgvInfo arg_table [] = {
-        {TCL_ARGV_STRING,   "-object",      NULL, (void *)&obj_name,   "object id", NULL},
+        {TCL_ARGV_FUNC,     "-object",      (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&obj_arg, "object id", NULL},
         {TCL_ARGV_STRING,   "-attribute",   NULL, (void *)&attr_name,  "attribute name", NULL},
-        {TCL_ARGV_STRING,   "-value",       NULL, (void *)&attr_value, "attribute value", NULL},
+        {TCL_ARGV_FUNC,     "-value",       (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&value_arg, "attribute value", NULL},
 
         {TCL_ARGV_FUNC,     "-attributes",  (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_string_list_parse, (void *)&attr_list, "attributes as list of form <name1> <value1> <name2> <value2> ...", NULL},
 
@@ -433,32 +805,33 @@ static int ig_tclc_set_attribute (ClientData clientdata, Tcl_Interp *interp, int
     int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
     if (result != TCL_OK) return result;
 
-    if (obj_name == NULL) {
+    if (obj_arg == NULL) {
         g_list_free (attr_list);
         return tcl_error_msg (interp, "No object specified");
     }
+    const char *obj_name = Tcl_GetString (obj_arg);
     if ((attr_list == NULL) && (attr_name == NULL)) return tcl_error_msg (interp, "No attribute specified");
     if ((attr_list != NULL) && (attr_name != NULL)) {
         g_list_free (attr_list);
         return tcl_error_msg (interp, "Invalid to specify single attribute and attribute list");
     }
 
-    if ((attr_name != NULL) && (attr_value == NULL)) {
+    if ((attr_name != NULL) && (value_arg == NULL)) {
         return tcl_error_msg (interp, "Single attribute without value");
     }
 
-    struct ig_object *obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, obj_name));
+    struct ig_object *obj = ig_tclc_get_object_commit (db, obj_arg);
     if (obj == NULL) {
         g_list_free (attr_list);
         return tcl_error_msg (interp, "Unknown object \"%s\"", obj_name);
     }
 
     if (attr_name != NULL) {
-        if (!ig_obj_attr_set (obj, attr_name, attr_value, false)) {
-            return tcl_error_msg (interp, "Unable to attribute \"%s\"(=\"%s\") for object \"%s\"", attr_name, attr_value, obj_name);
+        if (!ig_tclc_attr_set_obj (obj, attr_name, value_arg)) {
+            return tcl_error_msg (interp, "Unable to attribute \"%s\"(=\"%s\") for object \"%s\"", attr_name, Tcl_GetString (value_arg), obj_name);
         }
 
-        Tcl_SetObjResult (interp, Tcl_NewStringObj (attr_value, -1));
+        Tcl_SetObjResult (interp, value_arg);
         return TCL_OK;
     }
 
@@ -495,17 +868,17 @@ static int ig_tclc_get_attribute (ClientData clientdata, Tcl_Interp *interp, int
     int int_true  = true;
     int int_false = false;
 
-    char  *obj_name        = NULL;
+    Tcl_Obj *obj_arg       = NULL;
     char  *attr_name       = NULL;
-    char  *defaultval      = NULL;
+    Tcl_Obj *default_arg   = NULL;
     GList *attr_list       = NULL;
     bool   print_attr_name = false;
     int    check_exists    = int_false;
 
     Tcl_ArgvInfo arg_table [] = {
-        {TCL_ARGV_STRING,   "-object",      NULL, (void *)&obj_name,    "object id", NULL},
+        {TCL_ARGV_FUNC,     "-object",      (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&obj_arg, "object id", NULL},
         {TCL_ARGV_STRING,   "-attribute",   NULL, (void *)&attr_name,   "attribute name", NULL},
-        {TCL_ARGV_STRING,   "-default",     NULL, (void *)&defaultval,  "default value for single attribute if attribute does not exist", NULL},
+        {TCL_ARGV_FUNC,     "-default",     (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&default_arg, "default value for single attribute if attribute does not exist", NULL},
 
         {TCL_ARGV_FUNC,     "-attributes",  (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_string_list_parse, (void *)&attr_list, "attributes as list of form <name1> <name2> ...", NULL},
 
@@ -518,17 +891,18 @@ static int ig_tclc_get_attribute (ClientData clientdata, Tcl_Interp *interp, int
     int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
     if (result != TCL_OK) return result;
 
-    if (obj_name == NULL) {
+    if (obj_arg == NULL) {
         g_list_free (attr_list);
         return tcl_error_msg (interp, "No object specified");
     }
+    const char *obj_name = Tcl_GetString (obj_arg);
 
     if ((attr_list != NULL) && (attr_name != NULL)) {
         g_list_free (attr_list);
         return tcl_error_msg (interp, "Specifying single attribute and attribute list is not supported");
     }
 
-    struct ig_object *obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, obj_name));
+    struct ig_object *obj = ig_tclc_get_object_commit (db, obj_arg);
     if (obj == NULL) {
         g_list_free (attr_list);
         return tcl_error_msg (interp, "Unknown object \"%s\"", obj_name);
@@ -539,21 +913,22 @@ static int ig_tclc_get_attribute (ClientData clientdata, Tcl_Interp *interp, int
     }
 
     if (attr_name != NULL) {
-        const char *val = ig_obj_attr_get (obj, attr_name);
+        struct ig_attribute attr;
+        bool                exists = ig_obj_attr_get_typed (obj, attr_name, &attr);
         if (check_exists) {
-            Tcl_SetObjResult (interp, Tcl_NewBooleanObj (val != NULL));
+            Tcl_SetObjResult (interp, Tcl_NewBooleanObj (exists));
             return TCL_OK;
         }
 
-        if (val == NULL) {
-            if (defaultval != NULL) {
-                val = defaultval;
-            } else {
-                return tcl_error_msg (interp, "Could not get attribute \"%s\" of object \"%s\"", attr_name, obj_name);
+        if (!exists) {
+            if (default_arg != NULL) {
+                Tcl_SetObjResult (interp, default_arg);
+                return TCL_OK;
             }
+            return tcl_error_msg (interp, "Could not get attribute \"%s\" of object \"%s\"", attr_name, obj_name);
         }
 
-        Tcl_SetObjResult (interp, Tcl_NewStringObj (val, -1));
+        Tcl_SetObjResult (interp, ig_tclc_attr_value_obj (&attr));
         return TCL_OK;
     }
 
@@ -571,17 +946,18 @@ static int ig_tclc_get_attribute (ClientData clientdata, Tcl_Interp *interp, int
     /* result list */
     Tcl_Obj *retval = Tcl_NewListObj (0, NULL);
     for (GList *li = attr_list; li != NULL; li = li->next) {
-        char       *attr = (char *)li->data;
-        const char *val  = ig_obj_attr_get (obj, attr);
+        char               *attr_key = (char *)li->data;
+        struct ig_attribute attr;
+        bool                exists   = ig_obj_attr_get_typed (obj, attr_key, &attr);
 
         Tcl_Obj *val_obj = NULL;
         if (check_exists) {
-            val_obj = Tcl_NewBooleanObj (val != NULL);
+            val_obj = Tcl_NewBooleanObj (exists);
         } else {
-            val_obj = Tcl_NewStringObj (val, -1);
+            val_obj = ig_tclc_attr_value_obj (&attr);
         }
         if (print_attr_name) {
-            Tcl_ListObjAppendElement (interp, retval, Tcl_NewStringObj (attr, -1));
+            Tcl_ListObjAppendElement (interp, retval, Tcl_NewStringObj (attr_key, -1));
         }
         Tcl_ListObjAppendElement (interp, retval, val_obj);
     }
@@ -592,97 +968,42 @@ static int ig_tclc_get_attribute (ClientData clientdata, Tcl_Interp *interp, int
     return TCL_OK;
 }
 
-enum ig_tclc_get_objs_of_obj_version {
-    IG_TOOOV_INVALID,
-    IG_TOOOV_PINS,
-    IG_TOOOV_PORTS,
-    IG_TOOOV_DECLS,
-    IG_TOOOV_ADJ,
-    IG_TOOOV_PARAMS,
-    IG_TOOOV_CODE,
-    IG_TOOOV_MODULES,
-    IG_TOOOV_INSTANCES,
-    IG_TOOOV_REGFILES,
-    IG_TOOOV_RF_ENTRIES,
-    IG_TOOOV_RF_REGS,
-    IG_TOOOV_NETS,
-    IG_TOOOV_GENERICS,
-};
-
-static enum ig_tclc_get_objs_of_obj_version ig_tclc_get_objs_of_obj_version_from_cmd (const char *cmdname)
-{
-    while (true) {
-        const char *cmdchomp = strstr (cmdname, "::");
-        if (cmdchomp == NULL) break;
-        cmdname = cmdchomp + 2;
-    }
-    enum ig_tclc_get_objs_of_obj_version version = IG_TOOOV_INVALID;
-    if (strcmp (cmdname, "get_ports") == 0) {
-        version = IG_TOOOV_PORTS;
-    } else if (strcmp (cmdname, "get_declarations") == 0) {
-        version = IG_TOOOV_DECLS;
-    } else if (strcmp (cmdname, "get_parameters") == 0) {
-        version = IG_TOOOV_PARAMS;
-    } else if (strcmp (cmdname, "get_codesections") == 0) {
-        version = IG_TOOOV_CODE;
-    } else if (strcmp (cmdname, "get_pins") == 0) {
-        version = IG_TOOOV_PINS;
-    } else if (strcmp (cmdname, "get_adjustments") == 0) {
-        version = IG_TOOOV_ADJ;
-    } else if (strcmp (cmdname, "get_modules") == 0) {
-        version = IG_TOOOV_MODULES;
-    } else if (strcmp (cmdname, "get_instances") == 0) {
-        version = IG_TOOOV_INSTANCES;
-    } else if (strcmp (cmdname, "get_regfiles") == 0) {
-        version = IG_TOOOV_REGFILES;
-    } else if (strcmp (cmdname, "get_regfile_entries") == 0) {
-        version = IG_TOOOV_RF_ENTRIES;
-    } else if (strcmp (cmdname, "get_regfile_regs") == 0) {
-        version = IG_TOOOV_RF_REGS;
-    } else if (strcmp (cmdname, "get_nets") == 0) {
-        version = IG_TOOOV_NETS;
-    } else if (strcmp (cmdname, "get_generics") == 0) {
-        version = IG_TOOOV_GENERICS;
-    }
-
-    return version;
-}
-
 /* TCLDOC
 ##
-# @brief Return child object(s) of given parent.
+# @brief Get values of attributes of multiple objects at once.
 #
 # @param args Parsed command arguments:<br>
-# (-name \<child-name\><br>
-# |-all)<br>
-# -of \<parent-object-id\>
+# -objects {\<object-id1\> \<object-id2\> ...}<br>
+# -attributes {\<name1\> \<name2\> ...}<br>
+# [ -defaults {\<default1\> \<default2\> ...}]<br>
+# [ -dict]
 #
-# @return Object-ID(s) of child object(s) or an error
+# @return List with one entry per object: a list of the values of the specified attributes
+# or in case @c -dict is specified a list of form {\<name1\> \<value1\> \<name2\> \<value2\> ...}.
+#
+# If @c -defaults is specified, it must contain one default value for each attribute,
+# which is used if an object does not have the attribute.
 */
-static int ig_tclc_get_objs_of_obj (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+static int ig_tclc_get_attributes (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
 {
     struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
 
     if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
 
-    /* command version */
-    const char                          *cmdname = Tcl_GetString (objv[0]);
-    enum ig_tclc_get_objs_of_obj_version version = ig_tclc_get_objs_of_obj_version_from_cmd (cmdname);
-
-    if (version == IG_TOOOV_INVALID) return tcl_error_msg (interp, "Internal Error - Invalid command version generated (%s:%d)", __FILE__, __LINE__);
-
-    /* arg parsing */
     int int_true  = true;
     int int_false = false;
 
-    int   all         = int_false;
-    char *parent_name = NULL;
-    char *child_name  = NULL;
+    Tcl_Obj *objs_arg     = NULL;
+    Tcl_Obj *attrs_arg    = NULL;
+    Tcl_Obj *defaults_arg = NULL;
+    int      as_dict      = int_false;
 
     Tcl_ArgvInfo arg_table [] = {
-        {TCL_ARGV_CONSTANT, "-all",    GINT_TO_POINTER (int_true), (void *)&all,         "return all objects", NULL},
-        {TCL_ARGV_STRING,   "-name",   NULL,                       (void *)&child_name,  "object name",        NULL},
-        {TCL_ARGV_STRING,   "-of",     NULL,                       (void *)&parent_name, "parent object",      NULL},
+        {TCL_ARGV_FUNC,     "-objects",     (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&objs_arg,     "list of object ids", NULL},
+        {TCL_ARGV_FUNC,     "-attributes",  (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&attrs_arg,    "attributes as list of form <name1> <name2> ...", NULL},
+        {TCL_ARGV_FUNC,     "-defaults",    (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&defaults_arg, "default values as list of form <default1> <default2> ...", NULL},
+
+        {TCL_ARGV_CONSTANT, "-dict",        GINT_TO_POINTER (int_true), (void *)&as_dict,  "return attribute names and values", NULL},
 
         TCL_ARGV_AUTO_HELP,
         TCL_ARGV_TABLE_END
@@ -691,183 +1012,1175 @@ static int ig_tclc_get_objs_of_obj (ClientData clientdata, Tcl_Interp *interp, i
     int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
     if (result != TCL_OK) return result;
 
-    /* sanity checks */
-    if (parent_name == NULL) {
-        if ((version == IG_TOOOV_DECLS) || (version == IG_TOOOV_PORTS) || (version == IG_TOOOV_PARAMS) || (version == IG_TOOOV_CODE)) {
-            return tcl_error_msg (interp, "Flag -of <module> needs to be specified");
-        } else if ((version == IG_TOOOV_PINS) || (version == IG_TOOOV_ADJ)) {
-            return tcl_error_msg (interp, "Flag -of <instance> needs to be specified");
-        } else if (version == IG_TOOOV_RF_ENTRIES) {
-            return tcl_error_msg (interp, "Flag -of <regfile> needs to be specified");
-        } else if (version == IG_TOOOV_RF_REGS) {
-            return tcl_error_msg (interp, "Flag -of <regfile-entry> needs to be specified");
+    if (objs_arg == NULL) return tcl_error_msg (interp, "No objects specified");
+    if (attrs_arg == NULL) return tcl_error_msg (interp, "No attributes specified");
+
+    int       n_objs     = 0;
+    Tcl_Obj **obj_elems  = NULL;
+    int       n_attrs    = 0;
+    Tcl_Obj **attr_elems = NULL;
+    int       n_defaults = 0;
+    Tcl_Obj **def_elems  = NULL;
+
+    if (Tcl_ListObjGetElements (interp, objs_arg, &n_objs, &obj_elems) != TCL_OK) return TCL_ERROR;
+    if (Tcl_ListObjGetElements (interp, attrs_arg, &n_attrs, &attr_elems) != TCL_OK) return TCL_ERROR;
+    if (defaults_arg != NULL) {
+        if (Tcl_ListObjGetElements (interp, defaults_arg, &n_defaults, &def_elems) != TCL_OK) return TCL_ERROR;
+        if (n_defaults != n_attrs) {
+            return tcl_error_msg (interp, "Number of defaults (%d) does not match number of attributes (%d)", n_defaults, n_attrs);
         }
     }
 
-    if ((version == IG_TOOOV_CODE) && (child_name != NULL)) {
-        return tcl_error_msg (interp, "Invalid to specify name for code sections");
+    /* attribute names are looked up once for all objects */
+    const char **attr_names = g_new (const char *, n_attrs);
+    for (int i = 0; i < n_attrs; i++) {
+        attr_names[i] = Tcl_GetString (attr_elems[i]);
     }
 
-    if (((version == IG_TOOOV_NETS) || (version == IG_TOOOV_GENERICS)) && (child_name != NULL) && (parent_name != NULL)) {
-        return tcl_error_msg (interp, "Invalid to specify -name and -of");
-    }
+    Tcl_Obj *retval = Tcl_NewListObj (0, NULL);
+    Tcl_IncrRefCount (retval);
 
-    if (all && (child_name != NULL)) {
-        return tcl_error_msg (interp, "Invalid to specify name and -all");
-    }
+    for (int i_obj = 0; i_obj < n_objs; i_obj++) {
+        struct ig_object *obj = ig_tclc_get_object_commit (db, obj_elems[i_obj]);
+        if (obj == NULL) {
+            result = tcl_error_msg (interp, "Unknown object \"%s\"", Tcl_GetString (obj_elems[i_obj]));
+            break;
+        }
 
-    if (child_name == NULL) {
-        all = true;
-    }
+        Tcl_Obj *row = Tcl_NewListObj (0, NULL);
+        Tcl_ListObjAppendElement (interp, retval, row);
 
-    /* child list */
-    GList *child_list      = NULL;
-    bool   child_list_free = false;
+        for (int i_attr = 0; i_attr < n_attrs; i_attr++) {
+            struct ig_attribute attr;
+            Tcl_Obj            *val_obj = NULL;
 
-    if ((version == IG_TOOOV_INSTANCES) && (parent_name == NULL)) {
-        if (all) {
-            child_list = g_hash_table_get_values (db->instances_by_id);
-        } else {
-            if (g_hash_table_contains (db->instances_by_name, child_name)) {
-                child_list = g_list_prepend (child_list, g_hash_table_lookup (db->instances_by_name, child_name));
-            }
-        }
-        child_list_free = true;
-    } else if ((version == IG_TOOOV_MODULES) && (parent_name == NULL)) {
-        if (all) {
-            child_list = g_hash_table_get_values (db->modules_by_id);
-        } else {
-            if (g_hash_table_contains (db->modules_by_name, child_name)) {
-                child_list = g_list_prepend (child_list, g_hash_table_lookup (db->modules_by_name, child_name));
-            }
-        }
-        child_list_free = true;
-    } else if ((version == IG_TOOOV_REGFILES) && (parent_name == NULL)) {
-        if (all) {
-            child_list = g_hash_table_get_values (db->regfiles_by_id);
-        } else {
-            if (g_hash_table_contains (db->regfiles_by_name, child_name)) {
-                child_list = g_list_prepend (child_list, g_hash_table_lookup (db->regfiles_by_name, child_name));
-            }
-        }
-        child_list_free = true;
-    } else if ((version == IG_TOOOV_NETS) && (parent_name == NULL)) {
-        if (all) {
-            child_list = g_hash_table_get_values (db->nets_by_id);
-        } else {
-            if (g_hash_table_contains (db->nets_by_name, child_name)) {
-                child_list = g_list_prepend (child_list, g_hash_table_lookup (db->nets_by_name, child_name));
-            }
-        }
-        child_list_free = true;
-    } else if ((version == IG_TOOOV_GENERICS) && (parent_name == NULL)) {
-        if (all) {
-            child_list = g_hash_table_get_values (db->generics_by_id);
-        } else {
-            if (g_hash_table_contains (db->generics_by_name, child_name)) {
-                child_list = g_list_prepend (child_list, g_hash_table_lookup (db->generics_by_name, child_name));
+            if (ig_obj_attr_get_typed (obj, attr_names[i_attr], &attr)) {
+                val_obj = ig_tclc_attr_value_obj (&attr);
+            } else if (def_elems != NULL) {
+                val_obj = def_elems[i_attr];
+            } else {
+                result = tcl_error_msg (interp, "Could not get attribute \"%s\" of object \"%s\"", attr_names[i_attr], ig_obj_id (obj));
+                break;
             }
-        }
-        child_list_free = true;
-    } else if ((version == IG_TOOOV_DECLS) || (version == IG_TOOOV_PORTS) || (version == IG_TOOOV_PARAMS)
-               || (version == IG_TOOOV_CODE) || (version == IG_TOOOV_INSTANCES) || (version == IG_TOOOV_REGFILES)) {
-        struct ig_module *mod = IG_MODULE (PTR_TO_IG_OBJECT (g_hash_table_lookup (db->modules_by_id, parent_name)));
-        if (mod == NULL) {
-            return tcl_error_msg (interp, "Unable to find \"%s\" in database", parent_name);
-        }
 
-        if (mod->resource) {
-            if ((version == IG_TOOOV_DECLS) || (version == IG_TOOOV_CODE)
-                || (version == IG_TOOOV_INSTANCES) || (version == IG_TOOOV_REGFILES)) {
-                return tcl_error_msg (interp, "Command is not applicable to a resource (\"%s\")", parent_name);
+            if (as_dict) {
+                Tcl_ListObjAppendElement (interp, row, attr_elems[i_attr]);
             }
+            Tcl_ListObjAppendElement (interp, row, val_obj);
         }
+        if (result != TCL_OK) break;
+    }
 
-        if (version == IG_TOOOV_DECLS) {
-            child_list = mod->decls->head;
+    if (result == TCL_OK) {
+        Tcl_SetObjResult (interp, retval);
+    }
+    Tcl_DecrRefCount (retval);
+    g_free (attr_names);
+
+    return result;
+}
+
+/* preprocessed object data for templates: module_data, instance_data and regfile_data */
+#define IG_TCLC_RF_WORDSIZE 32
+
+/* append key and value to a list of form {<key1> <value1> <key2> <value2> ...}, key objects are shared via key_objs */
+static void ig_tclc_list_append_kv (GHashTable *key_objs, Tcl_Obj *list, const char *key, Tcl_Obj *value)
+{
+    Tcl_Obj *key_obj = (Tcl_Obj *)g_hash_table_lookup (key_objs, key);
+    if (key_obj == NULL) {
+        key_obj = Tcl_NewStringObj (key, -1);
+        Tcl_IncrRefCount (key_obj);
+        g_hash_table_insert (key_objs, g_strdup (key), key_obj);
+    }
+
+    Tcl_ListObjAppendElement (NULL, list, key_obj);
+    Tcl_ListObjAppendElement (NULL, list, value);
+}
+
+/* attribute value as Tcl object or default_value if attribute does not exist */
+static Tcl_Obj *ig_tclc_attr_obj (struct ig_object *obj, const char *name, const char *default_value)
+{
+    struct ig_attribute attr;
+
+    if (ig_obj_attr_get_typed (obj, name, &attr)) {
+        return ig_tclc_attr_value_obj (&attr);
+    }
+
+    return Tcl_NewStringObj (default_value, -1);
+}
+
+/* Tcl string object of "<high>:<low>" */
+static Tcl_Obj *ig_tclc_new_range_obj (gint64 high, gint64 low)
+{
+    char buf[48];
+    g_snprintf (buf, sizeof (buf), "%" G_GINT64_FORMAT ":%" G_GINT64_FORMAT, high, low);
+
+    return Tcl_NewStringObj (buf, -1);
+}
+
+/* integer value of a string as parsed by tcl */
+static bool ig_tclc_str_to_int (const char *str, gint64 *value)
+{
+    /* plain decimal numbers */
+    const char *c = (str[0] == '-' ? str + 1 : str);
+    if ((c[0] >= '1') && (c[0] <= '9') && (strlen (c) < 16)) {
+        while (g_ascii_isdigit (*c)) c++;
+        if (*c == '\0') {
+            *value = g_ascii_strtoll (str, NULL, 10);
+            return true;
+        }
+    } else if ((c[0] == '0') && (c[1] == '\0')) {
+        *value = 0;
+        return true;
+    }
+
+    Tcl_Obj *str_obj = Tcl_NewStringObj (str, -1);
+    Tcl_IncrRefCount (str_obj);
+
+    Tcl_WideInt wide_value = 0;
+    bool        result     = (Tcl_GetWideIntFromObj (NULL, str_obj, &wide_value) == TCL_OK);
+    Tcl_DecrRefCount (str_obj);
+
+    *value = wide_value;
+    return result;
+}
+
+/* verilog bitrange of a size as generated by ig::vlog::bitrange */
+static void ig_tclc_vlog_bitrange (GString *result, const char *size)
+{
+    gint64 int_size = 0;
+
+    if (ig_tclc_str_to_int (size, &int_size) && (int_size >= G_MININT) && (int_size <= G_MAXUINT)) {
+        if (int_size != 1) {
+            g_string_append_printf (result, "[%" G_GINT64_FORMAT ":0]", int_size - 1);
+        }
+        return;
+    }
+
+    /* size of form <prefix><+|-><number> */
+    const char *op = NULL;
+    for (const char *c = size; *c != '\0'; c++) {
+        if ((*c == '+') || (*c == '-')) op = c;
+    }
+    bool is_expr = ((op != NULL) && (op[1] >= '1') && (op[1] <= '9'));
+    for (const char *c = (is_expr ? op + 2 : ""); *c != '\0'; c++) {
+        if (!g_ascii_isdigit (*c)) is_expr = false;
+    }
+
+    if (!is_expr) {
+        g_string_append_printf (result, "[%s-1:0]", size);
+        return;
+    }
+
+    gint64 num = g_ascii_strtoll (op + 1, NULL, 10) + (*op == '+' ? -1 : 1);
+    g_string_append_c (result, '[');
+    g_string_append_len (result, size, op - size);
+    if (num != 0) {
+        g_string_append_printf (result, "%c%" G_GINT64_FORMAT, *op, num);
+    }
+    g_string_append (result, ":0]");
+}
+
+/* verilog bitrange of object's size attribute and of its dimension attribute, str is used as buffer */
+static int ig_tclc_obj_bitranges (Tcl_Interp *interp, GString *str, Tcl_Obj *size_obj, Tcl_Obj *dimension_obj, Tcl_Obj **bitrange, Tcl_Obj **dimension_bitrange)
+{
+    int       n_dims = 0;
+    Tcl_Obj **dims   = NULL;
+    if (Tcl_ListObjGetElements (interp, dimension_obj, &n_dims, &dims) != TCL_OK) return TCL_ERROR;
+
+    g_string_truncate (str, 0);
+    ig_tclc_vlog_bitrange (str, Tcl_GetString (size_obj));
+    *bitrange = Tcl_NewStringObj (str->str, str->len);
+
+    g_string_truncate (str, 0);
+    for (int i = 0; i < n_dims; i++) {
+        ig_tclc_vlog_bitrange (str, Tcl_GetString (dims[i]));
+    }
+    *dimension_bitrange = Tcl_NewStringObj (str->str, str->len);
+
+    return TCL_OK;
+}
+
+/* call a single argument tcl proc, returns result with incremented reference count or NULL on error
+ * arg is released if not referenced by the caller */
+static Tcl_Obj *ig_tclc_call_proc (Tcl_Interp *interp, const char *proc, Tcl_Obj *arg)
+{
+    Tcl_Obj *cmd[2] = {Tcl_NewStringObj (proc, -1), arg};
+
+    Tcl_IncrRefCount (cmd[0]);
+    Tcl_IncrRefCount (cmd[1]);
+    int result = Tcl_EvalObjv (interp, 2, cmd, 0);
+    Tcl_DecrRefCount (cmd[0]);
+    Tcl_DecrRefCount (cmd[1]);
+
+    if (result != TCL_OK) return NULL;
+
+    Tcl_Obj *retval = Tcl_GetObjResult (interp);
+    Tcl_IncrRefCount (retval);
+    Tcl_ResetResult (interp);
+
+    return retval;
+}
+
+/* value of attribute adapted by proc if adapt attribute is set, returns result with incremented reference count or NULL on error */
+static Tcl_Obj *ig_tclc_adapt_obj (Tcl_Interp *interp, struct ig_lib_db *db, struct ig_object *obj, Tcl_Obj *raw, const char *proc)
+{
+    const char *adapt = ig_obj_attr_get (obj, "adapt");
+
+    if ((adapt == NULL) || (strcmp (adapt, "none") == 0)) {
+        Tcl_IncrRefCount (raw);
+        return raw;
+    }
+
+    return ig_tclc_call_proc (interp, proc, ig_tclc_new_object (db, obj));
+}
+
+/* instance data as generated by ig::templates::preprocess::instance_to_arraylist or NULL on error */
+static Tcl_Obj *ig_tclc_instance_data (Tcl_Interp *interp, struct ig_lib_db *db, struct ig_instance *inst)
+{
+    GHashTable       *key_objs = ig_tclc_interp_key_objs (interp);
+    struct ig_module *mod      = inst->module;
+    Tcl_Obj          *ilm_obj  = ig_tclc_attr_obj (IG_OBJECT (mod), "ilm", "false");
+    Tcl_Obj          *result   = Tcl_NewListObj (0, NULL);
+
+    ig_tclc_list_append_kv (key_objs, result, "name",        ig_tclc_attr_obj (IG_OBJECT (inst), "name", ""));
+    ig_tclc_list_append_kv (key_objs, result, "object",      ig_tclc_new_object (db, IG_OBJECT (inst)));
+    ig_tclc_list_append_kv (key_objs, result, "module",      ig_tclc_new_object (db, IG_OBJECT (mod)));
+    ig_tclc_list_append_kv (key_objs, result, "ilm",         ilm_obj);
+    ig_tclc_list_append_kv (key_objs, result, "module.name", ig_tclc_attr_obj (IG_OBJECT (mod), "name", ""));
+
+    /* pins */
+    Tcl_Obj *pin_data = Tcl_NewListObj (0, NULL);
+    for (guint i = 0; i < ig_obj_array_len (&inst->pins); i++) {
+        struct ig_object *pin            = PTR_TO_IG_OBJECT (ig_obj_array_index (&inst->pins, i));
+        Tcl_Obj          *connection_raw = ig_tclc_attr_obj (pin, "connection", "");
+        Tcl_Obj          *connection     = ig_tclc_adapt_obj (interp, db, pin, connection_raw, "::ig::aux::adapt_pin_connection");
+
+        if (connection == NULL) {
+            Tcl_DecrRefCount (connection_raw);
+            Tcl_DecrRefCount (pin_data);
+            Tcl_DecrRefCount (result);
+            return NULL;
+        }
+
+        Tcl_Obj *i_data = Tcl_NewListObj (0, NULL);
+        ig_tclc_list_append_kv (key_objs, i_data, "name",           ig_tclc_attr_obj (pin, "name", ""));
+        ig_tclc_list_append_kv (key_objs, i_data, "object",         ig_tclc_new_object (db, pin));
+        ig_tclc_list_append_kv (key_objs, i_data, "connection",     connection);
+        ig_tclc_list_append_kv (key_objs, i_data, "connection_raw", connection_raw);
+        ig_tclc_list_append_kv (key_objs, i_data, "invert",         ig_tclc_attr_obj (pin, "invert", "false"));
+        Tcl_DecrRefCount (connection);
+
+        Tcl_ListObjAppendElement (NULL, pin_data, i_data);
+    }
+    ig_tclc_list_append_kv (key_objs, result, "pins", pin_data);
+
+    /* parameters */
+    Tcl_Obj *param_data = Tcl_NewListObj (0, NULL);
+    for (guint i = 0; i < ig_obj_array_len (&inst->adjustments); i++) {
+        struct ig_object *adj    = PTR_TO_IG_OBJECT (ig_obj_array_index (&inst->adjustments, i));
+        Tcl_Obj          *i_data = Tcl_NewListObj (0, NULL);
+
+        ig_tclc_list_append_kv (key_objs, i_data, "name",   ig_tclc_attr_obj (adj, "name", ""));
+        ig_tclc_list_append_kv (key_objs, i_data, "object", ig_tclc_new_object (db, adj));
+        ig_tclc_list_append_kv (key_objs, i_data, "value",  ig_tclc_attr_obj (adj, "value", ""));
+
+        Tcl_ListObjAppendElement (NULL, param_data, i_data);
+    }
+    ig_tclc_list_append_kv (key_objs, result, "parameters", param_data);
+
+    int ilm = false;
+    if (Tcl_GetBooleanFromObj (NULL, ilm_obj, &ilm) != TCL_OK) ilm = false;
+    ig_tclc_list_append_kv (key_objs, result, "hasparams", Tcl_NewIntObj ((!ilm) && (ig_obj_array_len (&inst->adjustments) > 0)));
+
+    return result;
+}
+
+/* register of a regfile entry, sortable by bit_low */
+struct ig_tclc_rf_reg {
+    guint    pos;        /* position in entry for stable sorting */
+    gint64   bit_high;   /* numeric value of values[1] */
+    gint64   bit_low;    /* numeric value of values[2] */
+    Tcl_Obj *values[11]; /* name bit_high bit_low width entrybits type reset signal signalbits comment object */
+};
+
+static gint ig_tclc_rf_reg_cmp (gconstpointer a, gconstpointer b)
+{
+    const struct ig_tclc_rf_reg *reg_a = (const struct ig_tclc_rf_reg *)a;
+    const struct ig_tclc_rf_reg *reg_b = (const struct ig_tclc_rf_reg *)b;
+
+    if (reg_a->bit_low != reg_b->bit_low) return (reg_a->bit_low < reg_b->bit_low ? -1 : 1);
+    if (reg_a->pos != reg_b->pos) return (reg_a->pos < reg_b->pos ? -1 : 1);
+    return 0;
+}
+
+static const char *ig_tclc_rf_reg_keys[] = {
+    "name", "bit_high", "bit_low", "width", "entrybits", "type", "reset", "signal", "signalbits", "comment", "object"
+};
+
+/* register data of unused bits high:low of a regfile entry */
+static Tcl_Obj *ig_tclc_rf_gap_data (GHashTable *key_objs, gint64 high, gint64 low)
+{
+    Tcl_Obj *entrybits = NULL;
+    if (high == low) {
+        entrybits = Tcl_NewWideIntObj (high);
+    } else {
+        entrybits = ig_tclc_new_range_obj (high, low);
+    }
+
+    Tcl_Obj *values[11] = {
+        Tcl_NewStringObj ("-", -1), Tcl_NewWideIntObj (high), Tcl_NewWideIntObj (low), Tcl_NewWideIntObj (high - low + 1),
+        entrybits, Tcl_NewStringObj ("-", -1), Tcl_NewStringObj ("-", -1), Tcl_NewStringObj ("-", -1),
+        Tcl_NewStringObj ("-", -1), Tcl_NewStringObj ("", -1), Tcl_NewStringObj ("", -1)
+    };
+
+    Tcl_Obj *result = Tcl_NewListObj (0, NULL);
+    for (int i = 0; i < 11; i++) {
+        ig_tclc_list_append_kv (key_objs, result, ig_tclc_rf_reg_keys[i], values[i]);
+    }
+    return result;
+}
+
+/* parse register of regfile entry, sets error message and returns false on failure */
+static bool ig_tclc_rf_reg_parse (struct ig_lib_db *db, struct ig_object *reg, gint64 *next_bit, struct ig_tclc_rf_reg *data, GString *error)
+{
+    Tcl_Obj *name       = ig_tclc_attr_obj (reg, "name",          "");
+    Tcl_Obj *width      = ig_tclc_attr_obj (reg, "rf_width",      "-1");
+    Tcl_Obj *entrybits  = ig_tclc_attr_obj (reg, "rf_entrybits",  "");
+    Tcl_Obj *type       = ig_tclc_attr_obj (reg, "rf_type",       "RW");
+    Tcl_Obj *reset      = ig_tclc_attr_obj (reg, "rf_reset",      "-");
+    Tcl_Obj *signal     = ig_tclc_attr_obj (reg, "rf_signal",     "-");
+    Tcl_Obj *signalbits = ig_tclc_attr_obj (reg, "rf_signalbits", "-");
+    Tcl_Obj *comment    = ig_tclc_attr_obj (reg, "rf_comment",    "");
+
+    Tcl_Obj *values[11] = {name, NULL, NULL, width, entrybits, type, reset, signal, signalbits, comment, ig_tclc_new_object (db, reg)};
+    for (int i = 0; i < 11; i++) {
+        if (values[i] != NULL) Tcl_IncrRefCount (values[i]);
+    }
+
+    bool    result   = false;
+    gchar **blist    = NULL;
+    gint64  width_nr = 0;
+    gint64  b0       = 0;
+    gint64  b1       = 0;
+
+    /* non-integer width is only invalid if entrybits need to be computed */
+    bool        width_int = ig_tclc_str_to_int (Tcl_GetString (width), &width_nr);
+    const char *eb_str    = Tcl_GetString (entrybits);
+    if (!width_int && (eb_str[0] == '\0')) {
+        g_string_printf (error, "expected integer but got \"%s\"", Tcl_GetString (width));
+        goto ig_tclc_rf_reg_parse_out;
+    }
+
+    if (width_int && (width_nr < 0)) {
+        Tcl_Obj *new_width = NULL;
+        if (eb_str[0] == '\0') {
+            new_width = Tcl_NewWideIntObj (IG_TCLC_RF_WORDSIZE);
+            Tcl_DecrRefCount (values[4]);
+            values[4] = ig_tclc_new_range_obj (IG_TCLC_RF_WORDSIZE - 1, 0);
+            Tcl_IncrRefCount (values[4]);
+        } else {
+            blist = g_strsplit (eb_str, ":", -1);
+            if (g_strv_length (blist) == 1) {
+                new_width = Tcl_NewWideIntObj (1);
+            } else {
+                if (!ig_tclc_str_to_int (blist[0], &b0) || !ig_tclc_str_to_int (blist[1], &b1)) {
+                    g_string_printf (error, "can't use entrybits \"%s\" of register as integer range", eb_str);
+                    goto ig_tclc_rf_reg_parse_out;
+                }
+                new_width = Tcl_NewWideIntObj (b0 - b1 + 1);
+            }
+            g_strfreev (blist);
+            blist = NULL;
+        }
+        Tcl_DecrRefCount (values[3]);
+        values[3] = new_width;
+        Tcl_IncrRefCount (values[3]);
+    } else if (eb_str[0] == '\0') {
+        Tcl_DecrRefCount (values[4]);
+        if (width_nr == 1) {
+            values[4] = Tcl_NewWideIntObj (*next_bit);
+        } else {
+            values[4] = ig_tclc_new_range_obj (width_nr + *next_bit - 1, *next_bit);
+        }
+        Tcl_IncrRefCount (values[4]);
+    }
+
+    blist = g_strsplit (Tcl_GetString (values[4]), ":", -1);
+    const char *bit_high = blist[0];
+    const char *bit_low  = (g_strv_length (blist) == 2 ? blist[1] : blist[0]);
+
+    if (!ig_tclc_str_to_int (bit_high, &data->bit_high)) {
+        g_string_printf (error, "expected integer but got \"%s\"", bit_high);
+        goto ig_tclc_rf_reg_parse_out;
+    }
+    if (!ig_tclc_str_to_int (bit_low, &data->bit_low)) {
+        g_string_printf (error, "expected integer but got \"%s\"", bit_low);
+        goto ig_tclc_rf_reg_parse_out;
+    }
+    *next_bit = data->bit_high + 1;
+
+    values[1] = Tcl_NewStringObj (bit_high, -1);
+    values[2] = Tcl_NewStringObj (bit_low, -1);
+    Tcl_IncrRefCount (values[1]);
+    Tcl_IncrRefCount (values[2]);
+
+    memcpy (data->values, values, sizeof (values));
+    result = true;
+
+ig_tclc_rf_reg_parse_out:
+    g_strfreev (blist);
+    if (!result) {
+        for (int i = 0; i < 11; i++) {
+            if (values[i] != NULL) Tcl_DecrRefCount (values[i]);
+        }
+    }
+
+    return result;
+}
+
+/* entry of a regfile, sortable by address */
+struct ig_tclc_rf_entry {
+    guint    pos;     /* position in regfile for stable sorting */
+    gint64   address; /* numeric value of address */
+    Tcl_Obj *data;    /* entry data */
+};
+
+static gint ig_tclc_rf_entry_cmp (gconstpointer a, gconstpointer b)
+{
+    const struct ig_tclc_rf_entry *entry_a = (const struct ig_tclc_rf_entry *)a;
+    const struct ig_tclc_rf_entry *entry_b = (const struct ig_tclc_rf_entry *)b;
+
+    if (entry_a->address != entry_b->address) return (entry_a->address < entry_b->address ? -1 : 1);
+    if (entry_a->pos != entry_b->pos) return (entry_a->pos < entry_b->pos ? -1 : 1);
+    return 0;
+}
+
+/* regfile entry data as generated by ig::templates::preprocess::regfile_to_arraylist or NULL on error */
+static Tcl_Obj *ig_tclc_rf_entry_data (GHashTable *key_objs, struct ig_lib_db *db, struct ig_rf_entry *entry, const char **reg_name, GString *error)
+{
+    GArray *regs     = g_array_new (false, false, sizeof (struct ig_tclc_rf_reg));
+    gint64  next_bit = 0;
+    bool    valid    = true;
+
+    for (guint i = 0; i < ig_obj_array_len (&entry->regs); i++) {
+        struct ig_object     *reg  = PTR_TO_IG_OBJECT (ig_obj_array_index (&entry->regs, i));
+        struct ig_tclc_rf_reg data = {.pos = i};
+
+        *reg_name = reg->name;
+        if (!ig_tclc_rf_reg_parse (db, reg, &next_bit, &data, error)) {
+            valid = false;
+            break;
+        }
+        g_array_append_val (regs, data);
+    }
+
+    Tcl_Obj *reg_list = NULL;
+    Tcl_Obj *result   = NULL;
+
+    if (valid) {
+        g_array_sort (regs, ig_tclc_rf_reg_cmp);
+
+        reg_list = Tcl_NewListObj (0, NULL);
+        gint64 idx_start = -1;
+
+        for (guint i = 0; i < regs->len; i++) {
+            struct ig_tclc_rf_reg *reg = &g_array_index (regs, struct ig_tclc_rf_reg, i);
+
+            if (reg->bit_low - idx_start > 1) {
+                Tcl_ListObjAppendElement (NULL, reg_list, ig_tclc_rf_gap_data (key_objs, reg->bit_low - 1, idx_start + 1));
+            }
+
+            Tcl_Obj *reg_data = Tcl_NewListObj (0, NULL);
+            for (int j = 0; j < 11; j++) {
+                ig_tclc_list_append_kv (key_objs, reg_data, ig_tclc_rf_reg_keys[j], reg->values[j]);
+            }
+            Tcl_ListObjAppendElement (NULL, reg_list, reg_data);
+
+            idx_start = reg->bit_high;
+        }
+        if (idx_start < IG_TCLC_RF_WORDSIZE - 1) {
+            Tcl_ListObjAppendElement (NULL, reg_list, ig_tclc_rf_gap_data (key_objs, IG_TCLC_RF_WORDSIZE - 1, idx_start + 1));
+        }
+
+        struct ig_attribute address;
+        if (!ig_obj_attr_get_typed (IG_OBJECT (entry), "address", &address)) {
+            g_string_printf (error, "Could not get attribute \"address\" of object \"%s\"", ig_obj_id (IG_OBJECT (entry)));
+            Tcl_DecrRefCount (reg_list);
+        } else {
+            result = Tcl_NewListObj (0, NULL);
+            ig_tclc_list_append_kv (key_objs, result, "address", ig_tclc_attr_value_obj (&address));
+
+            GList *keys = ig_obj_attr_get_keys (IG_OBJECT (entry));
+            for (GList *li = keys; li != NULL; li = li->next) {
+                const char *key = (const char *)li->data;
+                if (strcmp (key, "address") == 0) continue;
+                ig_tclc_list_append_kv (key_objs, result, key, ig_tclc_attr_obj (IG_OBJECT (entry), key, ""));
+            }
+            g_list_free (keys);
+
+            ig_tclc_list_append_kv (key_objs, result, "regs",   reg_list);
+            ig_tclc_list_append_kv (key_objs, result, "object", ig_tclc_new_object (db, IG_OBJECT (entry)));
+        }
+    }
+
+    for (guint i = 0; i < regs->len; i++) {
+        struct ig_tclc_rf_reg *reg = &g_array_index (regs, struct ig_tclc_rf_reg, i);
+        for (int j = 0; j < 11; j++) {
+            Tcl_DecrRefCount (reg->values[j]);
+        }
+    }
+    g_array_free (regs, true);
+
+    return result;
+}
+
+/* regfile data as generated by ig::templates::preprocess::regfile_to_arraylist or NULL on error */
+static Tcl_Obj *ig_tclc_regfile_data (Tcl_Interp *interp, struct ig_lib_db *db, struct ig_rf_regfile *regfile)
+{
+    GArray  *entries = g_array_new (false, false, sizeof (struct ig_tclc_rf_entry));
+    GString *error   = g_string_new (NULL);
+    bool     valid   = true;
+
+    for (guint i = 0; i < ig_obj_array_len (&regfile->entries); i++) {
+        struct ig_rf_entry *entry    = IG_RF_ENTRY (ig_obj_array_index (&regfile->entries, i));
+        const char         *reg_name = "";
+        Tcl_Obj            *data     = ig_tclc_rf_entry_data (ig_tclc_interp_key_objs (interp), db, entry, &reg_name, error);
+
+        if (data == NULL) {
+            log_error ("RF", "Error while processing register \"%s/%s\" in regfile \"%s\" \n -- (%s) --\n%s",
+                       IG_OBJECT (entry)->name, reg_name, IG_OBJECT (regfile)->name, ig_obj_id (IG_OBJECT (entry)), error->str);
+            continue;
+        }
+
+        struct ig_tclc_rf_entry sort_entry = {.pos = i, .data = data};
+        Tcl_Obj                *address    = NULL;
+
+        Tcl_ListObjIndex (NULL, data, 1, &address);
+        Tcl_IncrRefCount (data);
+        g_array_append_val (entries, sort_entry);
+
+        if (valid && !ig_tclc_str_to_int (Tcl_GetString (address), &g_array_index (entries, struct ig_tclc_rf_entry, entries->len - 1).address)) {
+            tcl_error_msg (interp, "expected integer but got \"%s\"", Tcl_GetString (address));
+            valid = false;
+        }
+    }
+
+    Tcl_Obj *result = NULL;
+    if (valid) {
+        g_array_sort (entries, ig_tclc_rf_entry_cmp);
+
+        result = Tcl_NewListObj (0, NULL);
+        for (guint i = 0; i < entries->len; i++) {
+            Tcl_ListObjAppendElement (NULL, result, g_array_index (entries, struct ig_tclc_rf_entry, i).data);
+        }
+    }
+
+    for (guint i = 0; i < entries->len; i++) {
+        Tcl_DecrRefCount (g_array_index (entries, struct ig_tclc_rf_entry, i).data);
+    }
+    g_array_free (entries, true);
+    g_string_free (error, true);
+
+    return result;
+}
+
+/* module data as generated by ig::templates::preprocess::module_to_arraylist or NULL on error */
+static Tcl_Obj *ig_tclc_module_data (Tcl_Interp *interp, struct ig_lib_db *db, struct ig_module *mod)
+{
+    if (mod->resource) {
+        tcl_error_msg (interp, "Command is not applicable to a resource (\"%s\")", ig_obj_id (IG_OBJECT (mod)));
+        return NULL;
+    }
+
+    GHashTable *key_objs = ig_tclc_interp_key_objs (interp);
+    Tcl_Obj    *result   = Tcl_NewListObj (0, NULL);
+    GString    *str      = g_string_new (NULL);
+
+    ig_tclc_list_append_kv (key_objs, result, "name",   ig_tclc_attr_obj (IG_OBJECT (mod), "name", ""));
+    ig_tclc_list_append_kv (key_objs, result, "object", ig_tclc_new_object (db, IG_OBJECT (mod)));
+
+    /* ports */
+    Tcl_Obj *port_data = Tcl_NewListObj (0, NULL);
+    ig_tclc_list_append_kv (key_objs, result, "ports", port_data);
+    for (guint i = 0; i < ig_obj_array_len (&mod->ports); i++) {
+        struct ig_object *port      = PTR_TO_IG_OBJECT (ig_obj_array_index (&mod->ports, i));
+        Tcl_Obj          *size      = ig_tclc_attr_obj (port, "size", "");
+        Tcl_Obj          *direction = ig_tclc_attr_obj (port, "direction", "");
+        Tcl_Obj          *dimension = ig_tclc_attr_obj (port, "dimension", "");
+        Tcl_Obj          *bitrange  = NULL;
+        Tcl_Obj          *dim_range = NULL;
+
+        Tcl_IncrRefCount (dimension);
+        int dim_result = ig_tclc_obj_bitranges (interp, str, size, dimension, &bitrange, &dim_range);
+        Tcl_DecrRefCount (dimension);
+        if (dim_result != TCL_OK) {
+            g_string_free (str, true);
+            Tcl_DecrRefCount (size);
+            Tcl_DecrRefCount (direction);
+            Tcl_DecrRefCount (result);
+            return NULL;
+        }
+
+        const char *dir_str  = Tcl_GetString (direction);
+        const char *vlog_dir = "";
+        if (strcmp (dir_str, "input") == 0) {
+            vlog_dir = "input";
+        } else if (strcmp (dir_str, "output") == 0) {
+            vlog_dir = "output";
+        } else if (strcmp (dir_str, "bidirectional") == 0) {
+            vlog_dir = "inout";
+        }
+
+        Tcl_Obj *i_data = Tcl_NewListObj (0, NULL);
+        ig_tclc_list_append_kv (key_objs, i_data, "name",           ig_tclc_attr_obj (port, "name", ""));
+        ig_tclc_list_append_kv (key_objs, i_data, "object",         ig_tclc_new_object (db, port));
+        ig_tclc_list_append_kv (key_objs, i_data, "size",           size);
+        ig_tclc_list_append_kv (key_objs, i_data, "vlog.bitrange",  bitrange);
+        ig_tclc_list_append_kv (key_objs, i_data, "direction",      direction);
+        ig_tclc_list_append_kv (key_objs, i_data, "vlog.direction", Tcl_NewStringObj (vlog_dir, -1));
+        ig_tclc_list_append_kv (key_objs, i_data, "dimension",      dim_range);
+
+        Tcl_ListObjAppendElement (NULL, port_data, i_data);
+    }
+
+    /* parameters */
+    Tcl_Obj *param_data = Tcl_NewListObj (0, NULL);
+    ig_tclc_list_append_kv (key_objs, result, "parameters", param_data);
+    for (guint i = 0; i < ig_obj_array_len (&mod->params); i++) {
+        struct ig_object *param = PTR_TO_IG_OBJECT (ig_obj_array_index (&mod->params, i));
+        Tcl_Obj          *local = ig_tclc_attr_obj (param, "local", "false");
+
+        int local_bool = false;
+        if (Tcl_GetBooleanFromObj (NULL, local, &local_bool) != TCL_OK) local_bool = false;
+
+        Tcl_Obj *i_data = Tcl_NewListObj (0, NULL);
+        ig_tclc_list_append_kv (key_objs, i_data, "name",      ig_tclc_attr_obj (param, "name", ""));
+        ig_tclc_list_append_kv (key_objs, i_data, "object",    ig_tclc_new_object (db, param));
+        ig_tclc_list_append_kv (key_objs, i_data, "local",     local);
+        ig_tclc_list_append_kv (key_objs, i_data, "vlog.type", Tcl_NewStringObj ((local_bool ? "localparam" : "parameter"), -1));
+        ig_tclc_list_append_kv (key_objs, i_data, "value",     ig_tclc_attr_obj (param, "value", ""));
+
+        Tcl_ListObjAppendElement (NULL, param_data, i_data);
+    }
+
+    /* declarations */
+    Tcl_Obj *decl_data = Tcl_NewListObj (0, NULL);
+    ig_tclc_list_append_kv (key_objs, result, "declarations", decl_data);
+    for (guint i = 0; i < ig_obj_array_len (&mod->decls); i++) {
+        struct ig_object *decl        = PTR_TO_IG_OBJECT (ig_obj_array_index (&mod->decls, i));
+        Tcl_Obj          *size        = ig_tclc_attr_obj (decl, "size", "");
+        Tcl_Obj          *defaulttype = ig_tclc_attr_obj (decl, "default_type", "false");
+        Tcl_Obj          *dimension   = ig_tclc_attr_obj (decl, "dimension", "");
+        Tcl_Obj          *bitrange    = NULL;
+        Tcl_Obj          *dim_range   = NULL;
+
+        Tcl_IncrRefCount (dimension);
+        int dim_result = ig_tclc_obj_bitranges (interp, str, size, dimension, &bitrange, &dim_range);
+        Tcl_DecrRefCount (dimension);
+        if (dim_result != TCL_OK) {
+            g_string_free (str, true);
+            Tcl_DecrRefCount (size);
+            Tcl_DecrRefCount (defaulttype);
+            Tcl_DecrRefCount (result);
+            return NULL;
+        }
+
+        int default_bool = false;
+        if (Tcl_GetBooleanFromObj (NULL, defaulttype, &default_bool) != TCL_OK) default_bool = false;
+
+        Tcl_Obj *i_data = Tcl_NewListObj (0, NULL);
+        ig_tclc_list_append_kv (key_objs, i_data, "name",          ig_tclc_attr_obj (decl, "name", ""));
+        ig_tclc_list_append_kv (key_objs, i_data, "object",        ig_tclc_new_object (db, decl));
+        ig_tclc_list_append_kv (key_objs, i_data, "size",          size);
+        ig_tclc_list_append_kv (key_objs, i_data, "vlog.bitrange", bitrange);
+        ig_tclc_list_append_kv (key_objs, i_data, "defaulttype",   defaulttype);
+        ig_tclc_list_append_kv (key_objs, i_data, "vlog.type",     Tcl_NewStringObj ((default_bool ? "wire" : "reg"), -1));
+        ig_tclc_list_append_kv (key_objs, i_data, "dimension",     dim_range);
+
+        Tcl_ListObjAppendElement (NULL, decl_data, i_data);
+    }
+    g_string_free (str, true);
+
+    /* codesections */
+    Tcl_Obj *code_data = Tcl_NewListObj (0, NULL);
+    bool     align     = false;
+    for (guint i = 0; i < ig_obj_array_len (&mod->code); i++) {
+        struct ig_object *code     = PTR_TO_IG_OBJECT (ig_obj_array_index (&mod->code, i));
+        Tcl_Obj          *code_raw = ig_tclc_attr_obj (code, "code", "");
+        Tcl_Obj          *adapted  = ig_tclc_adapt_obj (interp, db, code, code_raw, "::ig::aux::adapt_codesection");
+
+        if (adapted == NULL) {
+            Tcl_DecrRefCount (code_raw);
+            Tcl_DecrRefCount (code_data);
+            Tcl_DecrRefCount (result);
+            return NULL;
+        }
+        if (ig_obj_attr_get (code, "align") != NULL) align = true;
+
+        Tcl_Obj *i_data = Tcl_NewListObj (0, NULL);
+        ig_tclc_list_append_kv (key_objs, i_data, "name",     ig_tclc_attr_obj (code, "name", ""));
+        ig_tclc_list_append_kv (key_objs, i_data, "object",   ig_tclc_new_object (db, code));
+        ig_tclc_list_append_kv (key_objs, i_data, "code_raw", code_raw);
+        ig_tclc_list_append_kv (key_objs, i_data, "code",     adapted);
+        Tcl_DecrRefCount (adapted);
+
+        Tcl_ListObjAppendElement (NULL, code_data, i_data);
+    }
+    Tcl_IncrRefCount (code_data);
+    if (align) {
+        Tcl_Obj *aligned = ig_tclc_call_proc (interp, "::ig::aux::align_codesections", code_data);
+        Tcl_DecrRefCount (code_data);
+        if (aligned == NULL) {
+            Tcl_DecrRefCount (result);
+            return NULL;
+        }
+        code_data = aligned;
+    }
+    ig_tclc_list_append_kv (key_objs, result, "code", code_data);
+    Tcl_DecrRefCount (code_data);
+
+    /* instances */
+    Tcl_Obj *inst_data = Tcl_NewListObj (0, NULL);
+    ig_tclc_list_append_kv (key_objs, result, "instances", inst_data);
+    for (guint i = 0; i < ig_obj_array_len (&mod->child_instances); i++) {
+        struct ig_instance *inst   = IG_INSTANCE (ig_obj_array_index (&mod->child_instances, i));
+        Tcl_Obj            *i_data = ig_tclc_instance_data (interp, db, inst);
+
+        if (i_data == NULL) {
+            Tcl_DecrRefCount (result);
+            return NULL;
+        }
+        Tcl_ListObjAppendElement (NULL, inst_data, i_data);
+    }
+
+    /* regfiles */
+    Tcl_Obj *regfile_data = Tcl_NewListObj (0, NULL);
+    ig_tclc_list_append_kv (key_objs, result, "regfiles", regfile_data);
+    for (guint i = 0; i < ig_obj_array_len (&mod->regfiles); i++) {
+        struct ig_rf_regfile *regfile = IG_RF_REGFILE (ig_obj_array_index (&mod->regfiles, i));
+        Tcl_Obj              *entries = ig_tclc_regfile_data (interp, db, regfile);
+
+        if (entries == NULL) {
+            Tcl_DecrRefCount (result);
+            return NULL;
+        }
+
+        Tcl_Obj *i_data = Tcl_NewListObj (0, NULL);
+        ig_tclc_list_append_kv (key_objs, i_data, "name",    ig_tclc_attr_obj (IG_OBJECT (regfile), "name", ""));
+        ig_tclc_list_append_kv (key_objs, i_data, "object",  ig_tclc_new_object (db, IG_OBJECT (regfile)));
+        ig_tclc_list_append_kv (key_objs, i_data, "entries", entries);
+
+        Tcl_ListObjAppendElement (NULL, regfile_data, i_data);
+    }
+
+    return result;
+}
+
+enum ig_tclc_object_data_version {
+    IG_TODV_INVALID,
+    IG_TODV_MODULE,
+    IG_TODV_INSTANCE,
+    IG_TODV_REGFILE,
+};
+
+/* TCLDOC
+##
+# @brief Return preprocessed data of a module, instance or regfile as used by templates.
+#
+# @param args Parsed command arguments:<br>
+# -of \<object-id\>
+#
+# @return Data as array-list, see @ref ig::templates::preprocess::module_to_arraylist,
+# @ref ig::templates::preprocess::instance_to_arraylist and @ref ig::templates::preprocess::regfile_to_arraylist.
+*/
+static int ig_tclc_object_data (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+    ig_tclc_connect_commit (db, 0);
+
+    /* command version */
+    const char                      *cmdname = Tcl_GetString (objv[0]);
+    enum ig_tclc_object_data_version version = IG_TODV_INVALID;
+
+    if (g_str_has_suffix (cmdname, "module_data")) {
+        version = IG_TODV_MODULE;
+    } else if (g_str_has_suffix (cmdname, "instance_data")) {
+        version = IG_TODV_INSTANCE;
+    } else if (g_str_has_suffix (cmdname, "regfile_data")) {
+        version = IG_TODV_REGFILE;
+    }
+
+    if (version == IG_TODV_INVALID) return tcl_error_msg (interp, "Internal Error - Invalid command version generated (%s:%d)", __FILE__, __LINE__);
+
+    Tcl_Obj *obj_arg = NULL;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_FUNC,     "-of",      (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&obj_arg, "object id", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) return result;
+
+    if (obj_arg == NULL) return tcl_error_msg (interp, "Flag -of <object> needs to be specified");
+
+    Tcl_Obj *retval = NULL;
+    if (version == IG_TODV_MODULE) {
+        struct ig_object *obj = ig_tclc_db_get_object_of_type (db, obj_arg, IG_OBJ_MODULE);
+        if (obj == NULL) return tcl_error_msg (interp, "Unable to find module-id \"%s\"", Tcl_GetString (obj_arg));
+        retval = ig_tclc_module_data (interp, db, IG_MODULE (obj));
+    } else if (version == IG_TODV_INSTANCE) {
+        struct ig_object *obj = ig_tclc_db_get_object_of_type (db, obj_arg, IG_OBJ_INSTANCE);
+        if (obj == NULL) return tcl_error_msg (interp, "Unable to find instance-id \"%s\"", Tcl_GetString (obj_arg));
+        retval = ig_tclc_instance_data (interp, db, IG_INSTANCE (obj));
+    } else if (version == IG_TODV_REGFILE) {
+        struct ig_object *obj = ig_tclc_db_get_object_of_type (db, obj_arg, IG_OBJ_REGFILE);
+        if (obj == NULL) return tcl_error_msg (interp, "Unable to get regfile \"%s\" from database", Tcl_GetString (obj_arg));
+        retval = ig_tclc_regfile_data (interp, db, IG_RF_REGFILE (obj));
+    }
+
+    if (retval == NULL) return TCL_ERROR;
+
+    Tcl_SetObjResult (interp, retval);
+    return TCL_OK;
+}
+
+enum ig_tclc_get_objs_of_obj_version {
+    IG_TOOOV_INVALID,
+    IG_TOOOV_PINS,
+    IG_TOOOV_PORTS,
+    IG_TOOOV_DECLS,
+    IG_TOOOV_ADJ,
+    IG_TOOOV_PARAMS,
+    IG_TOOOV_CODE,
+    IG_TOOOV_MODULES,
+    IG_TOOOV_INSTANCES,
+    IG_TOOOV_REGFILES,
+    IG_TOOOV_RF_ENTRIES,
+    IG_TOOOV_RF_REGS,
+    IG_TOOOV_NETS,
+    IG_TOOOV_GENERICS,
+};
+
+static enum ig_tclc_get_objs_of_obj_version ig_tclc_get_objs_of_obj_version_from_type (const char *type)
+{
+    enum ig_tclc_get_objs_of_obj_version version = IG_TOOOV_INVALID;
+    if (strcmp (type, "ports") == 0) {
+        version = IG_TOOOV_PORTS;
+    } else if (strcmp (type, "declarations") == 0) {
+        version = IG_TOOOV_DECLS;
+    } else if (strcmp (type, "parameters") == 0) {
+        version = IG_TOOOV_PARAMS;
+    } else if (strcmp (type, "codesections") == 0) {
+        version = IG_TOOOV_CODE;
+    } else if (strcmp (type, "pins") == 0) {
+        version = IG_TOOOV_PINS;
+    } else if (strcmp (type, "adjustments") == 0) {
+        version = IG_TOOOV_ADJ;
+    } else if (strcmp (type, "modules") == 0) {
+        version = IG_TOOOV_MODULES;
+    } else if (strcmp (type, "instances") == 0) {
+        version = IG_TOOOV_INSTANCES;
+    } else if (strcmp (type, "regfiles") == 0) {
+        version = IG_TOOOV_REGFILES;
+    } else if (strcmp (type, "regfile_entries") == 0) {
+        version = IG_TOOOV_RF_ENTRIES;
+    } else if (strcmp (type, "regfile_regs") == 0) {
+        version = IG_TOOOV_RF_REGS;
+    } else if (strcmp (type, "nets") == 0) {
+        version = IG_TOOOV_NETS;
+    } else if (strcmp (type, "generics") == 0) {
+        version = IG_TOOOV_GENERICS;
+    }
+
+    return version;
+}
+
+static enum ig_tclc_get_objs_of_obj_version ig_tclc_get_objs_of_obj_version_from_cmd (const char *cmdname)
+{
+    while (true) {
+        const char *cmdchomp = strstr (cmdname, "::");
+        if (cmdchomp == NULL) break;
+        cmdname = cmdchomp + 2;
+    }
+    if (strncmp (cmdname, "get_", 4) != 0) return IG_TOOOV_INVALID;
+
+    return ig_tclc_get_objs_of_obj_version_from_type (cmdname + 4);
+}
+
+/* create queued connections before queries of child objects that connections can create */
+static void ig_tclc_get_objs_of_obj_commit (struct ig_lib_db *db, enum ig_tclc_get_objs_of_obj_version version)
+{
+    if ((version == IG_TOOOV_PORTS) || (version == IG_TOOOV_DECLS) || (version == IG_TOOOV_PINS) || (version == IG_TOOOV_NETS)) {
+        ig_tclc_connect_commit (db, 0);
+    }
+}
+
+/*
+ * children of parent_arg for get_objs_of_obj version, collected in child_tmp if not an array of the parent,
+ * parent is set if child_array is an array of the parent object
+ */
+static int ig_tclc_obj_children (Tcl_Interp *interp, struct ig_lib_db *db, enum ig_tclc_get_objs_of_obj_version version,
+                                 Tcl_Obj *parent_arg, struct ig_obj_array **child_array, struct ig_obj_array *child_tmp,
+                                 struct ig_object **parent)
+{
+    const char *parent_name = Tcl_GetString (parent_arg);
+
+    *parent = NULL;
+
+    if ((version == IG_TOOOV_DECLS) || (version == IG_TOOOV_PORTS) || (version == IG_TOOOV_PARAMS)
+        || (version == IG_TOOOV_CODE) || (version == IG_TOOOV_INSTANCES) || (version == IG_TOOOV_REGFILES)) {
+        struct ig_module *mod = IG_MODULE (ig_tclc_db_get_object_of_type (db, parent_arg, IG_OBJ_MODULE));
+        if (mod == NULL) {
+            return tcl_error_msg (interp, "Unable to find \"%s\" in database", parent_name);
+        }
+
+        if (mod->resource) {
+            if ((version == IG_TOOOV_DECLS) || (version == IG_TOOOV_CODE)
+                || (version == IG_TOOOV_INSTANCES) || (version == IG_TOOOV_REGFILES)) {
+                return tcl_error_msg (interp, "Command is not applicable to a resource (\"%s\")", parent_name);
+            }
+        }
+
+        if (version == IG_TOOOV_DECLS) {
+            *child_array = &mod->decls;
         } else if (version == IG_TOOOV_PORTS) {
-            child_list = mod->ports->head;
+            *child_array = &mod->ports;
         } else if (version == IG_TOOOV_PARAMS) {
-            child_list = mod->params->head;
+            *child_array = &mod->params;
         } else if (version == IG_TOOOV_CODE) {
-            child_list = mod->code->head;
+            *child_array = &mod->code;
         } else if (version == IG_TOOOV_INSTANCES) {
-            child_list = mod->child_instances->head;
+            *child_array = &mod->child_instances;
         } else if (version == IG_TOOOV_REGFILES) {
-            child_list = mod->regfiles->head;
+            *child_array = &mod->regfiles;
         }
+        *parent = IG_OBJECT (mod);
     } else if ((version == IG_TOOOV_PINS) || (version == IG_TOOOV_ADJ) || (version == IG_TOOOV_MODULES)) {
-        struct ig_instance *inst = IG_INSTANCE (PTR_TO_IG_OBJECT (g_hash_table_lookup (db->instances_by_id, parent_name)));
+        struct ig_instance *inst = IG_INSTANCE (ig_tclc_db_get_object_of_type (db, parent_arg, IG_OBJ_INSTANCE));
         if (inst == NULL) return tcl_error_msg (interp, "Unable to find instance-id \"%s\"", parent_name);
 
         if (version == IG_TOOOV_PINS) {
-            child_list = inst->pins->head;
+            *child_array = &inst->pins;
+            *parent      = IG_OBJECT (inst);
         } else if (version == IG_TOOOV_ADJ) {
-            child_list = inst->adjustments->head;
+            *child_array = &inst->adjustments;
+            *parent      = IG_OBJECT (inst);
         } else if (version == IG_TOOOV_MODULES) {
-            child_list      = g_list_prepend (child_list, inst->module);
-            child_list_free = true;
+            ig_obj_array_add (NULL, child_tmp, inst->module);
+            *child_array = child_tmp;
         }
     } else if (version == IG_TOOOV_RF_ENTRIES) {
-        struct ig_object *obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, parent_name));
+        struct ig_object *obj = ig_tclc_get_object (db, parent_arg);
 
         if ((obj == NULL) || (obj->type != IG_OBJ_REGFILE)) {
             return tcl_error_msg (interp, "Unable to get regfile \"%s\" from database", parent_name);
         }
 
         struct ig_rf_regfile *regfile = IG_RF_REGFILE (obj);
-        child_list = regfile->entries->head;
+        *child_array = &regfile->entries;
+        *parent      = obj;
     } else if (version == IG_TOOOV_RF_REGS) {
-        struct ig_object *obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, parent_name));
+        struct ig_object *obj = ig_tclc_get_object (db, parent_arg);
 
         if ((obj == NULL) || (obj->type != IG_OBJ_REGFILE_ENTRY)) {
             return tcl_error_msg (interp, "Unable to get regfile-entry \"%s\" from database", parent_name);
         }
 
         struct ig_rf_entry *entry = IG_RF_ENTRY (obj);
-        child_list = entry->regs->head;
+        *child_array = &entry->regs;
+        *parent      = obj;
     } else if (version == IG_TOOOV_NETS) {
-        struct ig_object *obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, parent_name));
+        struct ig_object *obj = ig_tclc_get_object (db, parent_arg);
         if (obj == NULL) {
             return tcl_error_msg (interp, "Unable to get object \"%s\" from database for net lookup", parent_name);
         }
 
-        struct ig_net *obj_net = NULL;
+        struct ig_net *obj_net = NULL;
+
+        if (obj->type == IG_OBJ_PORT) {
+            obj_net = IG_PORT (obj)->net;
+        } else if (obj->type == IG_OBJ_PIN) {
+            obj_net = IG_PIN (obj)->net;
+        } else if (obj->type == IG_OBJ_DECLARATION) {
+            obj_net = IG_DECL (obj)->net;
+        } else {
+            return tcl_error_msg (interp, "Object \"%s\" does not have a net", parent_name);
+        }
+        if (obj_net != NULL) {
+            ig_obj_array_add (NULL, child_tmp, obj_net);
+        }
+
+        *child_array = child_tmp;
+    } else if (version == IG_TOOOV_GENERICS) {
+        struct ig_object *obj = ig_tclc_get_object (db, parent_arg);
+        if (obj == NULL) {
+            return tcl_error_msg (interp, "Unable to get object \"%s\" from database for generic lookup", parent_name);
+        }
+
+        struct ig_generic *obj_generic = NULL;
+
+        if (obj->type == IG_OBJ_PARAMETER) {
+            obj_generic = IG_PARAM (obj)->generic;
+        } else if (obj->type == IG_OBJ_ADJUSTMENT) {
+            obj_generic = IG_ADJUSTMENT (obj)->generic;
+        } else {
+            return tcl_error_msg (interp, "Object \"%s\" does not belong to a generic", parent_name);
+        }
+        if (obj_generic != NULL) {
+            ig_obj_array_add (NULL, child_tmp, obj_generic);
+        }
+
+        *child_array = child_tmp;
+    }
+
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Return child object(s) of given parent.
+#
+# @param args Parsed command arguments:<br>
+# (-name \<child-name\><br>
+# |-all)<br>
+# -of \<parent-object-id\>
+#
+# @return Object-ID(s) of child object(s) or an error
+*/
+static int ig_tclc_get_objs_of_obj (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+
+    /* command version */
+    const char                          *cmdname = Tcl_GetString (objv[0]);
+    enum ig_tclc_get_objs_of_obj_version version = ig_tclc_get_objs_of_obj_version_from_cmd (cmdname);
+
+    if (version == IG_TOOOV_INVALID) return tcl_error_msg (interp, "Internal Error - Invalid command version generated (%s:%d)", __FILE__, __LINE__);
+    ig_tclc_get_objs_of_obj_commit (db, version);
+
+    /* arg parsing */
+    int int_true  = true;
+    int int_false = false;
+
+    int      all        = int_false;
+    Tcl_Obj *parent_arg = NULL;
+    char    *child_name = NULL;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_CONSTANT, "-all",    GINT_TO_POINTER (int_true), (void *)&all,         "return all objects", NULL},
+        {TCL_ARGV_STRING,   "-name",   NULL,                       (void *)&child_name,  "object name",        NULL},
+        {TCL_ARGV_FUNC,     "-of",     (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&parent_arg, "parent object", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) return result;
+
+    const char *parent_name = (parent_arg == NULL ? NULL : Tcl_GetString (parent_arg));
+
+    /* sanity checks */
+    if (parent_name == NULL) {
+        if ((version == IG_TOOOV_DECLS) || (version == IG_TOOOV_PORTS) || (version == IG_TOOOV_PARAMS) || (version == IG_TOOOV_CODE)) {
+            return tcl_error_msg (interp, "Flag -of <module> needs to be specified");
+        } else if ((version == IG_TOOOV_PINS) || (version == IG_TOOOV_ADJ)) {
+            return tcl_error_msg (interp, "Flag -of <instance> needs to be specified");
+        } else if (version == IG_TOOOV_RF_ENTRIES) {
+            return tcl_error_msg (interp, "Flag -of <regfile> needs to be specified");
+        } else if (version == IG_TOOOV_RF_REGS) {
+            return tcl_error_msg (interp, "Flag -of <regfile-entry> needs to be specified");
+        }
+    }
+
+    if ((version == IG_TOOOV_CODE) && (child_name != NULL)) {
+        return tcl_error_msg (interp, "Invalid to specify name for code sections");
+    }
+
+    if (((version == IG_TOOOV_NETS) || (version == IG_TOOOV_GENERICS)) && (child_name != NULL) && (parent_name != NULL)) {
+        return tcl_error_msg (interp, "Invalid to specify -name and -of");
+    }
+
+    if (all && (child_name != NULL)) {
+        return tcl_error_msg (interp, "Invalid to specify name and -all");
+    }
+
+    if (child_name == NULL) {
+        all = true;
+    }
+
+    /* child list: either an array of the parent object, a view of a database index or collected in child_tmp */
+    struct ig_obj_array *child_array  = NULL;
+    struct ig_obj_array  child_tmp    = {NULL, 0, 0};
+    struct ig_obj_array  child_view   = {NULL, 0, 0};
+    struct ig_object    *child_parent = NULL;
 
-        if (obj->type == IG_OBJ_PORT) {
-            obj_net = IG_PORT (obj)->net;
-        } else if (obj->type == IG_OBJ_PIN) {
-            obj_net = IG_PIN (obj)->net;
-        } else if (obj->type == IG_OBJ_DECLARATION) {
-            obj_net = IG_DECL (obj)->net;
+    if ((version == IG_TOOOV_INSTANCES) && (parent_name == NULL)) {
+        if (all) {
+            child_array = ig_tclc_obj_array_view (&child_view, db->instances_ordered);
         } else {
-            return tcl_error_msg (interp, "Object \"%s\" does not have a net", parent_name);
+            struct ig_object *child = PTR_TO_IG_OBJECT (ig_lib_db_name_lookup (db->instances_by_name, child_name));
+            if (child != NULL) {
+                ig_obj_array_add (NULL, &child_tmp, child);
+            }
+            child_array = &child_tmp;
         }
-        if (obj_net != NULL) {
-            child_list = g_list_prepend (child_list, obj_net);
+    } else if ((version == IG_TOOOV_MODULES) && (parent_name == NULL)) {
+        if (all) {
+            child_array = ig_tclc_obj_array_view (&child_view, db->modules_ordered);
+        } else {
+            struct ig_object *child = PTR_TO_IG_OBJECT (ig_lib_db_name_lookup (db->modules_by_name, child_name));
+            if (child != NULL) {
+                ig_obj_array_add (NULL, &child_tmp, child);
+            }
+            child_array = &child_tmp;
         }
-
-        child_list_free = true;
-    } else if (version == IG_TOOOV_GENERICS) {
-        struct ig_object *obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, parent_name));
-        if (obj == NULL) {
-            return tcl_error_msg (interp, "Unable to get object \"%s\" from database for generic lookup", parent_name);
+    } else if ((version == IG_TOOOV_REGFILES) && (parent_name == NULL)) {
+        if (all) {
+            child_array = ig_tclc_obj_array_view (&child_view, db->regfiles_ordered);
+        } else {
+            struct ig_object *child = PTR_TO_IG_OBJECT (ig_lib_db_name_lookup (db->regfiles_by_name, child_name));
+            if (child != NULL) {
+                ig_obj_array_add (NULL, &child_tmp, child);
+            }
+            child_array = &child_tmp;
         }
-
-        struct ig_generic *obj_generic = NULL;
-
-        if (obj->type == IG_OBJ_PARAMETER) {
-            obj_generic = IG_PARAM (obj)->generic;
-        } else if (obj->type == IG_OBJ_ADJUSTMENT) {
-            obj_generic = IG_ADJUSTMENT (obj)->generic;
+    } else if ((version == IG_TOOOV_NETS) && (parent_name == NULL)) {
+        if (all) {
+            child_array = ig_tclc_obj_array_view (&child_view, db->nets_ordered);
         } else {
-            return tcl_error_msg (interp, "Object \"%s\" does not belong to a generic", parent_name);
+            struct ig_object *child = PTR_TO_IG_OBJECT (ig_lib_db_name_lookup (db->nets_by_name, child_name));
+            if (child != NULL) {
+                ig_obj_array_add (NULL, &child_tmp, child);
+            }
+            child_array = &child_tmp;
         }
-        if (obj_generic != NULL) {
-            child_list = g_list_prepend (child_list, obj_generic);
+    } else if ((version == IG_TOOOV_GENERICS) && (parent_name == NULL)) {
+        if (all) {
+            child_array = ig_tclc_obj_array_view (&child_view, db->generics_ordered);
+        } else {
+            struct ig_object *child = PTR_TO_IG_OBJECT (ig_lib_db_name_lookup (db->generics_by_name, child_name));
+            if (child != NULL) {
+                ig_obj_array_add (NULL, &child_tmp, child);
+            }
+            child_array = &child_tmp;
         }
+    } else if (ig_tclc_obj_children (interp, db, version, parent_arg, &child_array, &child_tmp, &child_parent) != TCL_OK) {
+        return TCL_ERROR;
+    }
 
-        child_list_free = true;
+    /* all children of a parent array: shared list */
+    if (all && (child_parent != NULL) && (child_parent->handle != 0)) {
+        Tcl_SetObjResult (interp, ig_tclc_child_list (ig_tclc_interp_cache (interp), db, child_parent, child_array));
+        return TCL_OK;
     }
 
     /* generate result */
@@ -876,26 +2189,26 @@ static int ig_tclc_get_objs_of_obj (ClientData clientdata, Tcl_Interp *interp, i
         retval = Tcl_NewListObj (0, NULL);
     }
 
-    for (GList *li = child_list; li != NULL; li = li->next) {
-        struct ig_object *i_obj  = PTR_TO_IG_OBJECT (li->data);
+    struct ig_tclc_obj_cache *cache = ig_tclc_interp_cache (interp);
+
+    guint n_children = (child_array == NULL ? 0 : ig_obj_array_len (child_array));
+    for (guint i = 0; i < n_children; i++) {
+        struct ig_object *i_obj  = PTR_TO_IG_OBJECT (ig_obj_array_index (child_array, i));
         const char       *i_name = i_obj->name;
 
         if (all) {
-            Tcl_Obj *t_obj = Tcl_NewStringObj (i_obj->id, -1);
+            Tcl_Obj *t_obj = ig_tclc_shared_object (cache, db, i_obj);
             Tcl_ListObjAppendElement (interp, retval, t_obj);
         } else {
             if (strcmp (i_name, child_name) == 0) {
-                Tcl_SetObjResult (interp, Tcl_NewStringObj (i_obj->id, -1));
-                if (child_list_free) g_list_free (child_list);
+                Tcl_SetObjResult (interp, ig_tclc_shared_object (cache, db, i_obj));
+                ig_obj_array_release (NULL, &child_tmp);
                 return TCL_OK;
             }
         }
     }
 
-    if (child_list_free) {
-        g_list_free (child_list);
-        child_list = NULL;
-    }
+    ig_obj_array_release (NULL, &child_tmp);
 
     if (!all) {
         if (child_name != NULL) return tcl_error_msg (interp, "Nothing found for \"%s\"", child_name);
@@ -910,6 +2223,98 @@ static int ig_tclc_get_objs_of_obj (ClientData clientdata, Tcl_Interp *interp, i
 
 
 
+/* TCLDOC
+##
+# @brief Get value of an object-attribute without option parsing.
+#
+# @param args \<object-id\> \<attribute-name\> [\<default-value\>]
+#
+# @return Value of the attribute or the default value if the attribute does not exist.
+#
+# Equivalent to @ref ig::db::get_attribute with -object, -attribute and -default.
+*/
+static int ig_tclc_attr (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+    if ((objc != 3) && (objc != 4)) {
+        Tcl_WrongNumArgs (interp, 1, objv, "object attribute ?default?");
+        return TCL_ERROR;
+    }
+
+    struct ig_object *obj = ig_tclc_get_object_commit (db, objv[1]);
+    if (obj == NULL) return tcl_error_msg (interp, "Unknown object \"%s\"", Tcl_GetString (objv[1]));
+
+    const char         *attr_name = Tcl_GetString (objv[2]);
+    struct ig_attribute attr;
+    if (ig_obj_attr_get_typed (obj, attr_name, &attr)) {
+        Tcl_SetObjResult (interp, ig_tclc_attr_value_obj (&attr));
+        return TCL_OK;
+    }
+
+    if (objc == 4) {
+        Tcl_SetObjResult (interp, objv[3]);
+        return TCL_OK;
+    }
+
+    return tcl_error_msg (interp, "Could not get attribute \"%s\" of object \"%s\"", attr_name, Tcl_GetString (objv[1]));
+}
+
+/* TCLDOC
+##
+# @brief Return all child objects of given parent without option parsing.
+#
+# @param args \<type\> \<parent-object-id\><br>
+# type is one of modules, instances, ports, parameters, declarations, codesections, pins, adjustments,
+# regfiles, regfile_entries, regfile_regs, nets or generics.
+#
+# @return Object-IDs of child objects.
+#
+# Equivalent to the corresponding ig::db::get_\<type\> -all -of \<parent-object-id\>.
+*/
+static int ig_tclc_children (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+    if (objc != 3) {
+        Tcl_WrongNumArgs (interp, 1, objv, "type object");
+        return TCL_ERROR;
+    }
+
+    enum ig_tclc_get_objs_of_obj_version version = ig_tclc_get_objs_of_obj_version_from_type (Tcl_GetString (objv[1]));
+    if (version == IG_TOOOV_INVALID) return tcl_error_msg (interp, "Invalid child type \"%s\"", Tcl_GetString (objv[1]));
+    ig_tclc_get_objs_of_obj_commit (db, version);
+
+    struct ig_obj_array *child_array  = NULL;
+    struct ig_obj_array  child_tmp    = {NULL, 0, 0};
+    struct ig_object    *child_parent = NULL;
+
+    if (ig_tclc_obj_children (interp, db, version, objv[2], &child_array, &child_tmp, &child_parent) != TCL_OK) {
+        ig_obj_array_release (NULL, &child_tmp);
+        return TCL_ERROR;
+    }
+
+    if ((child_parent != NULL) && (child_parent->handle != 0)) {
+        Tcl_SetObjResult (interp, ig_tclc_child_list (ig_tclc_interp_cache (interp), db, child_parent, child_array));
+        return TCL_OK;
+    }
+
+    struct ig_tclc_obj_cache *cache      = ig_tclc_interp_cache (interp);
+    guint                     n_children = (child_array == NULL ? 0 : ig_obj_array_len (child_array));
+    Tcl_Obj                 **children   = g_new (Tcl_Obj *, MAX (n_children, 1));
+    for (guint i = 0; i < n_children; i++) {
+        children[i] = ig_tclc_shared_object (cache, db, PTR_TO_IG_OBJECT (ig_obj_array_index (child_array, i)));
+    }
+    Tcl_SetObjResult (interp, Tcl_NewListObj (n_children, children));
+
+    g_free (children);
+    ig_obj_array_release (NULL, &child_tmp);
+
+    return TCL_OK;
+}
+
 enum ig_tclc_get_netgen_objects_version {
     IG_TNGOV_INVALID,
     IG_TNGOV_NET,
@@ -953,12 +2358,13 @@ static int ig_tclc_get_netgen_objects (ClientData clientdata, Tcl_Interp *interp
     enum ig_tclc_get_netgen_objects_version version = ig_tclc_get_netgen_objects_version_from_cmd (cmdname);
 
     if (version == IG_TNGOV_INVALID) return tcl_error_msg (interp, "Internal Error - Invalid command version generated (%s:%d)", __FILE__, __LINE__);
+    if (version == IG_TNGOV_NET) ig_tclc_connect_commit (db, 0);
 
     /* arg parsing */
-    char *parent_name = NULL;
+    Tcl_Obj *parent_arg = NULL;
 
     Tcl_ArgvInfo arg_table [] = {
-        {TCL_ARGV_STRING, "-of", NULL, (void *)&parent_name, "parent object", NULL},
+        {TCL_ARGV_FUNC, "-of", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&parent_arg, "parent object", NULL},
 
         TCL_ARGV_AUTO_HELP,
         TCL_ARGV_TABLE_END
@@ -967,6 +2373,8 @@ static int ig_tclc_get_netgen_objects (ClientData clientdata, Tcl_Interp *interp
     int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
     if (result != TCL_OK) return result;
 
+    const char *parent_name = (parent_arg == NULL ? NULL : Tcl_GetString (parent_arg));
+
     /* sanity checks */
     if (parent_name == NULL) {
         return tcl_error_msg (interp, "Flag -of <parent> needs to be specified");
@@ -974,28 +2382,28 @@ static int ig_tclc_get_netgen_objects (ClientData clientdata, Tcl_Interp *interp
 
     struct ig_object *obj = NULL;
     if (version == IG_TNGOV_NET) {
-        obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->nets_by_id, parent_name));
+        obj = ig_tclc_db_get_object_of_type (db, parent_arg, IG_OBJ_NET);
     } else if (version == IG_TNGOV_GENERIC) {
-        obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->generics_by_id, parent_name));
+        obj = ig_tclc_db_get_object_of_type (db, parent_arg, IG_OBJ_GENERIC);
     }
 
     if (obj == NULL) {
         return tcl_error_msg (interp, "Unable to get object \"%s\" from database", parent_name);
     }
 
-    GList *children = NULL;
+    struct ig_obj_array *children = NULL;
     if (version == IG_TNGOV_NET) {
-        children = IG_NET (obj)->objects->head;
+        children = &IG_NET (obj)->objects;
     } else if (version == IG_TNGOV_GENERIC) {
-        children = IG_GENERIC (obj)->objects->head;
+        children = &IG_GENERIC (obj)->objects;
     }
 
     Tcl_Obj *retval = Tcl_NewListObj (0, NULL);
 
-    for (GList *li = children; li != NULL; li = li->next) {
-        struct ig_object *i_obj = PTR_TO_IG_OBJECT (li->data);
+    for (guint i = 0; i < ig_obj_array_len (children); i++) {
+        struct ig_object *i_obj = PTR_TO_IG_OBJECT (ig_obj_array_index (children, i));
 
-        Tcl_Obj *t_obj = Tcl_NewStringObj (i_obj->id, -1);
+        Tcl_Obj *t_obj = ig_tclc_new_object (db, i_obj);
         Tcl_ListObjAppendElement (interp, retval, t_obj);
     }
 
@@ -1004,6 +2412,193 @@ static int ig_tclc_get_netgen_objects (ClientData clientdata, Tcl_Interp *interp
     return TCL_OK;
 }
 
+/* TCLDOC
+##
+# @brief Return local port/declaration of a signal in a module.
+#
+# @param args Parsed command arguments:<br>
+# -of \<module-object-id\><br>
+# (-name \<signal-name\> | -local-names)
+#
+# @return Object-ID of the port/declaration of the signal, dict of all signal names and their local names for -local-names or an error
+#
+# Ports take precedence over declarations of the same signal.
+# The -local-names dict is the replacement map for adapting signal names in code of the module.
+*/
+static int ig_tclc_get_signal (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+    ig_tclc_connect_commit (db, 0);
+
+    Tcl_Obj *mod_arg     = NULL;
+    char    *signame     = NULL;
+    gint     local_names = 0;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_FUNC,     "-of",          (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&mod_arg,     "module object", NULL},
+        {TCL_ARGV_STRING,   "-name",        NULL,                                              (void *)&signame,     "signal name", NULL},
+        {TCL_ARGV_CONSTANT, "-local-names", GINT_TO_POINTER (1),                               (void *)&local_names, "return dict of signal names and local names", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) return result;
+
+    if (mod_arg == NULL) {
+        return tcl_error_msg (interp, "Flag -of <module> needs to be specified");
+    }
+    if ((signame == NULL) == (local_names == 0)) {
+        return tcl_error_msg (interp, "Exactly one of -name <signal> or -local-names needs to be specified");
+    }
+
+    struct ig_module *mod = IG_MODULE (ig_tclc_db_get_object_of_type (db, mod_arg, IG_OBJ_MODULE));
+    if (mod == NULL) {
+        return tcl_error_msg (interp, "Unable to get module \"%s\" from database", Tcl_GetString (mod_arg));
+    }
+
+    if (signame != NULL) {
+        struct ig_object *obj = ig_lib_module_signal (db, mod, signame);
+        if (obj == NULL) {
+            return tcl_error_msg (interp, "Nothing found for \"%s\"", signame);
+        }
+        Tcl_SetObjResult (interp, ig_tclc_new_object (db, obj));
+        return TCL_OK;
+    }
+
+    /* ports before declarations, each signal once - same order as a scan of the module */
+    Tcl_Obj             *retval    = Tcl_NewDictObj ();
+    struct ig_obj_array *arrays[2] = {&mod->ports, &mod->decls};
+    for (int a = 0; a < 2; a++) {
+        for (guint i = 0; i < ig_obj_array_len (arrays[a]); i++) {
+            struct ig_object *i_obj     = PTR_TO_IG_OBJECT (ig_obj_array_index (arrays[a], i));
+            const char       *i_signame = ig_obj_attr_get (i_obj, "signal");
+
+            if (i_signame == NULL) continue;
+            if (ig_lib_module_signal (db, mod, i_signame) != i_obj) continue;
+
+            Tcl_DictObjPut (interp, retval, Tcl_NewStringObj (i_signame, -1), Tcl_NewStringObj (i_obj->name, -1));
+        }
+    }
+
+    Tcl_SetObjResult (interp, retval);
+
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Evaluate the effective value of a parameter or a value in the scope of a module.
+#
+# @param args Parsed command arguments:<br>
+# (-parameter \<parameter/generic-object-id\> [-instance \<instance-object-id\>] |<br>
+#  -value \<value\> [-of \<module/instance-object-id\>])
+#
+# @return List of form {success value size} like @ref ig::vlog::parse_value or an error
+#
+# Parameter names are resolved in the given module, values of parameters follow the adjustments
+# of the given instance or the default instance of the module.
+# Generics need an instance to select the parameter of the instance's module.
+# Parameter values are memoized until parameters or the hierarchy change.
+*/
+static int ig_tclc_eval_parameter (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+
+    Tcl_Obj *param_arg = NULL;
+    Tcl_Obj *inst_arg  = NULL;
+    Tcl_Obj *scope_arg = NULL;
+    char    *value     = NULL;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_FUNC,   "-parameter", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&param_arg, "parameter or generic object", NULL},
+        {TCL_ARGV_FUNC,   "-instance",  (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&inst_arg,  "instance object to evaluate parameter for", NULL},
+        {TCL_ARGV_STRING, "-value",     NULL,                                              (void *)&value,     "value to evaluate", NULL},
+        {TCL_ARGV_FUNC,   "-of",        (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&scope_arg, "module or instance object to resolve parameters of value in", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) return result;
+
+    if ((param_arg == NULL) == (value == NULL)) {
+        return tcl_error_msg (interp, "Exactly one of -parameter <parameter> or -value <value> needs to be specified");
+    }
+    if ((param_arg == NULL) && (inst_arg != NULL)) {
+        return tcl_error_msg (interp, "Flag -instance <instance> is only valid with -parameter");
+    }
+    if ((value == NULL) && (scope_arg != NULL)) {
+        return tcl_error_msg (interp, "Flag -of <module> is only valid with -value");
+    }
+
+    struct ig_instance *inst = NULL;
+    if (inst_arg != NULL) {
+        inst = IG_INSTANCE (ig_tclc_db_get_object_of_type (db, inst_arg, IG_OBJ_INSTANCE));
+        if (inst == NULL) {
+            return tcl_error_msg (interp, "Unable to get instance \"%s\" from database", Tcl_GetString (inst_arg));
+        }
+    }
+
+    struct ig_eval_value eval;
+
+    if (param_arg != NULL) {
+        struct ig_object *obj = ig_tclc_get_object (db, param_arg);
+
+        if ((obj != NULL) && (obj->type == IG_OBJ_PARAMETER)) {
+            if ((inst != NULL) && (inst->module != IG_PARAM (obj)->parent)) {
+                return tcl_error_msg (interp, "Instance \"%s\" is no instance of the module of parameter \"%s\"", Tcl_GetString (inst_arg), Tcl_GetString (param_arg));
+            }
+            ig_eval_parameter (db, IG_PARAM (obj), inst, &eval);
+        } else if ((obj != NULL) && (obj->type == IG_OBJ_GENERIC)) {
+            if (inst == NULL) {
+                return tcl_error_msg (interp, "Flag -instance <instance> needs to be specified for generic \"%s\"", Tcl_GetString (param_arg));
+            }
+            ig_eval_generic (db, IG_GENERIC (obj), inst, &eval);
+        } else {
+            return tcl_error_msg (interp, "Unable to get parameter or generic \"%s\" from database", Tcl_GetString (param_arg));
+        }
+    } else {
+        struct ig_module *mod = NULL;
+
+        if (scope_arg != NULL) {
+            struct ig_object *obj = ig_tclc_get_object (db, scope_arg);
+
+            if ((obj != NULL) && (obj->type == IG_OBJ_MODULE)) {
+                mod = IG_MODULE (obj);
+            } else if ((obj != NULL) && (obj->type == IG_OBJ_INSTANCE)) {
+                inst = IG_INSTANCE (obj);
+                mod  = inst->module;
+            } else {
+                return tcl_error_msg (interp, "Unable to get module or instance \"%s\" from database", Tcl_GetString (scope_arg));
+            }
+        }
+
+        ig_eval_value (db, value, mod, inst, &eval);
+    }
+
+    Tcl_Obj *retval = Tcl_NewListObj (0, NULL);
+    Tcl_ListObjAppendElement (interp, retval, Tcl_NewBooleanObj (eval.valid));
+    if (eval.unsigned64 && (eval.value < 0)) {
+        char value_string[24];
+        g_snprintf (value_string, sizeof (value_string), "%" G_GUINT64_FORMAT, (guint64)eval.value);
+        Tcl_ListObjAppendElement (interp, retval, Tcl_NewStringObj (value_string, -1));
+    } else {
+        Tcl_ListObjAppendElement (interp, retval, Tcl_NewWideIntObj (eval.value));
+    }
+    Tcl_ListObjAppendElement (interp, retval, Tcl_NewIntObj (eval.size));
+
+    Tcl_SetObjResult (interp, retval);
+
+    return TCL_OK;
+}
+
 
 static void ig_tclc_connection_parse (const char *input, GString *id, GString *net, bool *adapt, bool *inv_ptr)
 {
@@ -1029,39 +2624,204 @@ static void ig_tclc_connection_parse (const char *input, GString *id, GString *n
         return;
     }
 
-    g_string_truncate (id, (split_net - input));
-    g_string_assign (net, split_net + 1);
+    g_string_truncate (id, (split_net - input));
+    g_string_assign (net, split_net + 1);
+
+    if (net->len == 0) {
+        *adapt = true;
+        log_debug ("TCnPr", "got only object: %s", input);
+        return;
+    }
+
+    if (net->str[net->len - 1] == '!') {
+        *adapt = true;
+        g_string_truncate (net, net->len - 1);
+        log_debug ("TCnPr", "got object + net + adapt: %s -> %s", id->str, net->str);
+    } else {
+        *adapt = false;
+        log_debug ("TCnPr", "got object + net + force: %s -> %s", id->str, net->str);
+    }
+
+    /* checks */
+    ig_tclc_check_name_and_warn (id->str);
+    ig_tclc_check_name_and_warn (net->str);
+}
+
+static void ig_tclc_check_name_and_warn (const char *name)
+{
+    if (name == NULL) return;
+
+    const char unwanted[] = {'"', '\'', '!', ':', '$', ' ', '{', '}', '[', ']', '<', '>', '(', ')', 0};
+    for (const char *cp = &(unwanted[0]); *cp != 0; cp++) {
+        if (strchr (name, *cp) != NULL) {
+            log_warn ("TChkN", "Got identifier \"%s\" containing probably unwanted character \"%c\".", name, *cp);
+        }
+    }
+}
+
+static struct ig_tclc_connect_attrs *ig_tclc_connect_attrs_new (const char *name, bool bundle, const char *size, GList *size_list, Tcl_Obj *attrs, Tcl_Obj *net_attrs)
+{
+    struct ig_tclc_connect_attrs *cattrs = g_slice_new0 (struct ig_tclc_connect_attrs);
+
+    cattrs->name   = g_strdup (name);
+    cattrs->bundle = bundle;
+    cattrs->size   = g_strdup (size);
+
+    /* a single size is used for all signals */
+    if ((size_list != NULL) && (size_list->next != NULL)) {
+        cattrs->sizes = g_ptr_array_new_with_free_func (g_free);
+        for (GList *li = size_list; li != NULL; li = li->next) {
+            g_ptr_array_add (cattrs->sizes, g_strdup ((const char *)li->data));
+        }
+    }
+
+    if (attrs != NULL) {
+        cattrs->attrs = attrs;
+        Tcl_IncrRefCount (attrs);
+    }
+    if (net_attrs != NULL) {
+        cattrs->net_attrs = net_attrs;
+        Tcl_IncrRefCount (net_attrs);
+    }
+
+    return cattrs;
+}
+
+static void ig_tclc_connect_attrs_free (struct ig_tclc_connect_attrs *cattrs)
+{
+    if (cattrs == NULL) return;
+
+    g_free (cattrs->name);
+    g_free (cattrs->size);
+    if (cattrs->sizes != NULL) g_ptr_array_free (cattrs->sizes, true);
+    if (cattrs->attrs != NULL) Tcl_DecrRefCount (cattrs->attrs);
+    if (cattrs->net_attrs != NULL) Tcl_DecrRefCount (cattrs->net_attrs);
+
+    g_slice_free (struct ig_tclc_connect_attrs, cattrs);
+}
+
+/* set size and attributes of created nets and their objects */
+static void ig_tclc_connect_attrs_apply (struct ig_tclc_connect_attrs *cattrs, GList *nets, GString *error_msg)
+{
+    int       n_attrs     = 0;
+    Tcl_Obj **attrs       = NULL;
+    int       n_net_attrs = 0;
+    Tcl_Obj **net_attrs   = NULL;
+    bool      result      = true;
+
+    if (cattrs->attrs != NULL) Tcl_ListObjGetElements (NULL, cattrs->attrs, &n_attrs, &attrs);
+    if (cattrs->net_attrs != NULL) Tcl_ListObjGetElements (NULL, cattrs->net_attrs, &n_net_attrs, &net_attrs);
+
+    guint i_sig = 0;
+    for (GList *li = nets; li != NULL; li = li->next, i_sig++) {
+        struct ig_net *net  = (struct ig_net *)li->data;
+        const char    *size = cattrs->size;
+        if (cattrs->sizes != NULL) {
+            size = (const char *)g_ptr_array_index (cattrs->sizes, i_sig);
+        }
+
+        ig_obj_attr_set (IG_OBJECT (net), "size", size, true);
+        for (guint i = 0; i < ig_obj_array_len (&net->objects); i++) {
+            struct ig_object *i_obj = PTR_TO_IG_OBJECT (ig_obj_array_index (&net->objects, i));
+
+            ig_obj_attr_set (i_obj, "size", size, true);
+        }
+
+        for (int i = 0; i + 1 < n_attrs; i += 2) {
+            const char *attr_name = Tcl_GetString (attrs[i]);
+
+            result &= ig_tclc_attr_set_obj (IG_OBJECT (net), attr_name, attrs[i+1]);
+            for (guint j = 0; j < ig_obj_array_len (&net->objects); j++) {
+                struct ig_object *j_obj = PTR_TO_IG_OBJECT (ig_obj_array_index (&net->objects, j));
+
+                result &= ig_tclc_attr_set_obj (j_obj, attr_name, attrs[i+1]);
+            }
+        }
+
+        for (int i = 0; i + 1 < n_net_attrs; i += 2) {
+            result &= ig_tclc_attr_set_obj (IG_OBJECT (net), Tcl_GetString (net_attrs[i]), net_attrs[i+1]);
+        }
+    }
+
+    if (!result && (error_msg->len == 0)) {
+        g_string_printf (error_msg, "Signal%s \"%s\", error while setting attributes", (cattrs->bundle ? " bundle" : ""), cattrs->name);
+    }
+}
+
+/* commit callback of deferred connections: keeps the first error message with the origin of the connection */
+static void ig_tclc_connect_commit_nets (struct ig_lib_db *db, GList *nets, gpointer data, gpointer commit_data)
+{
+    struct ig_tclc_connect_attrs *cattrs    = (struct ig_tclc_connect_attrs *)data;
+    GString                      *error_msg = (GString *)commit_data;
+    bool                          first     = (error_msg->len == 0);
+
+    if (nets == NULL) {
+        if (first) {
+            g_string_printf (error_msg, "Signal%s \"%s\", error while trying to create connection", (cattrs->bundle ? " bundle" : ""), cattrs->name);
+        }
+    } else {
+        ig_tclc_connect_attrs_apply (cattrs, nets, error_msg);
+    }
+
+    if (!first || (error_msg->len == 0) || (cattrs->net_attrs == NULL)) return;
 
-    if (net->len == 0) {
-        *adapt = true;
-        log_debug ("TCnPr", "got only object: %s", input);
-        return;
+    int       n_net_attrs = 0;
+    Tcl_Obj **net_attrs   = NULL;
+    Tcl_ListObjGetElements (NULL, cattrs->net_attrs, &n_net_attrs, &net_attrs);
+    for (int i = 0; i + 1 < n_net_attrs; i += 2) {
+        if (strcmp (Tcl_GetString (net_attrs[i]), "origin") == 0) {
+            g_string_append_printf (error_msg, " (%s)", Tcl_GetString (net_attrs[i+1]));
+            break;
+        }
     }
+}
 
-    if (net->str[net->len - 1] == '!') {
-        *adapt = true;
-        g_string_truncate (net, net->len - 1);
-        log_debug ("TCnPr", "got object + net + adapt: %s -> %s", id->str, net->str);
-    } else {
-        *adapt = false;
-        log_debug ("TCnPr", "got object + net + force: %s -> %s", id->str, net->str);
+/*
+ * create queued connections of deferred mode before the database is used by a command that can see their objects,
+ * failures are reported when deferred mode ends
+ */
+static void ig_tclc_connect_commit (struct ig_lib_db *db, guint n_threads)
+{
+    if ((db->conn_deferred == NULL) || (db->conn_deferred->len == 0)) return;
+
+    if (n_threads == 0) {
+        n_threads = g_get_num_processors ();
     }
 
-    /* checks */
-    ig_tclc_check_name_and_warn (id->str);
-    ig_tclc_check_name_and_warn (net->str);
+    log_debug ("TCCon", "committing deferred connections...");
+    ig_lib_connection_commit (db, n_threads, ig_tclc_connect_commit_nets, db->conn_failed_msg);
+    log_debug ("TCCon", "... committed deferred connections");
 }
 
-static void ig_tclc_check_name_and_warn (const char *name)
+/* object types created or modified by connections */
+static bool ig_tclc_obj_connectable (struct ig_object *obj)
 {
-    if (name == NULL) return;
+    switch (obj->type) {
+        case IG_OBJ_NET:
+        case IG_OBJ_PORT:
+        case IG_OBJ_PIN:
+        case IG_OBJ_DECLARATION:
+            return true;
+        default:
+            return false;
+    }
+}
 
-    const char unwanted[] = {'"', '\'', '!', ':', '$', ' ', '{', '}', '[', ']', '<', '>', '(', ')', 0};
-    for (const char *cp = &(unwanted[0]); *cp != 0; cp++) {
-        if (strchr (name, *cp) != NULL) {
-            log_warn ("TChkN", "Got identifier \"%s\" containing probably unwanted character \"%c\".", name, *cp);
-        }
+/* database lookup of Object-ID, queued connections are created before if they can create or modify the object */
+static struct ig_object *ig_tclc_get_object_commit (struct ig_lib_db *db, Tcl_Obj *id_obj)
+{
+    struct ig_object *obj = ig_tclc_get_object (db, id_obj);
+
+    if ((db->conn_deferred == NULL) || (db->conn_deferred->len == 0)) return obj;
+    if ((obj != NULL) && !ig_tclc_obj_connectable (obj)) return obj;
+
+    ig_tclc_connect_commit (db, 0);
+
+    if (obj == NULL) {
+        obj = ig_tclc_get_object (db, id_obj);
     }
+
+    return obj;
 }
 
 /* TCLDOC
@@ -1069,13 +2829,17 @@ static void ig_tclc_check_name_and_warn (const char *name)
 # @brief Create a signal connecting modules/instances.
 #
 # @param args Parsed command arguments:<br>
-# -signal-name \<signal-name\><br>
-# [-signal-size \<signal-bitwidth\>]<br>
+# (-signal-name \<signal-name\><br>
+#  [-signal-size \<signal-bitwidth\>]<br>
+# |-signal-names {\<signal-name1\> \<signal-name2\> ...}<br>
+#  [-signal-sizes {\<signal-bitwidth1\> \<signal-bitwidth2\> ...}])<br>
 # (-bidir {\<endpoint1\> \<endpoint2\> ...}<br>
 # |-from \<startpoint\><br>
 #  -to {\<endpoint1\> \<endpoint2\> ...})<br>
+# [-attributes {\<attribute1\> \<value1\> ...}]<br>
+# [-net-attributes {\<attribute1\> \<value1\> ...}]<br>
 #
-# @return Net object of the newly created signal or an error
+# @return Net object of the newly created signal (list of net objects for -signal-names) or an error
 #
 # Start-/Endpoints must be of the form "<Object-ID>[-><local name>[!]]"
 # where \<Object-ID\> is a module or instance object and optionally
@@ -1083,6 +2847,18 @@ static void ig_tclc_check_name_and_warn (const char *name)
 # The optional [!] adapts the local name suffix at the specified object,
 # otherwise the name is kept verbatim.
 #
+# -signal-names creates a bundle of signals with the same start-/endpoints,
+# the hierarchy is computed only once for all of them. Local names are not
+# possible for bundles. -signal-sizes must be empty (size 1), contain a single
+# size for all signals or a size for each signal.
+#
+# -attributes are set on the created nets and all their pins/ports/declarations,
+# -net-attributes only on the nets.
+#
+# In deferred mode (see ig::db::deferred) the connection is only queued
+# and the IDs the nets will get are returned. Errors of queued connections
+# are reported by ig::db::deferred -end.
+#
 */
 static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
 {
@@ -1090,18 +2866,26 @@ static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc,
 
     if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
 
-    char  *from    = NULL;
-    char  *name    = NULL;
-    char  *size    = NULL;
-    GList *to_list = NULL;
-    GList *bd_list = NULL;
+    char    *from      = NULL;
+    char    *name      = NULL;
+    char    *size      = NULL;
+    GList   *to_list   = NULL;
+    GList   *bd_list   = NULL;
+    GList   *name_list = NULL;
+    GList   *size_list = NULL;
+    Tcl_Obj *attrs     = NULL;
+    Tcl_Obj *net_attrs = NULL;
 
     Tcl_ArgvInfo arg_table [] = {
-        {TCL_ARGV_STRING,   "-signal-name", NULL,                                                      (void *)&name,    "signal (prefix) name", NULL},
-        {TCL_ARGV_STRING,   "-signal-size", NULL,                                                      (void *)&size,    "signal (bus) size", NULL},
-        {TCL_ARGV_STRING,   "-from",        NULL,                                                      (void *)&from,    "start of signal (unidirectional)", NULL},
-        {TCL_ARGV_FUNC,     "-to",          (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_string_list_parse, (void *)&to_list, "list of signal endpoints", NULL},
-        {TCL_ARGV_FUNC,     "-bidir",       (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_string_list_parse, (void *)&bd_list, "list of endpoints connected bidirectional", NULL},
+        {TCL_ARGV_STRING,   "-signal-name",    NULL,                                                      (void *)&name,      "signal (prefix) name", NULL},
+        {TCL_ARGV_STRING,   "-signal-size",    NULL,                                                      (void *)&size,      "signal (bus) size", NULL},
+        {TCL_ARGV_FUNC,     "-signal-names",   (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_string_list_parse, (void *)&name_list, "list of signal names of a bundle", NULL},
+        {TCL_ARGV_FUNC,     "-signal-sizes",   (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_string_list_parse, (void *)&size_list, "list of signal sizes of a bundle", NULL},
+        {TCL_ARGV_STRING,   "-from",           NULL,                                                      (void *)&from,      "start of signal (unidirectional)", NULL},
+        {TCL_ARGV_FUNC,     "-to",             (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_string_list_parse, (void *)&to_list,   "list of signal endpoints", NULL},
+        {TCL_ARGV_FUNC,     "-bidir",          (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_string_list_parse, (void *)&bd_list,   "list of endpoints connected bidirectional", NULL},
+        {TCL_ARGV_FUNC,     "-attributes",     (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse,         (void *)&attrs,     "attributes of the nets and all their objects", NULL},
+        {TCL_ARGV_FUNC,     "-net-attributes", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse,         (void *)&net_attrs, "attributes of the nets only", NULL},
 
         TCL_ARGV_AUTO_HELP,
         TCL_ARGV_TABLE_END
@@ -1110,6 +2894,28 @@ static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc,
     int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
     if (result != TCL_OK) goto l_ig_tclc_connect_exit;
 
+    bool bundle = (name_list != NULL);
+    if (bundle) {
+        if (name != NULL) {
+            result = tcl_error_msg (interp, "Signal \"%s\": combining -signal-name and -signal-names is invalid.", name);
+            goto l_ig_tclc_connect_exit;
+        }
+        name = (char *)name_list->data;
+
+        guint n_sizes = g_list_length (size_list);
+        if ((n_sizes > 1) && (n_sizes != g_list_length (name_list))) {
+            result = tcl_error_msg (interp, "Signal bundle \"%s\": number of sizes does not match number of signals", name);
+        }
+        if ((n_sizes > 0) && (size != NULL)) {
+            result = tcl_error_msg (interp, "Signal bundle \"%s\": combining -signal-size and -signal-sizes is invalid.", name);
+        }
+        if (n_sizes == 1) {
+            size = (char *)size_list->data;
+        }
+    } else if (size_list != NULL) {
+        result = tcl_error_msg (interp, "-signal-sizes is only valid with -signal-names");
+    }
+
     if (name == NULL) {
         result = tcl_error_msg (interp, "Signal name is required");
     }
@@ -1123,6 +2929,14 @@ static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc,
         size = "1";
     }
 
+    int n_attrs = 0;
+    if ((attrs != NULL) && ((Tcl_ListObjLength (NULL, attrs, &n_attrs) != TCL_OK) || (n_attrs % 2 != 0))) {
+        result = tcl_error_msg (interp, "Signal \"%s\": -attributes must be a list of attribute names and values", name);
+    }
+    if ((net_attrs != NULL) && ((Tcl_ListObjLength (NULL, net_attrs, &n_attrs) != TCL_OK) || (n_attrs % 2 != 0))) {
+        result = tcl_error_msg (interp, "Signal \"%s\": -net-attributes must be a list of attribute names and values", name);
+    }
+
     if (result != TCL_OK) goto l_ig_tclc_connect_exit;
 
     log_debug ("TCCon", "generating connection info");
@@ -1136,7 +2950,7 @@ static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc,
     if (from != NULL) {
         bool inv = false;
         ig_tclc_connection_parse (from, tstr_id, tstr_net, &t_adapt, &inv);
-        struct ig_object *src_obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, tstr_id->str));
+        struct ig_object *src_obj = ig_lib_db_get_object (db, tstr_id->str);
         if (src_obj == NULL) {
             log_error ("TCCon", "Signal \"%s\": could not find object for id \"%s\"", name, tstr_id->str);
             goto l_ig_tclc_connect_nfexit;
@@ -1161,7 +2975,7 @@ static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc,
     for (GList *li = trg_orig_list; li != NULL; li = li->next) {
         bool inv = false;
         ig_tclc_connection_parse ((const char *)li->data, tstr_id, tstr_net, &t_adapt, &inv);
-        struct ig_object *trg_obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, tstr_id->str));
+        struct ig_object *trg_obj = ig_lib_db_get_object (db, tstr_id->str);
         if (trg_obj == NULL) {
             log_error ("TCCon", "Signal \"%s\": could not find object for id \"%s\"", name, tstr_id->str);
             goto l_ig_tclc_connect_nfexit;
@@ -1179,24 +2993,73 @@ static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc,
     }
     trg_list = g_list_reverse (trg_list);
 
-    log_debug ("TCCon", "starting connection...");
-    struct ig_net *gen_net = NULL;
+    struct ig_tclc_connect_attrs *cattrs    = ig_tclc_connect_attrs_new (name, bundle, size, size_list, attrs, net_attrs);
+    GList                         name_item = {name, NULL, NULL};
+    GList                        *signames  = (bundle ? name_list : &name_item);
 
-    if (!ig_lib_connection (db, name, src, trg_list, &gen_net)) {
-        ig_net_free (gen_net);
-        result = tcl_error_msg (interp, "Signal \"%s\", error while trying to create connection", name);
+    if (db->conn_deferred != NULL) {
+        log_debug ("TCCon", "queueing connection...");
+        ig_lib_connection_defer (db, signames, src, trg_list, cattrs, (GDestroyNotify)ig_tclc_connect_attrs_free);
+
+        /* nets do not exist yet: return the IDs they will get */
+        const char *net_type = ig_obj_type_name (IG_OBJ_NET);
+        if (bundle) {
+            Tcl_Obj *retval = Tcl_NewListObj (0, NULL);
+            for (GList *li = name_list; li != NULL; li = li->next) {
+                Tcl_ListObjAppendElement (interp, retval, Tcl_ObjPrintf ("%s##%s", net_type, (const char *)li->data));
+            }
+            Tcl_SetObjResult (interp, retval);
+        } else {
+            Tcl_SetObjResult (interp, Tcl_ObjPrintf ("%s##%s", net_type, name));
+        }
         goto l_ig_tclc_connect_exit_pre;
     }
-    log_debug ("TCCon", "... finished connection");
 
-    ig_obj_attr_set (IG_OBJECT (gen_net), "size", size, true);
-    for (GList *li = gen_net->objects->head; li != NULL; li = li->next) {
-        struct ig_object *i_obj = PTR_TO_IG_OBJECT (li->data);
+    GList *gen_nets = NULL;
+    bool   success  = false;
+
+    if (bundle) {
+        log_debug ("TCCon", "starting bundle connection...");
+        success = ig_lib_connection_bundle (db, name_list, src, trg_list, &gen_nets);
+    } else {
+        log_debug ("TCCon", "starting connection...");
+        struct ig_net *gen_net = NULL;
+
+        success = ig_lib_connection (db, name, src, trg_list, &gen_net);
+        if (success) {
+            gen_nets = g_list_prepend (gen_nets, gen_net);
+        } else {
+            ig_net_free (gen_net);
+        }
+    }
+
+    GString *error_msg = g_string_new (NULL);
+    if (success) {
+        log_debug ("TCCon", "... finished connection");
+        ig_tclc_connect_attrs_apply (cattrs, gen_nets, error_msg);
+    } else {
+        ig_tclc_connect_commit_nets (db, NULL, cattrs, error_msg);
+    }
+    ig_tclc_connect_attrs_free (cattrs);
 
-        ig_obj_attr_set (i_obj, "size", size, true);
+    if (error_msg->len > 0) {
+        result = tcl_error_msg (interp, "%s", error_msg->str);
+        g_string_free (error_msg, true);
+        g_list_free (gen_nets);
+        goto l_ig_tclc_connect_exit_pre;
     }
+    g_string_free (error_msg, true);
 
-    Tcl_Obj *retval = Tcl_NewStringObj (IG_OBJECT (gen_net)->id, -1);
+    Tcl_Obj *retval = NULL;
+    if (bundle) {
+        retval = Tcl_NewListObj (0, NULL);
+        for (GList *li = gen_nets; li != NULL; li = li->next) {
+            Tcl_ListObjAppendElement (interp, retval, ig_tclc_new_object (db, IG_OBJECT ((struct ig_net *)li->data)));
+        }
+    } else {
+        retval = ig_tclc_new_object (db, IG_OBJECT ((struct ig_net *)gen_nets->data));
+    }
+    g_list_free (gen_nets);
 
     log_debug ("TCCon", "freeing results...");
 
@@ -1209,6 +3072,8 @@ l_ig_tclc_connect_exit_pre:
 l_ig_tclc_connect_exit:
     g_list_free (to_list);
     g_list_free (bd_list);
+    g_list_free (name_list);
+    g_list_free (size_list);
 
     log_debug ("TCCon", "... freed results");
 
@@ -1248,6 +3113,10 @@ static int ig_tclc_parameter (ClientData clientdata, Tcl_Interp *interp, int obj
 
     if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
 
+    /* parameters are created immediately, messages are kept in order with queued connections */
+    bool log_deferred = ((db->conn_deferred != NULL) && (db->conn_deferred->len > 0));
+    if (log_deferred) log_capture_begin ();
+
     char  *name     = NULL;
     char  *value    = NULL;
     GList *ept_list = NULL;
@@ -1282,7 +3151,7 @@ static int ig_tclc_parameter (ClientData clientdata, Tcl_Interp *interp, int obj
 
     for (GList *li = ept_list; li != NULL; li = li->next) {
         ig_tclc_connection_parse ((const char *)li->data, tstr_id, tstr_par, &t_adapt, NULL);
-        struct ig_object *trg_obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, tstr_id->str));
+        struct ig_object *trg_obj = ig_lib_db_get_object (db, tstr_id->str);
         if (trg_obj == NULL) {
             result = tcl_error_msg (interp, "Parameter \"%s\": could not find object for id \"%s\"", name, tstr_id->str);
             goto l_ig_tclc_parameter_nfexit;
@@ -1309,7 +3178,7 @@ static int ig_tclc_parameter (ClientData clientdata, Tcl_Interp *interp, int obj
     }
     log_debug ("TCPar", "... finished parametrization");
 
-    Tcl_Obj *retval = Tcl_NewStringObj (IG_OBJECT (gen_generic)->id, -1);
+    Tcl_Obj *retval = ig_tclc_new_object (db, IG_OBJECT (gen_generic));
 
     log_debug ("TCPar", "freeing results...");
 
@@ -1322,6 +3191,8 @@ l_ig_tclc_parameter_exit_pre:
 l_ig_tclc_parameter_exit:
     g_list_free (ept_list);
 
+    if (log_deferred) ig_lib_connection_defer_log (db, log_capture_end ());
+
     return result;
 
 l_ig_tclc_parameter_nfexit:
@@ -1348,6 +3219,7 @@ static int ig_tclc_create_pin (ClientData clientdata, Tcl_Interp *interp, int ob
     struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
 
     if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+    ig_tclc_connect_commit (db, 0);
 
     char *instname = NULL;
     char *pinname  = NULL;
@@ -1374,7 +3246,7 @@ static int ig_tclc_create_pin (ClientData clientdata, Tcl_Interp *interp, int ob
         result = tcl_error_msg (interp, "No pin name specified");
     }
 
-    struct ig_instance *inst = IG_INSTANCE (PTR_TO_IG_OBJECT (g_hash_table_lookup (db->instances_by_name, instname)));
+    struct ig_instance *inst = IG_INSTANCE (PTR_TO_IG_OBJECT (ig_lib_db_name_lookup (db->instances_by_name, instname)));
     if (inst == NULL) {
         return tcl_error_msg (interp, "Could not find instance \"%s\"\n", instname);
     }
@@ -1387,7 +3259,7 @@ static int ig_tclc_create_pin (ClientData clientdata, Tcl_Interp *interp, int ob
         return tcl_error_msg (interp, "Unable to add pin \"%s\" for instance \"%s\").", pin, instname);
     }
 
-    Tcl_SetObjResult (interp, Tcl_NewStringObj (IG_OBJECT (pin)->id, -1));
+    Tcl_SetObjResult (interp, ig_tclc_new_object (db, IG_OBJECT (pin)));
 
     return TCL_OK;
 }
@@ -1410,6 +3282,342 @@ static int ig_tclc_reset (ClientData clientdata, Tcl_Interp *interp, int objc, T
     return TCL_OK;
 }
 
+/* TCLDOC
+##
+# @brief Save database to a binary snapshot file.
+#
+# @param args \<file\>: Name of snapshot file to write.
+#
+# The snapshot contains all objects of the database with their attributes
+# and can be restored with @ref ig::db::load.
+#
+*/
+static int ig_tclc_save (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+    ig_tclc_connect_commit (db, 0);
+
+    if (objc != 2) {
+        Tcl_WrongNumArgs (interp, 1, objv, "file");
+        return TCL_ERROR;
+    }
+
+    const char *filename = Tcl_GetString (objv[1]);
+    if (!ig_snapshot_save (db, filename)) {
+        return tcl_error_msg (interp, "Unable to save snapshot \"%s\"", filename);
+    }
+
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Replace database content by a binary snapshot file.
+#
+# @param args \<file\>: Name of snapshot file written by @ref ig::db::save.
+#
+# All objects currently in the database are removed like with @ref ig::db::reset.
+# On error the database is left unchanged.
+#
+*/
+static int ig_tclc_load (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+    ig_tclc_connect_commit (db, 0);
+
+    if (objc != 2) {
+        Tcl_WrongNumArgs (interp, 1, objv, "file");
+        return TCL_ERROR;
+    }
+
+    const char *filename = Tcl_GetString (objv[1]);
+    if (!ig_snapshot_load (db, filename)) {
+        return tcl_error_msg (interp, "Unable to load snapshot \"%s\"", filename);
+    }
+
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Get content fingerprint of an object for incremental output generation.
+#
+# @param args Parsed command arguments:<br>
+# -object \<object-id\><br>
+# [-data \<additional-data\>]<br>
+#
+# @return Fingerprint as hex string.
+#
+# The fingerprint changes whenever attributes of the object, its children,
+# connected nets/generics or for modules its child instances change.
+# Additional data (e.g. template content) is included in the fingerprint.
+#
+*/
+static int ig_tclc_fingerprint (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+    ig_tclc_connect_commit (db, 0);
+
+    Tcl_Obj *obj_arg = NULL;
+    char    *data    = NULL;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_FUNC,   "-object", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&obj_arg, "object id", NULL},
+        {TCL_ARGV_STRING, "-data",   NULL,                                             (void *)&data,    "additional data to include", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) return result;
+
+    if (obj_arg == NULL) return tcl_error_msg (interp, "No object specified");
+
+    struct ig_object *obj = ig_tclc_get_object (db, obj_arg);
+    if (obj == NULL) return tcl_error_msg (interp, "Unknown object \"%s\"", Tcl_GetString (obj_arg));
+
+    char *fingerprint = ig_lib_obj_fingerprint (obj, data);
+    Tcl_SetObjResult (interp, Tcl_NewStringObj (fingerprint, -1));
+    g_free (fingerprint);
+
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Get memory and object statistics of the database.
+#
+# @return Dict with keys:<br>
+# types: dict of object type to dict with object count, struct_bytes, attr_bytes and string_bytes<br>
+# tables: dict of lookup table name to dict with entries, buckets, load_factor and bytes<br>
+# arena: dict with used and reserved bytes of the object arena<br>
+#
+# Strings shared by multiple objects are counted once for the first object type using them.
+# Hash table bucket counts are estimated from the glib resize policy.
+#
+*/
+static int ig_tclc_stats (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+    ig_tclc_connect_commit (db, 0);
+
+    if (objc != 1) {
+        Tcl_WrongNumArgs (interp, 1, objv, NULL);
+        return TCL_ERROR;
+    }
+
+    struct ig_lib_db_stats stats;
+    ig_lib_db_stats (db, &stats);
+
+    Tcl_Obj *types = Tcl_NewDictObj ();
+    for (int i = 0; i < IG_OBJ_TYPE_COUNT; i++) {
+        struct ig_lib_db_type_stats *tstats = &stats.types[i];
+        Tcl_Obj *type_dict = Tcl_NewDictObj ();
+
+        Tcl_DictObjPut (interp, type_dict, Tcl_NewStringObj ("count", -1),        Tcl_NewWideIntObj (tstats->count));
+        Tcl_DictObjPut (interp, type_dict, Tcl_NewStringObj ("struct_bytes", -1), Tcl_NewWideIntObj (tstats->struct_bytes));
+        Tcl_DictObjPut (interp, type_dict, Tcl_NewStringObj ("attr_bytes", -1),   Tcl_NewWideIntObj (tstats->attr_bytes));
+        Tcl_DictObjPut (interp, type_dict, Tcl_NewStringObj ("string_bytes", -1), Tcl_NewWideIntObj (tstats->string_bytes));
+
+        Tcl_DictObjPut (interp, types, Tcl_NewStringObj (ig_obj_type_name (i), -1), type_dict);
+    }
+
+    Tcl_Obj *tables = Tcl_NewDictObj ();
+    for (int i = 0; i < IG_LIB_DB_TABLE_COUNT; i++) {
+        struct ig_lib_db_table_stats *tstats = &stats.tables[i];
+        Tcl_Obj *table_dict = Tcl_NewDictObj ();
+
+        Tcl_DictObjPut (interp, table_dict, Tcl_NewStringObj ("entries", -1),     Tcl_NewWideIntObj (tstats->entries));
+        Tcl_DictObjPut (interp, table_dict, Tcl_NewStringObj ("buckets", -1),     Tcl_NewWideIntObj (tstats->buckets));
+        Tcl_DictObjPut (interp, table_dict, Tcl_NewStringObj ("load_factor", -1), Tcl_NewDoubleObj ((double)tstats->entries / tstats->buckets));
+        Tcl_DictObjPut (interp, table_dict, Tcl_NewStringObj ("bytes", -1),       Tcl_NewWideIntObj (tstats->bytes));
+
+        Tcl_DictObjPut (interp, tables, Tcl_NewStringObj (tstats->name, -1), table_dict);
+    }
+
+    Tcl_Obj *arena = Tcl_NewDictObj ();
+    Tcl_DictObjPut (interp, arena, Tcl_NewStringObj ("used", -1),     Tcl_NewWideIntObj (stats.arena_used));
+    Tcl_DictObjPut (interp, arena, Tcl_NewStringObj ("reserved", -1), Tcl_NewWideIntObj (stats.arena_reserved));
+
+    Tcl_Obj *result = Tcl_NewDictObj ();
+    Tcl_DictObjPut (interp, result, Tcl_NewStringObj ("types", -1),  types);
+    Tcl_DictObjPut (interp, result, Tcl_NewStringObj ("tables", -1), tables);
+    Tcl_DictObjPut (interp, result, Tcl_NewStringObj ("arena", -1),  arena);
+
+    Tcl_SetObjResult (interp, result);
+
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Create a copy of the current database for building a variant.
+#
+# @param args \<name\>: Name of the new database.<br>
+# or -delete \<name\>: Free inactive database.
+#
+# The current database stays active, use @ref ig::db::switch to work on the copy.
+# Object-IDs are identical in both databases, strings are shared copy-on-write,
+# so a common base can be constructed once and forked for every variant.
+#
+*/
+static int ig_tclc_fork (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_tclc_forks *forks = (struct ig_tclc_forks *)clientdata;
+
+    if (forks == NULL) return tcl_error_msg (interp,  "Database is NULL");
+    ig_tclc_connect_commit (forks->db, 0);
+
+    bool delete = false;
+    if ((objc == 3) && (strcmp (Tcl_GetString (objv[1]), "-delete") == 0)) {
+        delete = true;
+    } else if (objc != 2) {
+        Tcl_WrongNumArgs (interp, 1, objv, "?-delete? name");
+        return TCL_ERROR;
+    }
+
+    const char *name = Tcl_GetString (objv[objc-1]);
+
+    if (delete) {
+        if (strcmp (name, forks->active) == 0) {
+            return tcl_error_msg (interp, "Unable to delete active database \"%s\"", name);
+        }
+        if (!g_hash_table_remove (forks->inactive, name)) {
+            return tcl_error_msg (interp, "Database \"%s\" does not exist", name);
+        }
+        return TCL_OK;
+    }
+
+    if ((strcmp (name, forks->active) == 0) || g_hash_table_contains (forks->inactive, name)) {
+        return tcl_error_msg (interp, "Database \"%s\" already exists", name);
+    }
+
+    g_hash_table_insert (forks->inactive, g_strdup (name), ig_lib_db_fork (forks->db));
+
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Switch database all commands work on.
+#
+# @param args [\<name\>]: Name of database created by @ref ig::db::fork.
+#
+# @return Name of the active database.
+#
+# The previously active database is kept under its name and can be switched back to.
+# The initial database is called "default". Without name, only the name of the active database is returned.
+#
+*/
+static int ig_tclc_switch (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_tclc_forks *forks = (struct ig_tclc_forks *)clientdata;
+
+    if (forks == NULL) return tcl_error_msg (interp,  "Database is NULL");
+    ig_tclc_connect_commit (forks->db, 0);
+
+    if (objc > 2) {
+        Tcl_WrongNumArgs (interp, 1, objv, "?name?");
+        return TCL_ERROR;
+    }
+
+    if (objc == 2) {
+        const char *name  = Tcl_GetString (objv[1]);
+        gpointer    key   = NULL;
+        gpointer    other = NULL;
+
+        if (strcmp (name, forks->active) != 0) {
+            if (!g_hash_table_lookup_extended (forks->inactive, name, &key, &other)) {
+                return tcl_error_msg (interp, "Database \"%s\" does not exist", name);
+            }
+            g_hash_table_steal (forks->inactive, name);
+
+            /* commands keep their database pointer, so only content is exchanged */
+            ig_lib_db_swap (forks->db, (struct ig_lib_db *)other);
+            g_hash_table_insert (forks->inactive, forks->active, other);
+            forks->active = (char *)key;
+        }
+    }
+
+    Tcl_SetObjResult (interp, Tcl_NewStringObj (forks->active, -1));
+
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Enable or disable deferred mode of @ref ig::db::connect.
+#
+# @param args Parsed command arguments:<br>
+# (-begin | -end)<br>
+# [-threads \<n\>]<br>
+#
+# @return Empty string or an error if queued connections could not be created.
+#
+# In deferred mode connections are queued and their hierarchy trees are computed
+# in parallel with up to \<n\> threads (default: number of processors) once a database
+# command needs objects that connections can create or modify (nets, ports, pins, declarations)
+# or deferred mode is ended.
+# Objects and log messages (also of @ref ig::log) are created in order of the connect calls,
+# so the result is the same as without deferred mode.
+# Errors of queued connections are reported when deferred mode is ended.
+#
+*/
+static int ig_tclc_deferred (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+
+    gint mode      = 0;
+    int  n_threads = 0;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_CONSTANT, "-begin",   GINT_TO_POINTER (1), (void *)&mode,      "enable deferred connections", NULL},
+        {TCL_ARGV_CONSTANT, "-end",     GINT_TO_POINTER (2), (void *)&mode,      "create queued connections and disable deferred connections", NULL},
+        {TCL_ARGV_INT,      "-threads", NULL,                (void *)&n_threads, "maximum number of threads for routing", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) return result;
+
+    if (mode == 0) {
+        return tcl_error_msg (interp, "Either -begin or -end is required");
+    }
+    if (n_threads < 0) {
+        return tcl_error_msg (interp, "Invalid number of threads: %d", n_threads);
+    }
+
+    ig_tclc_connect_commit (db, n_threads);
+
+    if (mode == 1) {
+        ig_lib_connection_defer_begin (db);
+        return TCL_OK;
+    }
+
+    if (db->conn_failed > 1) {
+        result = tcl_error_msg (interp, "%s (%d deferred connections failed)", db->conn_failed_msg->str, db->conn_failed);
+    } else if ((db->conn_failed_msg != NULL) && (db->conn_failed_msg->len > 0)) {
+        result = tcl_error_msg (interp, "%s", db->conn_failed_msg->str);
+    }
+
+    ig_lib_connection_defer_end (db);
+
+    return result;
+}
+
 /* TCLDOC
 ##
 # @brief Control log message verbosity.
@@ -1519,6 +3727,8 @@ static int ig_tclc_logger (ClientData clientdata, Tcl_Interp *interp, int objc,
 */
 static int ig_tclc_log (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
 {
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
     char *log_id   = "Tcl";
     gint  loglevel = LOGLEVEL_INFO;
     gint  abort    = 0;
@@ -1543,6 +3753,10 @@ static int ig_tclc_log (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl
         return result;
     }
 
+    /* messages are kept in order with queued connections */
+    bool log_deferred = ((db != NULL) && (db->conn_deferred != NULL) && (db->conn_deferred->len > 0));
+    if (log_deferred) log_capture_begin ();
+
     char *msg = "";
     if (objc > 0) {
         for (int i = 1; i < objc; i++) {
@@ -1576,6 +3790,8 @@ static int ig_tclc_log (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl
         }
     }
 
+    if (log_deferred) ig_lib_connection_defer_log (db, log_capture_end ());
+
     if (abort) {
         Tcl_SetObjResult (interp, Tcl_NewStringObj (msg, -1));
     }
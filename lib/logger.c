@@ -31,6 +31,17 @@ static GHashTable *log_property      = NULL;
 static guint log_count_print[LOGLEVEL_COUNT];
 static guint log_count_suppressed[LOGLEVEL_COUNT];
 
+/* messages of the current thread are captured instead of printed if set - (GPtrArray *) of (struct log_captured *) */
+static GPrivate log_capture = G_PRIVATE_INIT (NULL);
+
+struct log_captured {
+    log_level_t  level;
+    const gchar *id;
+    const gchar *sfile;
+    gint         sline;
+    gchar       *message;
+};
+
 gchar *loglevel_label[LOGLEVEL_COUNT] = {
     "D",
     "I",
@@ -150,8 +161,25 @@ guint string_replace (GString *string, const gchar *search, const gchar *replace
 }
 void log_basev (const log_level_t level, const gchar *id, const gchar *sfile, gint sline, const gchar *format, va_list arg_list)
 {
+    GPtrArray *captured = (GPtrArray *)g_private_get (&log_capture);
+
     if (log_suppress (level, id)) {
-        log_count_suppressed[level]++;
+        if (captured != NULL) {
+            g_atomic_int_inc ((gint *)&log_count_suppressed[level]);
+        } else {
+            log_count_suppressed[level]++;
+        }
+        return;
+    }
+
+    if (captured != NULL) {
+        struct log_captured *msg = g_slice_new (struct log_captured);
+        msg->level   = level;
+        msg->id      = g_intern_string (id);
+        msg->sfile   = g_intern_string (sfile);
+        msg->sline   = sline;
+        msg->message = g_strdup_vprintf (format, arg_list);
+        g_ptr_array_add (captured, msg);
         return;
     }
 
@@ -193,6 +221,58 @@ void log_basev (const log_level_t level, const gchar *id, const gchar *sfile, gi
     }
 }
 
+void log_capture_begin (void)
+{
+    g_private_set (&log_capture, g_ptr_array_new ());
+}
+
+GPtrArray *log_capture_end (void)
+{
+    GPtrArray *captured = (GPtrArray *)g_private_get (&log_capture);
+
+    g_private_set (&log_capture, NULL);
+
+    return captured;
+}
+
+void log_capture_replay (GPtrArray *captured)
+{
+    if (captured == NULL) return;
+
+    for (guint i = 0; i < captured->len; i++) {
+        struct log_captured *msg = (struct log_captured *)g_ptr_array_index (captured, i);
+
+        log_base (msg->level, msg->id, msg->sfile, msg->sline, "%s", msg->message);
+    }
+
+    log_capture_free (captured);
+}
+
+void log_capture_append (GPtrArray *captured, GPtrArray *append)
+{
+    if (append == NULL) return;
+
+    for (guint i = 0; i < append->len; i++) {
+        g_ptr_array_add (captured, g_ptr_array_index (append, i));
+    }
+
+    g_ptr_array_free (append, TRUE);
+}
+
+void log_capture_free (GPtrArray *captured)
+{
+    if (captured == NULL) return;
+
+    for (guint i = 0; i < captured->len; i++) {
+        struct log_captured *msg = (struct log_captured *)g_ptr_array_index (captured, i);
+
+        g_free (msg->message);
+        g_slice_free (struct log_captured, msg);
+    }
+
+    g_ptr_array_free (captured, TRUE);
+}
+
 void log_dump_settings ()
 {
     GHashTableIter iter;
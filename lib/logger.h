@@ -161,6 +161,39 @@ gboolean log_suppress (const log_level_t level, const gchar *id);
  */
 void log_dump_settings ();
 
+/**
+ * @brief Capture log messages of the calling thread instead of printing them.
+ *
+ * Messages are formatted and kept in order until @ref log_capture_end is called,
+ * suppressed messages are only counted. Can be used in worker threads.
+ */
+void log_capture_begin (void);
+
+/**
+ * @brief Stop capturing log messages of the calling thread.
+ * @return Captured messages, to be printed by @ref log_capture_replay or freed by @ref log_capture_free.
+ */
+GPtrArray *log_capture_end (void);
+
+/**
+ * @brief Print captured log messages in original order and free them.
+ * @param captured Captured messages returned by @ref log_capture_end or @c NULL.
+ */
+void log_capture_replay (GPtrArray *captured);
+
+/**
+ * @brief Move captured log messages to the end of other captured messages.
+ * @param captured Captured messages to append to.
+ * @param append Captured messages to append, freed by this function.
+ */
+void log_capture_append (GPtrArray *captured, GPtrArray *append);
+
+/**
+ * @brief Free captured log messages without printing them.
+ * @param captured Captured messages returned by @ref log_capture_end or @c NULL.
+ */
+void log_capture_free (GPtrArray *captured);
+
 /**
  * @brief Returns the number of printed log messages
  */
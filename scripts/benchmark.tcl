@@ -0,0 +1,594 @@
+#!/usr/bin/env tclsh
+
+#
+#   ICGlue is a Tcl-Library for scripted HDL generation
+#   Copyright (C) 2017-2019  Andreas Dixius, Felix Neumärker
+#
+#   This program is free software: you can redistribute it and/or modify
+#   it under the terms of the GNU General Public License as published by
+#   the Free Software Foundation, either version 3 of the License, or
+#   (at your option) any later version.
+#
+#   This program is distributed in the hope that it will be useful,
+#   but WITHOUT ANY WARRANTY; without even the implied warranty of
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#   GNU General Public License for more details.
+#
+#   You should have received a copy of the GNU General Public License
+#   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+
+# synthetic benchmarks for the database library
+# usage: benchmark.tcl [BENCHMARK]...
+# without arguments all benchmarks are run.
+
+package require ICGlue
+
+namespace eval bench {
+    ## @brief Current resident set size of this process in kB (linux only).
+    proc rss_kb {} {
+        set f [open "/proc/self/status" "r"]
+        set status [read $f]
+        close $f
+        if {[regexp -line {^VmRSS:\s+(\d+)} $status m_whole m_rss]} {
+            return $m_rss
+        }
+        return 0
+    }
+
+    ## @brief Print a single benchmark result line.
+    proc report {name value unit} {
+        puts [format "%-32s %14s %s" $name $value $unit]
+    }
+
+    ## @brief Run script and return runtime in microseconds.
+    proc runtime_us {script} {
+        set t_start [clock microseconds]
+        uplevel 1 $script
+        return [expr {[clock microseconds] - $t_start}]
+    }
+
+    ## @brief Create a synthetic design: instances of a resource module inside a top module with pins.
+    proc synthetic_pins {n_inst n_pins} {
+        set top [ig::db::create_module -name "bench_top"]
+        set res [ig::db::create_module -resource -name "bench_res"]
+        for {set i 0} {$i < $n_inst} {incr i} {
+            set inst_name "bench_res_i${i}"
+            ig::db::create_instance -name $inst_name -of-module $res -parent-module $top
+            for {set j 0} {$j < $n_pins} {incr j} {
+                ig::db::create_pin -instname $inst_name -pinname "p${j}" -value "s_${i}_${j}"
+            }
+        }
+        return $top
+    }
+
+    ## @brief Memory per object of a 100k-pin synthetic design.
+    proc mem_pins {} {
+        set n_inst 100
+        set n_pins 1000
+        set n_objs [expr {$n_inst * $n_pins}]
+
+        set rss_start [rss_kb]
+        set t [runtime_us {synthetic_pins $n_inst $n_pins}]
+        set rss_end [rss_kb]
+
+        report "mem_pins: pins"        $n_objs ""
+        report "mem_pins: create time" [expr {$t / 1000}] "ms"
+        report "mem_pins: rss delta"   [expr {$rss_end - $rss_start}] "kB"
+        report "mem_pins: per pin"     [expr {($rss_end - $rss_start) * 1024 / $n_objs}] "bytes"
+
+        set t [runtime_us {ig::db::reset}]
+        report "mem_pins: reset time"  $t "us"
+    }
+
+    ## @brief Memory of 10k identical pad instances of a resource module with common attributes.
+    proc mem_instances {} {
+        set n_inst 10000
+        set n_pins 8
+
+        set rss_start [rss_kb]
+        set t [runtime_us {
+            set top [ig::db::create_module -name "bench_chip"]
+            set pad [ig::db::create_module -resource -name "bench_pad"]
+            for {set i 0} {$i < $n_inst} {incr i} {
+                set inst [ig::db::create_instance -name "bench_pad_i${i}" -of-module $pad -parent-module $top]
+                ig::db::set_attribute -object $inst -attributes {"language" "verilog" "mode" "rtl" "pad_type" "io"}
+                for {set j 0} {$j < $n_pins} {incr j} {
+                    set pin [ig::db::create_pin -instname "bench_pad_i${i}" -pinname "p${j}" -value "s_${i}_${j}"]
+                    ig::db::set_attribute -object $pin -attributes [list "dimension" {} "pad_pin" "p${j}"]
+                }
+            }
+        }]
+        set rss_end [rss_kb]
+
+        set stats [ig::db::stats]
+        set attr_bytes [expr {[dict get $stats types instance attr_bytes] + [dict get $stats types pin attr_bytes]}]
+
+        report "mem_instances: instances"     $n_inst ""
+        report "mem_instances: create time"   [expr {$t / 1000}] "ms"
+        report "mem_instances: rss delta"     [expr {$rss_end - $rss_start}] "kB"
+        report "mem_instances: attr tables"   [expr {$attr_bytes / 1024}] "kB"
+        report "mem_instances: per instance"  [expr {($rss_end - $rss_start) * 1024 / $n_inst}] "bytes"
+
+        ig::db::reset
+    }
+
+    ## @brief Memory of 2k instances of a resource module with 40 attributes of unique values each.
+    proc mem_attr_unique {} {
+        set n_inst  2000
+        set n_attrs 40
+
+        set rss_start [rss_kb]
+        set t [runtime_us {
+            set top [ig::db::create_module -name "bench_uchip"]
+            set res [ig::db::create_module -resource -name "bench_ures"]
+            for {set i 0} {$i < $n_inst} {incr i} {
+                set inst [ig::db::create_instance -name "bench_ures_i${i}" -of-module $res -parent-module $top]
+                for {set j 0} {$j < $n_attrs} {incr j} {
+                    ig::db::set_attribute -object $inst -attribute "a${j}" -value "v_${i}_${j}"
+                }
+            }
+        }]
+        set rss_end [rss_kb]
+
+        set stats [ig::db::stats]
+        set attr_bytes [dict get $stats types instance attr_bytes]
+
+        report "mem_attr_unique: instances"    $n_inst ""
+        report "mem_attr_unique: create time"  [expr {$t / 1000}] "ms"
+        report "mem_attr_unique: rss delta"    [expr {$rss_end - $rss_start}] "kB"
+        report "mem_attr_unique: attr tables"  [expr {$attr_bytes / 1024}] "kB"
+
+        ig::db::reset
+    }
+
+    ## @brief 1M attribute lookups on pins returned by the database.
+    proc attr_get {} {
+        set n_calls 1000000
+
+        synthetic_pins 10 100
+        set pins {}
+        foreach inst [ig::db::get_instances -of [ig::db::get_modules -name "bench_top"]] {
+            lappend pins {*}[ig::db::get_pins -of $inst]
+        }
+
+        set i 0
+        set t [runtime_us {
+            while {$i < $n_calls} {
+                foreach p $pins {
+                    ig::db::get_attribute -object $p -attribute "name"
+                }
+                incr i [llength $pins]
+            }
+        }]
+
+        report "attr_get: calls"         $i ""
+        report "attr_get: time"          [expr {$t / 1000}] "ms"
+        report "attr_get: per call"      [expr {$t * 1000 / $i}] "ns"
+
+        ig::db::reset
+    }
+
+    ## @brief Child traversal of a synthetic SoC top: 50 submodules with 200 ports each, instantiated in a top module.
+    proc traverse {} {
+        set n_mods  50
+        set n_ports 200
+        set n_iter  20
+
+        set top [ig::db::create_module -name "bench_soc"]
+        for {set i 0} {$i < $n_mods} {incr i} {
+            set mod  [ig::db::create_module -name "bench_sub${i}"]
+            set inst [ig::db::create_instance -name "bench_sub${i}" -of-module $mod -parent-module $top]
+            for {set j 0} {$j < $n_ports} {incr j} {
+                ig::db::connect -from $inst -to $top -signal-name "s_${i}_${j}"
+            }
+        }
+
+        set n_objs 0
+        set t [runtime_us {
+            for {set k 0} {$k < $n_iter} {incr k} {
+                foreach mod [ig::db::get_modules -all] {
+                    incr n_objs [llength [ig::db::get_ports -of $mod -all]]
+                    foreach inst [ig::db::get_instances -of $mod -all] {
+                        incr n_objs [llength [ig::db::get_pins -of $inst -all]]
+                    }
+                }
+            }
+        }]
+
+        report "traverse: objects"       $n_objs ""
+        report "traverse: time"          [expr {$t / 1000}] "ms"
+        report "traverse: per object"    [expr {$t * 1000 / $n_objs}] "ns"
+
+        set port_t [runtime_us {
+            for {set k 0} {$k < $n_iter} {incr k} {
+                foreach mod [ig::db::get_modules -all] {
+                    ig::db::get_ports -of $mod -all
+                }
+            }
+        }]
+        report "traverse: ports of all mods" [expr {$port_t / $n_iter}] "us"
+
+        ig::db::reset
+    }
+
+    ## @brief Connections through a 10-level hierarchy: 5k signals from leaf instances to the top module.
+    proc connect_deep {} {
+        set n_levels 10
+        set n_leaves 10
+        set n_sigs   500
+
+        set parent [ig::db::create_module -name "bench_l0"]
+        set top    $parent
+        for {set l 1} {$l < $n_levels} {incr l} {
+            set mod [ig::db::create_module -name "bench_l${l}"]
+            ig::db::create_instance -name "bench_l${l}" -of-module $mod -parent-module $parent
+            set parent $mod
+        }
+        set leaves {}
+        for {set i 0} {$i < $n_leaves} {incr i} {
+            set mod [ig::db::create_module -name "bench_leaf${i}"]
+            lappend leaves [ig::db::create_instance -name "bench_leaf${i}" -of-module $mod -parent-module $parent]
+        }
+
+        set n_conn 0
+        set t [runtime_us {
+            foreach leaf $leaves {
+                for {set j 0} {$j < $n_sigs} {incr j} {
+                    ig::db::connect -from $leaf -to $top -signal-name "s_${n_conn}"
+                    incr n_conn
+                }
+            }
+        }]
+
+        report "connect_deep: connections"    $n_conn ""
+        report "connect_deep: time"           [expr {$t / 1000}] "ms"
+        report "connect_deep: per connection" [expr {$t / $n_conn}] "us"
+
+        ig::db::reset
+    }
+
+    ## @brief High-fanout net: one source in the top module connected to 10k leaf instances.
+    proc connect_fanout {} {
+        set n_leaves 10000
+
+        set top [ig::db::create_module -name "bench_fan_top"]
+        set mid [ig::db::create_module -name "bench_fan_mid"]
+        set res [ig::db::create_module -resource -name "bench_fan_leaf"]
+        ig::db::create_instance -name "bench_fan_mid" -of-module $mid -parent-module $top
+        set leaves {}
+        for {set i 0} {$i < $n_leaves} {incr i} {
+            lappend leaves [ig::db::create_instance -name "bench_fan_leaf${i}" -of-module $res -parent-module $mid]
+        }
+
+        set t [runtime_us {
+            ig::db::connect -from $top -to $leaves -signal-name "rst"
+        }]
+
+        report "connect_fanout: endpoints" $n_leaves ""
+        report "connect_fanout: time"      [expr {$t / 1000}] "ms"
+
+        ig::db::reset
+    }
+
+    ## @brief Sideband bundle of 64 signals between 100 resource instances in a 5-level hierarchy: single connects vs. bundle connect.
+    proc connect_bundle {} {
+        set n_levels 5
+        set n_leaves 100
+        set n_sigs   64
+
+        foreach mode {single bundle} {
+            set parent [ig::db::create_module -name "bench_bl0"]
+            set top    $parent
+            for {set l 1} {$l < $n_levels} {incr l} {
+                set mod [ig::db::create_module -name "bench_bl${l}"]
+                ig::db::create_instance -name "bench_bl${l}" -of-module $mod -parent-module $parent
+                set parent $mod
+            }
+            set res [ig::db::create_module -resource -name "bench_bleaf"]
+            set leaves {}
+            for {set i 0} {$i < $n_leaves} {incr i} {
+                lappend leaves [ig::db::create_instance -name "bench_bleaf${i}" -of-module $res -parent-module $parent]
+            }
+            set names {}
+            for {set j 0} {$j < $n_sigs} {incr j} {
+                lappend names "sb_${j}"
+            }
+
+            if {$mode eq "single"} {
+                set t [runtime_us {
+                    foreach n $names {
+                        ig::db::connect -from $top -to $leaves -signal-name $n
+                    }
+                }]
+            } else {
+                set t [runtime_us {
+                    ig::db::connect -from $top -to $leaves -signal-names $names
+                }]
+            }
+
+            report "connect_bundle: $mode time" [expr {$t / 1000}] "ms"
+
+            ig::db::reset
+        }
+    }
+
+    ## @brief Module tree of 200 subsystems with 10 nested levels each, built via M -tree.
+    proc build_tree {} {
+        set n_subs   200
+        set n_levels 10
+
+        set tree "bench_tree_top\n"
+        for {set i 0} {$i < $n_subs} {incr i} {
+            for {set l 1} {$l <= $n_levels} {incr l} {
+                append tree [string repeat "." $l] "bench_tree_s${i}_l${l}\n"
+            }
+        }
+
+        set t [runtime_us {
+            ig::M -unit "bench_tree" -tree $tree
+        }]
+        set n_mods [llength [ig::db::get_modules -all]]
+
+        report "build_tree: modules"    $n_mods ""
+        report "build_tree: time"       [expr {$t / 1000}] "ms"
+        report "build_tree: per module" [expr {$t / $n_mods}] "us"
+
+        ig::db::reset
+    }
+
+    ## @brief 200 signals with attributes from the top of a 10-level hierarchy to 200 leaf instances each: immediate vs. deferred connects.
+    proc connect_deferred {} {
+        set n_levels 10
+        set n_leaves 200
+        set n_sigs   200
+
+        foreach mode {immediate deferred} {
+            set parent [ig::db::create_module -name "bench_dl0"]
+            set top    $parent
+            for {set l 1} {$l < $n_levels} {incr l} {
+                set mod [ig::db::create_module -name "bench_dl${l}"]
+                ig::db::create_instance -name "bench_dl${l}" -of-module $mod -parent-module $parent
+                set parent $mod
+            }
+            set res [ig::db::create_module -resource -name "bench_dleaf"]
+            set leaves {}
+            for {set i 0} {$i < $n_leaves} {incr i} {
+                lappend leaves [ig::db::create_instance -name "bench_dleaf${i}" -of-module $res -parent-module $parent]
+            }
+
+            set t [runtime_us {
+                if {$mode eq "deferred"} {
+                    ig::db::deferred -begin
+                }
+                for {set j 0} {$j < $n_sigs} {incr j} {
+                    ig::db::connect -from $top -to $leaves -signal-name "s_${j}" -signal-size 8 \
+                        -attributes {"dimension" {}} -net-attributes [list "origin" "bench:${j}"]
+                }
+                if {$mode eq "deferred"} {
+                    ig::db::deferred -end
+                }
+            }]
+
+            report "connect_deferred: $mode time" [expr {$t / 1000}] "ms"
+
+            ig::db::reset
+        }
+    }
+
+    ## @brief 200 signals via S from the top of a 10-level hierarchy to 100 leaf instances each: immediate vs. deferred connects.
+    proc connect_deferred_s {} {
+        set n_levels 10
+        set n_leaves 100
+        set n_sigs   200
+
+        set tree "bench_sl0\n"
+        for {set l 1} {$l < $n_levels} {incr l} {
+            append tree [string repeat "." $l] "bench_sl${l}\n"
+        }
+        set leaves {}
+        for {set i 0} {$i < $n_leaves} {incr i} {
+            append tree [string repeat "." $n_levels] "bench_sleaf${i}\n"
+            lappend leaves "bench_sleaf${i}"
+        }
+
+        foreach mode {immediate deferred} {
+            ig::M -unit "bench_s" -tree $tree
+
+            set t [runtime_us {
+                if {$mode eq "deferred"} {
+                    ig::db::deferred -begin
+                }
+                for {set j 0} {$j < $n_sigs} {incr j} {
+                    ig::S "s_${j}" -w 8 bench_sl0 --> {*}$leaves
+                }
+                if {$mode eq "deferred"} {
+                    ig::db::deferred -end
+                }
+            }]
+
+            report "connect_deferred_s: $mode time" [expr {$t / 1000}] "ms"
+
+            ig::db::reset
+        }
+    }
+
+    ## @brief Local signal lookups in a module with 2k ports as done by template adaption.
+    proc signal_lookup {} {
+        set n_ports   2000
+        set n_lookups 10000
+        set n_maps    200
+
+        set top [ig::db::create_module -name "bench_sig_top"]
+        set sub [ig::db::create_module -name "bench_sig_sub"]
+        set inst [ig::db::create_instance -name "bench_sig_sub" -of-module $sub -parent-module $top]
+        for {set i 0} {$i < $n_ports} {incr i} {
+            ig::db::connect -from $top -to $inst -signal-name "s_${i}"
+        }
+
+        set t [runtime_us {
+            for {set i 0} {$i < $n_lookups} {incr i} {
+                ig::aux::get_signal_id_by_name "s_[expr {$i % $n_ports}]" $sub
+            }
+        }]
+        report "signal_lookup: lookups"          $n_lookups ""
+        report "signal_lookup: per lookup"       [expr {$t * 1000 / $n_lookups}] "ns"
+
+        set t [runtime_us {
+            for {set i 0} {$i < $n_maps} {incr i} {
+                ig::aux::adapt_codesection_replace_dict "assign s_${i}! = s_[expr {$i + 1}]!;" [ig::aux::adapt_replacement_dict $sub]
+            }
+        }]
+        report "signal_lookup: per adaption"     [expr {$t / $n_maps}] "us"
+
+        ig::db::reset
+    }
+
+    ## @brief Parameter evaluation through a 10-level hierarchy: first evaluation and memoized repetitions.
+    proc param_eval {} {
+        set n_levels 10
+        set n_params 100
+        set n_iter   10
+
+        set parent [ig::db::create_module -name "bench_p0"]
+        set top    $parent
+        set targets [list $top]
+        for {set l 1} {$l < $n_levels} {incr l} {
+            set mod [ig::db::create_module -name "bench_p${l}"]
+            ig::db::create_instance -name "bench_p${l}" -of-module $mod -parent-module $parent
+            lappend targets $mod
+            set parent $mod
+        }
+        set leaf $parent
+
+        for {set i 0} {$i < $n_params} {incr i} {
+            ig::db::parameter -name "P_${i}" -value "{2{8'h[format %02x $i]}}" -targets $targets
+        }
+        set params [ig::db::get_parameters -of $leaf -all]
+
+        set t [runtime_us {
+            foreach p $params {
+                ig::db::eval_parameter -parameter $p
+            }
+        }]
+        report "param_eval: parameters"       [llength $params] ""
+        report "param_eval: first evaluation" [expr {$t / [llength $params]}] "us"
+
+        set t [runtime_us {
+            for {set i 0} {$i < $n_iter} {incr i} {
+                foreach p $params {
+                    ig::db::eval_parameter -parameter $p
+                }
+            }
+        }]
+        report "param_eval: memoized"         [expr {$t * 1000 / ($n_iter * [llength $params])}] "ns"
+
+        ig::db::reset
+    }
+
+    ## @brief Attribute access of a module with 5k ports: single vs. bulk fetch and template preprocessing.
+    proc attr_bulk {} {
+        set n_ports 5000
+        set n_iter  5
+        set attrs   {name size direction dimension}
+
+        set top [ig::db::create_module -name "bench_bulk_top"]
+        set sub [ig::db::create_module -name "bench_bulk_sub"]
+        set inst [ig::db::create_instance -name "bench_bulk_sub" -of-module $sub -parent-module $top]
+        for {set i 0} {$i < $n_ports} {incr i} {
+            ig::db::connect -from $top -to $inst -signal-name "s_${i}"
+        }
+        set ports [ig::db::get_ports -of $sub]
+
+        set t [runtime_us {
+            for {set i 0} {$i < $n_iter} {incr i} {
+                foreach p $ports {
+                    foreach a $attrs {
+                        ig::db::get_attribute -object $p -attribute $a -default {}
+                    }
+                }
+            }
+        }]
+        report "attr_bulk: ports"               [llength $ports] ""
+        report "attr_bulk: single get_attribute" [expr {$t / $n_iter / 1000}] "ms"
+
+        set t [runtime_us {
+            for {set i 0} {$i < $n_iter} {incr i} {
+                ig::db::get_attributes -objects $ports -attributes $attrs -defaults {{} {} {} {}}
+            }
+        }]
+        report "attr_bulk: get_attributes"      [expr {$t / $n_iter / 1000}] "ms"
+
+        set t [runtime_us {
+            ig::templates::preprocess::module_to_arraylist $sub
+        }]
+        report "attr_bulk: module_to_arraylist" [expr {$t / 1000}] "ms"
+
+        ig::db::reset
+    }
+
+    proc accessors {} {
+        set n_ports 1000
+        set n_iter  20
+
+        set top [ig::db::create_module -name "bench_acc_top"]
+        set sub [ig::db::create_module -name "bench_acc_sub"]
+        set inst [ig::db::create_instance -name "bench_acc_sub" -of-module $sub -parent-module $top]
+        for {set i 0} {$i < $n_ports} {incr i} {
+            ig::db::connect -from $top -to $inst -signal-name "s_${i}"
+        }
+        set ports [ig::db::get_ports -of $sub]
+        set n_calls [expr {$n_iter * [llength $ports]}]
+
+        set t [runtime_us {
+            for {set i 0} {$i < $n_iter} {incr i} {
+                foreach p $ports {
+                    ig::db::get_attribute -object $p -attribute "name"
+                }
+            }
+        }]
+        report "accessors: get_attribute"    [expr {int ($n_calls * 1e6 / max ($t, 1))}] "calls/s"
+
+        set t [runtime_us {
+            for {set i 0} {$i < $n_iter} {incr i} {
+                foreach p $ports {
+                    ig::db::attr $p "name"
+                }
+            }
+        }]
+        report "accessors: attr"             [expr {int ($n_calls * 1e6 / max ($t, 1))}] "calls/s"
+
+        set n_calls [expr {$n_iter * 100}]
+        set t [runtime_us {
+            for {set i 0} {$i < $n_calls} {incr i} {
+                ig::db::get_ports -all -of $sub
+            }
+        }]
+        report "accessors: get_ports -of"    [expr {int ($n_calls * 1e6 / max ($t, 1))}] "calls/s"
+
+        set t [runtime_us {
+            for {set i 0} {$i < $n_calls} {incr i} {
+                ig::db::children ports $sub
+            }
+        }]
+        report "accessors: children ports"   [expr {int ($n_calls * 1e6 / max ($t, 1))}] "calls/s"
+
+        ig::db::reset
+    }
+
+    variable benchmarks {mem_pins mem_instances mem_attr_unique attr_get traverse connect_deep connect_fanout build_tree connect_bundle connect_deferred connect_deferred_s signal_lookup param_eval attr_bulk accessors}
+}
+
+ig::logger -level E
+
+set selected $argv
+if {[llength $selected] == 0} {
+    set selected $bench::benchmarks
+}
+foreach b $selected {
+    if {[lsearch -exact $bench::benchmarks $b] < 0} {
+        puts stderr "unknown benchmark \"$b\" - available: $bench::benchmarks"
+        exit 1
+    }
+    bench::$b
+}
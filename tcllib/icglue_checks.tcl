@@ -55,23 +55,23 @@ namespace eval ig::checks {
     proc check_resource_module_port_consistency {module_id} {
         set mname [ig::db::get_attribute -object $module_id -attribute "name"]
         set inst_list [list]
-        foreach i_inst [ig::db::get_instances -all] {
-            if {[ig::db::get_attribute -object $i_inst -attribute "module"] eq $module_id} {
-                lappend inst_list $i_inst
+        set all_insts [ig::db::get_instances -all]
+        foreach i_inst $all_insts i_attrs [ig::db::get_attributes -objects $all_insts -attributes {module name}] {
+            lassign $i_attrs i_mod i_name
+            if {$i_mod eq $module_id} {
+                lappend inst_list $i_inst $i_name
             }
         }
-        if {[llength $inst_list] <= 1} {return}
+        if {[llength $inst_list] <= 2} {return}
 
         set ilist [list]
         set pildict [dict create]
 
-        foreach i_inst $inst_list {
-            set iname [ig::db::get_attribute -object $i_inst -attribute "name"]
+        foreach {i_inst iname} $inst_list {
             lappend ilist $iname
 
-            foreach i_pin [ig::db::get_pins -of $i_inst] {
-                set pname [ig::db::get_attribute -object $i_pin -attribute "name"]
-                dict lappend pildict $pname $iname
+            foreach pname [ig::db::get_attributes -objects [ig::db::get_pins -of $i_inst] -attributes {name}] {
+                dict lappend pildict [lindex $pname 0] $iname
             }
         }
 
@@ -103,14 +103,16 @@ namespace eval ig::checks {
         set mname [ig::db::get_attribute -object $module_id -attribute "name"]
         set lang  [ig::db::get_attribute -object $module_id -attribute "language"]
         if {$lang ne "systemverilog"} {
-            foreach i_port [ig::db::get_ports -of $module_id] {
-                set dimension [ig::db::get_attribute -object $i_port -attribute "dimension" -default {}]
+            set ports [ig::db::get_ports -of $module_id]
+            foreach i_port $ports i_attrs [ig::db::get_attributes -objects $ports -attributes {dimension} -defaults {{}}] {
+                set dimension [lindex $i_attrs 0]
                 if {[llength $dimension] ne 0} {
                     ig::log -warn -id "ChkMD" "Port \"${i_port}\" in module \"${mname}\" has dimension \"${dimension}\". This is not supported in \"${lang}\"."
                 }
             }
-            foreach i_decl [ig::db::get_declarations -of $module_id] {
-                set dimension [ig::db::get_attribute -object $i_decl -attribute "dimension" -default {}]
+            set decls [ig::db::get_declarations -of $module_id]
+            foreach i_decl $decls i_attrs [ig::db::get_attributes -objects $decls -attributes {dimension} -defaults {{}}] {
+                set dimension [lindex $i_attrs 0]
                 if {[llength $dimension] ne 0} {
                     ig::log -warn -id "ChkMD" "Declarations \"${i_decl}\" in module \"${mname}\" has dimension \"${dimension}\". This is not supported in \"${lang}\"."
                 }
@@ -123,9 +125,24 @@ namespace eval ig::checks {
     ## @brief Run sanity/consistency checks for given regfile.
     # @param regfile_id Object-ID of regfile to check.
     proc check_regfile {regfile_id} {
+        lassign [ig::db::get_attributes -objects [list $regfile_id] -attributes {name parent}] rf_attrs
+        set entries [ig::templates::preprocess::regfile_to_arraylist $regfile_id]
+
+        # origins of all entries
+        set entry_objs {}
+        foreach i_entry $entries {
+            lappend entry_objs [dict get $i_entry "object"]
+        }
+        set origins [dict create]
+        foreach oid $entry_objs i_origin [ig::db::get_attributes -objects $entry_objs -attributes {origin} -defaults {{}}] {
+            dict set origins $oid [lindex $i_origin 0]
+        }
+
         set rfdata [list \
-            "name"    [ig::db::get_attribute -object $regfile_id -attribute "name"] \
-            "entries" [ig::templates::preprocess::regfile_to_arraylist $regfile_id] \
+            "name"    [lindex $rf_attrs 0] \
+            "module"  [lindex $rf_attrs 1] \
+            "entries" $entries \
+            "origins" $origins \
         ]
 
         check_regfile_addresses   $rfdata
@@ -134,6 +151,21 @@ namespace eval ig::checks {
         check_regfile_names       $rfdata
     }
 
+    ## @brief Origin of a regfile entry.
+    # @param regfile_data preprocessed data of regfile.
+    # @param entry preprocessed data of entry.
+    # @return Origin attribute of the entry or an empty string if unknown.
+    proc entry_origin {regfile_data entry} {
+        set oid [dict get $entry "object"]
+        if {[dict exists $regfile_data "origins" $oid]} {
+            return [dict get $regfile_data "origins" $oid]
+        }
+        if {$oid ne {}} {
+            return [ig::db::get_attribute -object $oid -attribute "origin" -default {}]
+        }
+        return {}
+    }
+
     ## @brief Run regfile entry address check.
     # @param regfile_data preprocessed data of regfile to check.
     proc check_regfile_addresses {regfile_data} {
@@ -147,11 +179,7 @@ namespace eval ig::checks {
         foreach i_entry $entries {
             set name    [dict get $i_entry "name"]
             set address [dict get $i_entry "address"]
-            set oid     [dict get $i_entry "object"]
-            set origin {}
-            if {$oid ne {}} {
-                set origin [ig::db::get_attribute -object $oid -attribute "origin" -default {}]
-            }
+            set origin  [entry_origin $regfile_data $i_entry]
 
             # check if existing
             set idx [lsearch -exact -integer -index 0 $addr_list $address]
@@ -181,11 +209,7 @@ namespace eval ig::checks {
         foreach i_entry $entries {
             set ename [dict get $i_entry "name"]
             set regs  [dict get $i_entry "regs"]
-            set oid   [dict get $i_entry "object"]
-            set origin {}
-            if {$oid ne {}} {
-                set origin [ig::db::get_attribute -object $oid -attribute "origin" -default {}]
-            }
+            set origin [entry_origin $regfile_data $i_entry]
 
             set bit_list [list]
 
@@ -223,14 +247,16 @@ namespace eval ig::checks {
         # assume 32 bit regs - change if other widths supported
         set wordsize 32
 
+        # resolve parameters in reset values in scope of regfile module
+        set scope {}
+        if {[dict exists $regfile_data "module"]} {
+            set scope [list -of [dict get $regfile_data "module"]]
+        }
+
         foreach i_entry $entries {
             set ename [dict get $i_entry "name"]
             set regs  [dict get $i_entry "regs"]
-            set oid   [dict get $i_entry "object"]
-            set origin {}
-            if {$oid ne {}} {
-                set origin [ig::db::get_attribute -object $oid -attribute "origin" -default {}]
-            }
+            set origin [entry_origin $regfile_data $i_entry]
 
             foreach i_reg $regs {
                 set rname  [dict get $i_reg "name"]
@@ -239,7 +265,11 @@ namespace eval ig::checks {
 
                 if {$rstval eq "-"} {continue}
 
-                lassign [ig::vlog::parse_value $rstval] psucc pval rstwidth
+                lassign [ig::db::eval_parameter -value $rstval {*}$scope] psucc pval rstwidth
+                if {!$psucc} {
+                    # values exceeding 64 bits
+                    lassign [ig::vlog::parse_value $rstval] psucc pval rstwidth
+                }
 
                 if {!$psucc} {continue}
                 if {$rstwidth < 0} {
@@ -267,11 +297,7 @@ namespace eval ig::checks {
         foreach i_entry $entries {
             set ename [dict get $i_entry "name"]
             set regs  [dict get $i_entry "regs"]
-            set oid   [dict get $i_entry "object"]
-            set origin {}
-            if {$oid ne {}} {
-                set origin [ig::db::get_attribute -object $oid -attribute "origin" -default {}]
-            }
+            set origin [entry_origin $regfile_data $i_entry]
 
             if {[string match {_*} $ename]} {
                 ig::log -warn -id "ChkRN" "entry \"${ename}\" has a name which potentially conflicts with internal types/names (regfile ${rfname}) (${origin})"
@@ -112,11 +112,13 @@ namespace eval ig {
         #
         # @param filename Path to script.
         # @param sargs List of key-value pairs for variables to set before execution
-        proc run_script {filename {sargs {}}} {
+        # @param deferred Queue connections of the script and route them in parallel (see ig::db::deferred).
+        proc run_script {filename {sargs {}} {deferred "false"}} {
             namespace eval _construct_run [subst {
                 # running in subst mode!! (import local proc args)
                 set filename [list $filename]
                 set sargs    [list $sargs]
+                set deferred [list $deferred]
             }]
             namespace eval _construct_run {
                 namespace import ::ig::*
@@ -126,16 +128,27 @@ namespace eval ig {
                     set $k $v
                 }
 
-                set source_cmd {source $filename}
-                if {[catch $source_cmd emsg eopts]} {
+                if {$deferred} {
+                    ig::db::deferred -begin
+                }
+                if {[catch {source $filename} emsg eopts]} {
                     set error_list [split $::errorInfo "\n"]
 
                     regexp {line\s(\d+)} [lindex $error_list end-2] unused_match line
 
+                    if {$deferred} {
+                        # print messages of connections queued before the error
+                        catch {ig::db::deferred -end}
+                    }
+
                     set sep "\n"
                     ig::log -error "${filename}:${line} -- [join [lrange $error_list 0 end-3] $sep]"
                     exit 1;
                 }
+                if {$deferred && [catch {ig::db::deferred -end} emsg]} {
+                    ig::log -error "${filename} -- ${emsg}"
+                    exit 1;
+                }
             }
             namespace delete _construct_run
         }
@@ -508,12 +521,17 @@ namespace eval ig {
     #      <tr><td><i> &ensp; &ensp; -(-)>               </i></td><td>  first element is interpreted as input source <br></td></tr>
     #      <tr><td><i> &ensp; &ensp; <(-)-               </i></td><td>  last element is interpreted as input source  <br></td></tr>
     #      <tr><td><i> &ensp; &ensp; -p(in)              </i></td><td>  add a pin to a resource module               <br></td></tr>
+    #      <tr><td><i> &ensp; &ensp; -bundle             </i></td><td>  SIGNALNAME is a list of signals with common connections <br></td></tr>
     #
-    # @return Object-ID of net object of the newly created signal.
+    # @return Object-ID of net object of the newly created signal (list of net objects for -bundle).
     #
     # Source and target-lists will be expanded and can contain local signal-name specifications after a ":" symbol
     # (local signal-name suffixes can be generated when the signal-name is followed by "!")
     # and multi-instance-expressions e.g. module\<1,4..9,a,b\>.
+    #
+    # With -bundle all signals of SIGNALNAME are routed along the same hierarchy which is computed only once,
+    # local signal-names are not possible then. The width can be a single width for all signals or a list
+    # with one width per signal.
     proc S args {
         # defaults
         set name         ""
@@ -523,6 +541,7 @@ namespace eval ig {
         set invert       {}
         set resource_pin "false"
         set dimension    {}
+        set bundle       "false"
         set origin       [ig::aux::get_origin_here]
 
         # parse_opts { <regexp> <argumenttype/check> <varname> <description> }
@@ -535,6 +554,7 @@ namespace eval ig {
                 { {^-(-)?>$}               "const=false" invert       "first element is interpreted as input source"} \
                 { {^<(-)?-$}               "const=true"  invert       "last element is interpreted as input source"}  \
                 { {^-p(in)?$}              "const=true"  resource_pin "add a pin to a resource module"}               \
+                { {^-bundle$}              "const=true"  bundle       "signal bundle with common connections"}        \
                 { {^-cmdorigin(=|$)}       "string"      origin       "origin of command call for logging"}           \
             ] -context "SIGNALNAME CONNECTIONPORTS..." $args]
 
@@ -543,6 +563,9 @@ namespace eval ig {
         if {$name eq ""} {
             log -error -abort "S: no signal name specified ($origin)"
         }
+        if {$bundle && ($resource_pin || ($value ne ""))} {
+            log -error -abort "S (signals ${name}): -bundle cannot be combined with -pin or -value ($origin)"
+        }
 
         if {$resource_pin} {
             if {$invert eq "true"} {
@@ -612,16 +635,21 @@ namespace eval ig {
         if {[catch {
             set con_left_e  [construct::expand_instances $con_left  "true" "true"]
 
+            set signal_opts [list -signal-name $name -signal-size $width]
+            if {$bundle} {
+                if {[llength $width] > 1} {
+                    set signal_opts [list -signal-names $name -signal-sizes $width]
+                } else {
+                    set signal_opts [list -signal-names $name -signal-size $width]
+                }
+            }
+            lappend signal_opts -attributes [list "dimension" $dimension] -net-attributes [list "origin" $origin]
+
             if {$bidir} {
-                set net [ig::db::connect -bidir $con_left_e -signal-name $name -signal-size $width]
+                set net [ig::db::connect -bidir $con_left_e {*}$signal_opts]
             } else {
                 set con_right_e [construct::expand_instances $con_right "true" "true"]
-                set net [ig::db::connect -from {*}$con_left_e -to $con_right_e -signal-name $name -signal-size $width]
-            }
-
-            ig::db::set_attribute -object $net -attribute "dimension" -value $dimension
-            foreach obj [ig::db::get_net_objects -of $net] {
-                ig::db::set_attribute -object $obj -attribute "dimension" -value $dimension
+                set net [ig::db::connect -from {*}$con_left_e -to $con_right_e {*}$signal_opts]
             }
 
             if {$value ne ""} {
@@ -652,8 +680,6 @@ namespace eval ig {
             log -error -abort "S (signal ${name}): error while creating signal:\n${emsg} ($origin)"
         }
 
-        ig::db::set_attribute -object $net -attribute "origin" -value $origin
-
         return $net
     }
 
@@ -506,7 +506,7 @@ namespace eval ig::aux {
     #
     # @return Name of the given Object.
     proc object_name {obj} {
-        return [ig::db::get_attribute -object $obj -attribute "name"]
+        return [ig::db::attr $obj "name"]
     }
 
     ## @brief Replacement list for adaption of signal names.
@@ -518,55 +518,56 @@ namespace eval ig::aux {
         set signal_replace [list]
 
         foreach i_port [ig::db::get_ports -of $module -all] {
-            set i_rep [list \
-                [ig::db::get_attribute -object $i_port -attribute "signal"] \
-                [ig::db::get_attribute -object $i_port -attribute "name"] \
-            ]
-            lappend signal_replace $i_rep
+            lappend signal_replace [list [ig::db::attr $i_port "signal"] [ig::db::attr $i_port "name"]]
         }
         foreach i_decl [ig::db::get_declarations -of $module -all] {
-            set i_rep [list \
-                [ig::db::get_attribute -object $i_decl -attribute "signal"] \
-                [ig::db::get_attribute -object $i_decl -attribute "name"] \
-            ]
-            lappend signal_replace $i_rep
+            lappend signal_replace [list [ig::db::attr $i_decl "signal"] [ig::db::attr $i_decl "name"]]
         }
 
         return $signal_replace
     }
 
+    ## @brief Replacement dict for adaption of signal names.
+    #
+    # @param module Module Object-ID for obtaining replacement dict.
+    #
+    # @return Dict of signal names and their local names in the module.
+    proc adapt_replacement_dict {module} {
+        return [ig::db::get_signal -of $module -local-names]
+    }
+
     ## @brief Adapt signalnames in a codesection object if adapt-attribute is set.
     #
     # @param codesection Codesection Object-ID.
     #
     # @return Modified codesection based on "adapt" property.
     proc adapt_codesection {codesection} {
-        set do_adapt [ig::db::get_attribute -object $codesection -attribute "adapt" -default "none"]
-        set code [ig::db::get_attribute -object $codesection -attribute "code"]
+        set do_adapt [ig::db::attr $codesection "adapt" "none"]
+        set code [ig::db::attr $codesection "code"]
         if {$do_adapt eq "none"} {
             return $code
         }
 
-        set origin [ig::db::get_attribute -object $codesection -attribute "origin" -default {}]
+        set origin [ig::db::attr $codesection "origin" {}]
 
         # collect signals of module and replacement-name
-        set parent_mod [ig::db::get_attribute -object $codesection -attribute "parent"]
-        set signal_replace [adapt_replacement_list $parent_mod]
+        set parent_mod [ig::db::attr $codesection "parent"]
+        set signal_replace [adapt_replacement_dict $parent_mod]
 
         # adapt signal-names
         if {$do_adapt eq "selective"} {
-            set code_out [adapt_codesection_replace $code $signal_replace true $origin]
+            set code_out [adapt_codesection_replace_dict $code $signal_replace true $origin]
         } elseif {$do_adapt eq "all"} {
-            set code_out [adapt_codesection_replace $code $signal_replace false $origin]
+            set code_out [adapt_codesection_replace_dict $code $signal_replace false $origin]
         } elseif {$do_adapt eq "signalcheck"} {
             # TODO: remove signalcheck part when no longer necessary
-            set code_out1 [adapt_codesection_replace $code $signal_replace true]
-            set code_out2 [adapt_codesection_replace [ig::db::get_attribute -object $codesection -attribute "checkcode"] $signal_replace false]
+            set code_out1 [adapt_codesection_replace_dict $code $signal_replace true]
+            set code_out2 [adapt_codesection_replace_dict [ig::db::attr $codesection "checkcode"] $signal_replace false]
 
             if {$code_out1 eq $code_out2} {
                 set code_out $code_out1
             } else {
-                ig::log -warn -id "SCADp" "Signal [ig::db::get_attribute -object $codesection -attribute "signalname"] Deprecated to assign to adaptable signalname without using \"adapt-selective\" style with \"!\" after name ($origin)"
+                ig::log -warn -id "SCADp" "Signal [ig::db::attr $codesection "signalname"] Deprecated to assign to adaptable signalname without using \"adapt-selective\" style with \"!\" after name ($origin)"
                 set code_out $code_out2
             }
         } else {
@@ -587,21 +588,21 @@ namespace eval ig::aux {
     #
     # @return Modified connection value based on "adapt" property.
     proc adapt_pin_connection {pin} {
-        set connection [ig::db::get_attribute -object $pin -attribute "connection"]
-        set do_adapt [ig::db::get_attribute -object $pin -attribute "adapt" -default "none"]
+        set connection [ig::db::attr $pin "connection"]
+        set do_adapt [ig::db::attr $pin "adapt" "none"]
         if {$do_adapt eq "none"} {
             return $connection
         }
 
-        set parent_inst [ig::db::get_attribute -object $pin -attribute "parent"]
-        set parent_mod  [ig::db::get_attribute -object $parent_inst -attribute "parent"]
+        set parent_inst [ig::db::attr $pin "parent"]
+        set parent_mod  [ig::db::attr $parent_inst "parent"]
 
-        set signal_replace [adapt_replacement_list $parent_mod]
+        set signal_replace [adapt_replacement_dict $parent_mod]
 
         if {$do_adapt eq "selective"} {
-            set conn_out [adapt_codesection_replace $connection $signal_replace true]
+            set conn_out [adapt_codesection_replace_dict $connection $signal_replace true]
         } elseif {$do_adapt eq "all"} {
-            set conn_out [adapt_codesection_replace $connection $signal_replace false]
+            set conn_out [adapt_codesection_replace_dict $connection $signal_replace false]
         }
 
         return $conn_out
@@ -616,6 +617,26 @@ namespace eval ig::aux {
     #
     # @return adapted code.
     proc adapt_codesection_replace {code replace_list {selective true} {origin {}}} {
+        # first entry of a signal-name is used
+        set replace_dict [dict create]
+        foreach i_rep $replace_list {
+            if {![dict exists $replace_dict [lindex $i_rep 0]]} {
+                dict set replace_dict [lindex $i_rep 0] [lindex $i_rep 1]
+            }
+        }
+
+        return [adapt_codesection_replace_dict $code $replace_dict $selective $origin]
+    }
+
+    ## @brief Helper for code adaption of @ref adapt_codesection with replacements as dict.
+    #
+    # @param code Raw code input.
+    # @param replace_dict Dict of signal-names and replacements (see @ref adapt_replacement_dict).
+    # @param selective If true use selective syntax with "!" after signal names.
+    # @param origin Origin of code for log message.
+    #
+    # @return adapted code.
+    proc adapt_codesection_replace_dict {code replace_dict {selective true} {origin {}}} {
         # adapt signal-names
         if {$selective} {
             set re {^(.*?)(\m[[:alnum:]_]+\M)\!(.*)$}
@@ -628,14 +649,13 @@ namespace eval ig::aux {
             if {[regexp $re $code m_whole m_pre m_var m_post]} {
                 append code_out $m_pre
                 set    code     $m_post
-                set    idx      [lsearch -exact -index 0 $replace_list $m_var]
-                if {$idx < 0} {
+                if {![dict exists $replace_dict $m_var]} {
                     append code_out $m_var
                     if {$selective} {
                         ig::log -warn -id "TACAd" "selective adaption in codesection failed: signal \"$m_var\" not found ($origin)"
                     }
                 } else {
-                    append code_out [lindex $replace_list $idx 1]
+                    append code_out [dict get $replace_dict $m_var]
                 }
             } else {
                 append code_out $code
@@ -656,13 +676,13 @@ namespace eval ig::aux {
         set csllen [llength $cslist]
 
         while {$istart < $csllen} {
-            set align [ig::db::get_attribute -object [dict get [lindex $cslist $istart] object] -attribute "align" -default {}]
+            set align [ig::db::attr [dict get [lindex $cslist $istart] object] "align" {}]
             if {$align eq {}} {
                 incr istart
                 continue
             }
             for {set istop [expr {$istart + 1}]} {$istop < $csllen} {incr istop} {
-                set align_s [ig::db::get_attribute -object [dict get [lindex $cslist $istop] object] -attribute "align" -default {}]
+                set align_s [ig::db::attr [dict get [lindex $cslist $istop] object] "align" {}]
                 if {$align ne $align_s} {
                     break
                 }
@@ -738,16 +758,11 @@ namespace eval ig::aux {
     #
     # @return Adapted signal name if found in specified module.
     proc get_signal_id_by_name {signalname mod_id} {
-        foreach id [concat \
-            [ig::db::get_ports -of $mod_id -all] \
-            [ig::db::get_declarations -of $mod_id -all] \
-        ] {
-            if {[ig::db::get_attribute -object $id -attribute "signal"] eq $signalname} {
-                return "$id"
-            }
+        if {![catch {ig::db::get_signal -of $mod_id -name $signalname} id]} {
+            return $id
         }
 
-        ig::log -warning "Signal $signalname not defined in module [ig::db::get_attribute -object $mod_id -attribute "name"]"
+        ig::log -warning "Signal $signalname not defined in module [ig::db::attr $mod_id "name"]"
         return {}
     }
 
@@ -761,7 +776,7 @@ namespace eval ig::aux {
         set sigid [get_signal_id_by_name ${signalname} ${mod_id}]
 
         if {$sigid ne ""} {
-            return [ig::db::get_attribute -object $sigid -attribute "name"]
+            return [ig::db::attr $sigid "name"]
         } else {
             return $signalname
         }
@@ -804,7 +819,7 @@ namespace eval ig::aux {
             ig::db::set_attribute -obj $rfid -attribute "_save_reg_addr" -value [lindex $args 0]
         }
 
-        return [ig::db::get_attribute -obj $rfid -attribute "_save_reg_addr" -default "0x0000"]
+        return [ig::db::attr $rfid "_save_reg_addr" "0x0000"]
     }
 
     ## @brief Align regfile address
@@ -164,150 +164,7 @@ namespace eval ig::templates {
         # @li signal = Signal this register connects to.
         # @li signalbits = Verilog-range of bits of signal to connect to.
         proc regfile_to_arraylist {regfile_id} {
-            # collect all regfile entries, sort by address
-            set entries [ig::db::get_regfile_entries -all -of $regfile_id]
-            set entry_list {}
-            set wordsize 32
-
-            foreach i_entry $entries {
-                set reg_list {}
-                set regs [ig::db::get_regfile_regs -all -of $i_entry]
-                set next_bit 0
-
-                try {
-                    #entry_default_map {name width entrybits type reset signal signalbits}
-                    foreach i_reg $regs {
-                        set name       [ig::db::get_attribute -object $i_reg -attribute "name"]
-                        set width      [ig::db::get_attribute -object $i_reg -attribute "rf_width"      -default -1]
-                        set entrybits  [ig::db::get_attribute -object $i_reg -attribute "rf_entrybits"  -default ""]
-                        set type       [ig::db::get_attribute -object $i_reg -attribute "rf_type"       -default "RW"]
-                        set reset      [ig::db::get_attribute -object $i_reg -attribute "rf_reset"      -default "-"]
-                        set signal     [ig::db::get_attribute -object $i_reg -attribute "rf_signal"     -default "-"]
-                        set signalbits [ig::db::get_attribute -object $i_reg -attribute "rf_signalbits" -default "-"]
-                        set comment    [ig::db::get_attribute -object $i_reg -attribute "rf_comment"    -default ""]
-
-                        if {$width < 0} {
-                            if {$entrybits eq ""} {
-                                set width $wordsize
-                                set entrybits "[expr {$wordsize - 1}]:0"
-                            } else {
-                                set blist [split $entrybits ":"]
-                                if {[llength $blist] == 1} {
-                                    set width 1
-                                } else {
-                                    set width [expr {[lindex $blist 0] - [lindex $blist 1] + 1}]
-                                }
-                            }
-                        } elseif {$entrybits eq ""} {
-                            if {$width == 1} {
-                                set entrybits "$next_bit"
-                            } else {
-                                set entrybits "[expr {$width + $next_bit - 1}]:$next_bit"
-                            }
-                        }
-
-                        set blist [split $entrybits ":"]
-                        set bit_high [lindex $blist 0]
-                        set next_bit [expr {$bit_high+1}]
-                        if {[llength $blist] == 2} {
-                            set bit_low  [lindex $blist 1]
-                        } else {
-                            set bit_low  $bit_high
-                        }
-
-                        lappend reg_list [list \
-                            $name $bit_high $bit_low $width $entrybits $type $reset $signal $signalbits $comment $i_reg \
-                            ]
-                    }
-                    set reg_list_raw [lsort -integer -index 2 $reg_list]
-                    set reg_list {}
-                    set idx_start -1
-
-                    foreach i_reg $reg_list_raw {
-                        set i_bit_low [lindex $i_reg 2]
-                        set i_bit_high [lindex $i_reg 1]
-                        if {$i_bit_low - $idx_start > 1} {
-                            set tmp_high [expr {$i_bit_low - 1}]
-                            set tmp_low  [expr {$idx_start + 1}]
-                            if {$tmp_high == $tmp_low} {
-                                set entrybits $tmp_high
-                            } else {
-                                set entrybits "${tmp_high}:${tmp_low}"
-                            }
-
-                            lappend reg_list [list \
-                                "name"       "-" \
-                                "bit_high"   $tmp_high \
-                                "bit_low"    $tmp_low \
-                                "width"      [expr {$tmp_high - $tmp_low + 1}] \
-                                "entrybits"  $entrybits \
-                                "type"       "-" \
-                                "reset"      "-" \
-                                "signal"     "-" \
-                                "signalbits" "-" \
-                                "comment"    "" \
-                                "object"     "" \
-                                ]
-                        }
-                        lappend reg_list [list \
-                            "name"       [lindex $i_reg 0] \
-                            "bit_high"   [lindex $i_reg 1] \
-                            "bit_low"    [lindex $i_reg 2] \
-                            "width"      [lindex $i_reg 3] \
-                            "entrybits"  [lindex $i_reg 4] \
-                            "type"       [lindex $i_reg 5] \
-                            "reset"      [lindex $i_reg 6] \
-                            "signal"     [lindex $i_reg 7] \
-                            "signalbits" [lindex $i_reg 8] \
-                            "comment"    [lindex $i_reg 9] \
-                            "object"     [lindex $i_reg 10] \
-                            ]
-
-                        set idx_start $i_bit_high
-                    }
-                    if {$idx_start < $wordsize - 1} {
-                        set tmp_high [expr {$wordsize - 1}]
-                        set tmp_low  [expr {$idx_start + 1}]
-                        if {$tmp_high == $tmp_low} {
-                            set entrybits $tmp_high
-                        } else {
-                            set entrybits "${tmp_high}:${tmp_low}"
-                        }
-
-                        lappend reg_list [list \
-                            "name"       "-" \
-                            "bit_high"   $tmp_high \
-                            "bit_low"    $tmp_low \
-                            "width"      [expr {$tmp_high - $tmp_low + 1}] \
-                            "entrybits"  $entrybits \
-                            "type"       "-" \
-                            "reset"      "-" \
-                            "signal"     "-" \
-                            "signalbits" "-" \
-                            "comment"    "" \
-                            "object"     "" \
-                            ]
-                    }
-
-                    set entry_attributes [ig::db::get_attribute -object $i_entry]
-                    lappend entry_list [list                                                    \
-                        "address" [ig::db::get_attribute -object $i_entry -attribute "address"] \
-                        {*}[dict remove $entry_attributes "address"]                            \
-                        "regs"    $reg_list                                                     \
-                        "object"  $i_entry                                                      \
-                        ]
-                } on error {emsg eopt} {
-                    ig::log -error -id RF [format "Error while processing register \"%s/%s\" in regfile \"%s\" \n -- (%s) --\n%s" \
-                        [ig::db::get_attribute -object ${i_entry} -attribute "name"] ${name} \
-                        [ig::db::get_attribute -object ${regfile_id} -attribute "name"] \
-                        ${i_entry} \
-                        [dict get $eopt {-errorinfo}]
-                    ]
-                }
-            }
-            set entry_list [lsort -integer -index 1 $entry_list]
-
-            return $entry_list
+            return [ig::db::regfile_data -of $regfile_id]
         }
 
         ## @brief Preprocess instance-object into array-list.
@@ -335,44 +192,7 @@ namespace eval ig::templates {
         # @li object = Object-ID of parameter.
         # @li value = Value assigned to parameter.
         proc instance_to_arraylist {instance_id} {
-            set result {}
-
-            set mod [ig::db::get_modules -of $instance_id]
-            set ilm [ig::db::get_attribute -object $mod -attribute "ilm" -default "false"]
-
-            lappend result "name"        [ig::db::get_attribute -object $instance_id -attribute "name"]
-            lappend result "object"      $instance_id
-            lappend result "module"      $mod
-            lappend result "ilm"         $ilm
-            lappend result "module.name" [ig::db::get_attribute -object $mod -attribute "name"]
-
-            # pins
-            set pin_data {}
-            foreach i_pin [ig::db::get_pins -of $instance_id] {
-                lappend pin_data [list \
-                    "name"           [ig::db::get_attribute -object $i_pin -attribute "name"] \
-                    "object"         $i_pin \
-                    "connection"     [ig::aux::adapt_pin_connection $i_pin] \
-                    "connection_raw" [ig::db::get_attribute -object $i_pin -attribute "connection"] \
-                    "invert"         [ig::db::get_attribute -object $i_pin -attribute "invert" -default "false"] \
-                ]
-            }
-            lappend result "pins" $pin_data
-
-            # parameters
-            set param_data {}
-            foreach i_param [ig::db::get_adjustments -of $instance_id] {
-                lappend param_data [list \
-                    "name"           [ig::db::get_attribute -object $i_param -attribute "name"] \
-                    "object"         $i_param \
-                    "value"          [ig::db::get_attribute -object $i_param -attribute "value"] \
-                ]
-            }
-            lappend result "parameters" $param_data
-
-            lappend result "hasparams" [expr {(!$ilm) && ([llength $param_data] > 0)}]
-
-            return $result
+            return [ig::db::instance_data -of $instance_id]
         }
 
         ## @brief Preprocess module-object into arra-list.
@@ -426,94 +246,7 @@ namespace eval ig::templates {
         # @li object = Object-ID of regfile.
         # @li entries = Entries of regfile as array-list as returned by @ref regfile_to_arraylist.
         proc module_to_arraylist {module_id} {
-            set result {}
-
-            lappend result "name"   [ig::db::get_attribute -object $module_id -attribute "name"]
-            lappend result "object" $module_id
-
-            # ports
-            set port_data {}
-            foreach i_port [ig::db::get_ports -of $module_id] {
-                set dimension_bitrange {}
-                foreach dimension [ig::db::get_attribute -object $i_port -attribute "dimension" -default {}] {
-                    append dimension_bitrange [ig::vlog::bitrange $dimension]
-                }
-                lappend port_data [list \
-                    "name"           [ig::db::get_attribute -object $i_port -attribute "name"] \
-                    "object"         $i_port \
-                    "size"           [ig::db::get_attribute -object $i_port -attribute "size"] \
-                    "vlog.bitrange"  [ig::vlog::obj_bitrange $i_port] \
-                    "direction"      [ig::db::get_attribute -object $i_port -attribute "direction"] \
-                    "vlog.direction" [ig::vlog::port_dir $i_port] \
-                    "dimension"      $dimension_bitrange \
-                ]
-            }
-            lappend result "ports" $port_data
-
-            # parameters
-            set param_data {}
-            foreach i_param [ig::db::get_parameters -of $module_id] {
-                lappend param_data [list \
-                    "name"           [ig::db::get_attribute -object $i_param -attribute "name"] \
-                    "object"         $i_param \
-                    "local"          [ig::db::get_attribute -object $i_param -attribute "local"] \
-                    "vlog.type"      [ig::vlog::param_type $i_param] \
-                    "value"          [ig::db::get_attribute -object $i_param -attribute "value"] \
-                ]
-            }
-            lappend result "parameters" $param_data
-
-            # delarations
-            set decl_data {}
-            foreach i_decl [ig::db::get_declarations -of $module_id] {
-                set dimension_bitrange {}
-                foreach dimension [ig::db::get_attribute -object $i_decl -attribute "dimension" -default {}] {
-                    append dimension_bitrange [ig::vlog::bitrange $dimension]
-                }
-                lappend decl_data [list \
-                    "name"           [ig::db::get_attribute -object $i_decl -attribute "name"] \
-                    "object"         $i_decl \
-                    "size"           [ig::db::get_attribute -object $i_decl -attribute "size"] \
-                    "vlog.bitrange"  [ig::vlog::obj_bitrange $i_decl] \
-                    "defaulttype"    [ig::db::get_attribute -object $i_decl -attribute "default_type"] \
-                    "vlog.type"      [ig::vlog::declaration_type $i_decl] \
-                    "dimension"      $dimension_bitrange \
-                ]
-            }
-            lappend result "declarations" $decl_data
-
-            # codesections
-            set code_data {}
-            foreach i_code [ig::db::get_codesections -of $module_id] {
-                lappend code_data [list \
-                    "name"           [ig::db::get_attribute -object $i_code -attribute "name"] \
-                    "object"         $i_code \
-                    "code_raw"       [ig::db::get_attribute -object $i_code -attribute "code"] \
-                    "code"           [ig::aux::adapt_codesection $i_code] \
-                ]
-            }
-            set code_data [ig::aux::align_codesections $code_data]
-            lappend result "code" $code_data
-
-            # instances
-            set inst_data {}
-            foreach i_inst [ig::db::get_instances -of $module_id] {
-                lappend inst_data [instance_to_arraylist $i_inst]
-            }
-            lappend result "instances" $inst_data
-
-            # regfiles
-            set regfile_data {}
-            foreach i_regfile [ig::db::get_regfiles -of $module_id] {
-                lappend regfile_data [list \
-                    "name"    [ig::db::get_attribute -object $i_regfile -attribute "name"] \
-                    "object"  $i_regfile \
-                    "entries" [regfile_to_arraylist $i_regfile] \
-                ]
-            }
-            lappend result "regfiles" $regfile_data
-
-            return $result
+            return [ig::db::module_data -of $module_id]
         }
 
         namespace export *
@@ -946,12 +679,121 @@ namespace eval ig::templates {
         return $template_script
     }
 
+    ## @brief Skip generating outputs whose fingerprint did not change since the last run.
+    #
+    # Only objects reachable from the generated object are fingerprinted (see ig::db::fingerprint),
+    # so outputs of templates querying other objects are not updated if only these change.
+    variable incremental "false"
+    ## @brief Manifest file with fingerprints of all generated outputs, used if @ref incremental is set.
+    variable manifest_file ".icglue_manifest"
+    # loaded manifest: normalized output file -> {fingerprint size checksum}
+    variable manifest [dict create]
+    variable manifest_loaded "false"
+    variable manifest_modified "false"
+
+    ## @brief Load manifest from @ref manifest_file once.
+    proc manifest_load {} {
+        variable manifest
+        variable manifest_file
+        variable manifest_loaded
+
+        if {$manifest_loaded} {
+            return
+        }
+        set manifest_loaded "true"
+
+        if {![file exists $manifest_file] || [catch {
+            set mf [open $manifest_file "r"]
+            set mf_content [read $mf]
+            close $mf
+        }]} {
+            return
+        }
+
+        foreach i_line [split $mf_content "\n"] {
+            if {[catch {llength $i_line} len] || ($len != 4)} {
+                continue
+            }
+            dict set manifest [lindex $i_line 0] [lrange $i_line 1 end]
+        }
+    }
+
+    ## @brief Size and checksum of file content.
+    # @param filename Path to file.
+    # @return List {size checksum}.
+    proc output_checksum {filename} {
+        set f [open $filename "r"]
+        fconfigure $f -translation binary
+        set content [read $f]
+        close $f
+
+        return [list [string length $content] [zlib crc32 $content]]
+    }
+
+    ## @brief Check whether output file is up to date.
+    # @param filename Path to output file.
+    # @param fingerprint Fingerprint of the object/template the output would be generated from.
+    # @return true if the output file exists unmodified since it was generated with the same fingerprint.
+    proc output_unchanged {filename fingerprint} {
+        variable manifest
+
+        manifest_load
+        set fname [file normalize $filename]
+
+        if {![dict exists $manifest $fname] || ![file isfile $filename]} {
+            return "false"
+        }
+
+        set mf_entry [dict get $manifest $fname]
+        if {[lindex $mf_entry 0] ne $fingerprint} {
+            return "false"
+        }
+        return [expr {[lrange $mf_entry 1 end] eq [output_checksum $filename]}]
+    }
+
+    ## @brief Record fingerprint of generated output file in manifest.
+    # @param filename Path to output file.
+    # @param fingerprint Fingerprint of the object/template the output was generated from.
+    #
+    # The manifest is written to disk by @ref write_manifest.
+    proc output_update {filename fingerprint} {
+        variable manifest
+        variable manifest_modified
+
+        manifest_load
+        dict set manifest [file normalize $filename] [list $fingerprint {*}[output_checksum $filename]]
+        set manifest_modified "true"
+    }
+
+    ## @brief Write manifest to @ref manifest_file if modified by output generation.
+    proc write_manifest {} {
+        variable manifest
+        variable manifest_file
+        variable manifest_modified
+
+        if {!$manifest_modified} {
+            return
+        }
+
+        set lines {}
+        dict for {i_fname i_entry} $manifest {
+            lappend lines [list $i_fname {*}$i_entry]
+        }
+        set mf [open $manifest_file "w"]
+        puts $mf [join [lsort $lines] "\n"]
+        close $mf
+
+        set manifest_modified "false"
+    }
+
     ## @brief Generate output for given object of specified type.
     # @param obj_id Object-ID to write output for.
     # @param type Type of template as delivered by @ref ig::templates::current::get_output_types.
     # @param dryrun If set to true, no actual files are written.
     #
     # The output is written to the file specified by the template callback @ref ig::templates::current::get_output_file.
+    # If @ref incremental is set and the output file is recorded in the manifest with the
+    # current fingerprint of object and template, the output is not generated again.
     proc write_object {obj_id type {dryrun false}} {
         if {[catch {set _tt_name [current::get_template_file $obj_id $type]}]} {
             return
@@ -972,6 +814,18 @@ namespace eval ig::templates {
             }
         }
 
+        set _tt_code [get_template_script ${_tt_name}]
+
+        variable incremental
+        set _fingerprint {}
+        if {$incremental && !$dryrun} {
+            set _fingerprint [ig::db::fingerprint -object $obj_id -data [list [package present ICGlue] $type ${_tt_code}]]
+            if {[output_unchanged ${_outf_name} ${_fingerprint}]} {
+                ig::log -info -id Gen "Unchanged ${_outf_name_var}"
+                return
+            }
+        }
+
         ig::log -info -id Gen "Generating ${_outf_name_var}"
         ig::log -info -id TPrs "Parsing template ${_tt_name}"
         set block_data [list]
@@ -982,8 +836,6 @@ namespace eval ig::templates {
             set block_data [parse_keep_blocks ${_old} [file extension ${_outf_name}]]
         }
 
-        set _tt_code [get_template_script ${_tt_name}]
-
         # evaluate result in temporary namespace
         eval [join [list \
             "namespace eval _template_run \{" \
@@ -1028,6 +880,10 @@ namespace eval ig::templates {
             set _outf [open ${_outf_name} "w"]
             puts -nonewline ${_outf} ${_res}
             close ${_outf}
+
+            if {${_fingerprint} ne ""} {
+                output_update ${_outf_name} ${_fingerprint}
+            }
         }
     }
 
@@ -60,7 +60,7 @@ namespace eval ig::vlog {
     #
     # @return Bitrange as in @ref bitrange.
     proc obj_bitrange {obj} {
-        set size [ig::db::get_attribute -object $obj -attribute "size"]
+        set size [ig::db::attr $obj "size"]
         return [bitrange $size]
     }
 
@@ -70,7 +70,7 @@ namespace eval ig::vlog {
     #
     # @return Verilog port direction.
     proc port_dir {port} {
-        set dir [ig::db::get_attribute -object $port -attribute "direction"]
+        set dir [ig::db::attr $port "direction"]
         if {$dir eq "input"} {return "input"}
         if {$dir eq "output"} {return "output"}
         if {$dir eq "bidirectional"} {return "inout"}
@@ -83,7 +83,7 @@ namespace eval ig::vlog {
     #
     # @return Verilog parameter type.
     proc param_type {param} {
-        if {[ig::db::get_attribute -object $param -attribute "local"]} {
+        if {[ig::db::attr $param "local"]} {
             return "localparam"
         } else {
             return "parameter"
@@ -96,7 +96,7 @@ namespace eval ig::vlog {
     #
     # @return Verilog declaration type.
     proc declaration_type {decl} {
-        if {[ig::db::get_attribute -object $decl -attribute "default_type"]} {
+        if {[ig::db::attr $decl "default_type"]} {
             return "wire"
         } else {
             return "reg"